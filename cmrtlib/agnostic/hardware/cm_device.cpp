@@ -41,6 +41,8 @@ class CmBufferStateless;
 CmPerfStatistics gCmPerfStatistics;  // global instance to record API's perf
 #endif
 
+CmKernelTimeStatistics gCmKernelTimeStatistics;  // global instance to record kernels' gpu time
+
 CM_RT_API int32_t CmDevice_RT::CreateBuffer(uint32_t size, CmBuffer* &buffer)
 {
     INSERT_PROFILER_RECORD();
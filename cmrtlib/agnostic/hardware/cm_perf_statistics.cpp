@@ -20,9 +20,159 @@
 * OTHER DEALINGS IN THE SOFTWARE.
 */
 #include "cm_perf_statistics.h"
+#include <cstdlib>
+#include "cm_event_base.h"
 #include "cm_mem.h"
 #include "cm_sdk_provider.h"
 
+CmKernelTimeStatistics::CmKernelTimeStatistics()
+{
+    char *kernelTimeLog = nullptr;
+    CM_GETENV(kernelTimeLog, "CM_RT_KERNEL_TIME_LOG");
+    m_enabled = (kernelTimeLog != nullptr) && (atoi(kernelTimeLog) != 0);
+}
+
+CmKernelTimeStatistics::~CmKernelTimeStatistics()
+{
+    DumpKernelTimeStatistics();
+}
+
+//! Add the execution time of a finished task into the histogram of its kernel names
+void CmKernelTimeStatistics::InsertKernelExecutionTime(CmEvent *event)
+{
+    if (!m_enabled || event == nullptr)
+    {
+        return;
+    }
+
+    CM_STATUS status = CM_STATUS_QUEUED;
+    uint64_t  time = 0;
+    if (event->GetStatus(status) != CM_SUCCESS || status != CM_STATUS_FINISHED ||
+        event->GetExecutionTime(time) != CM_SUCCESS)
+    {
+        return;
+    }
+
+    // name by all the kernels in the task, e.g. "kernelA+kernelB"
+    char     kernelName[KERNEL_NAME_STRING_SIZE] = {0};
+    uint32_t kernelCount = 0;
+    event->GetProfilingInfo(CM_EVENT_PROFILING_KERNELCOUNT, sizeof(kernelCount), nullptr, &kernelCount);
+    for (uint32_t i = 0; i < kernelCount; i++)
+    {
+        char *name = nullptr;
+        if (event->GetProfilingInfo(CM_EVENT_PROFILING_KERNELNAMES, sizeof(name), &i, &name) != CM_SUCCESS ||
+            name == nullptr)
+        {
+            break;
+        }
+        size_t length = strlen(kernelName);
+        snprintf(kernelName + length, KERNEL_NAME_STRING_SIZE - length, "%s%s", (i == 0) ? "" : "+", name);
+    }
+    if (kernelName[0] == '\0')
+    {
+        CM_STRCPY(kernelName, KERNEL_NAME_STRING_SIZE, "Unknown");
+    }
+
+    uint32_t bucket = 0;
+    for (uint64_t t = time >> 1; t != 0 && bucket < KERNEL_TIME_BUCKET_NUM - 1; t >>= 1)
+    {
+        bucket++;
+    }
+
+    CLock locker(m_criticalSection);
+
+    KernelTimeStatistic *record = nullptr;
+    for (uint32_t i = 0; i < m_kernelTimeRecords.size(); i++)
+    {
+        if (!strcmp(kernelName, m_kernelTimeRecords[i]->kernelName))
+        {
+            record = m_kernelTimeRecords[i];
+            break;
+        }
+    }
+
+    if (record == nullptr)
+    { // record does not exist, create new entry
+        record = new (std::nothrow) KernelTimeStatistic;
+        if (record == nullptr)
+        {
+            return;
+        }
+        CmSafeMemSet(record, 0, sizeof(KernelTimeStatistic));
+        CM_STRCPY(record->kernelName, KERNEL_NAME_STRING_SIZE, kernelName);
+        record->minTime = time;
+        m_kernelTimeRecords.push_back(record);
+    }
+
+    record->count++;
+    record->totalTime += time;
+    record->minTime = (time < record->minTime) ? time : record->minTime;
+    record->maxTime = (time > record->maxTime) ? time : record->maxTime;
+    record->buckets[bucket]++;
+}
+
+uint64_t CmKernelTimeStatistics::GetPercentile(KernelTimeStatistic *record, uint32_t percent)
+{
+    // rank of the percentile, rounded up
+    uint64_t rank = ((uint64_t)record->count * percent + 99) / 100;
+    uint64_t accumulated = 0;
+
+    for (uint32_t i = 0; i < KERNEL_TIME_BUCKET_NUM; i++)
+    {
+        accumulated += record->buckets[i];
+        if (accumulated >= rank && accumulated > 0)
+        {
+            uint64_t upperBound = (i < KERNEL_TIME_BUCKET_NUM - 1) ? ((uint64_t)1 << (i + 1)) : record->maxTime;
+            return (upperBound < record->maxTime) ? upperBound : record->maxTime;
+        }
+    }
+
+    return record->maxTime;
+}
+
+//Dump Kernel Time Statistic Records and Release m_kernelTimeRecords Array
+void CmKernelTimeStatistics::DumpKernelTimeStatistics()
+{
+    if (!m_enabled || m_kernelTimeRecords.empty())
+    {
+        return;
+    }
+
+    FILE *kernelTimeFile = nullptr;
+    CM_FOPEN(kernelTimeFile, "CmKernelTimeStatistics.txt", "wb");
+    if (kernelTimeFile)
+    {
+        fprintf(kernelTimeFile, "%-40s %s \t %s \t %s \t %s \t %s \t %s \n", "KernelName", "Count",
+                "Avg(us)", "Min(us)", "P50(us)", "P99(us)", "Max(us)");
+    }
+    else
+    {
+        fprintf(stdout, "Fail to create file CmKernelTimeStatistics.txt \n ");
+    }
+
+    for (uint32_t i = 0; i < m_kernelTimeRecords.size(); i++)
+    {
+        KernelTimeStatistic *record = m_kernelTimeRecords[i];
+
+        if (kernelTimeFile)
+        {
+            fprintf(kernelTimeFile, "%-40s %u \t %.3f \t %.3f \t %.3f \t %.3f \t %.3f \n", record->kernelName,
+                    record->count, record->totalTime / 1000.0 / record->count, record->minTime / 1000.0,
+                    GetPercentile(record, 50) / 1000.0, GetPercentile(record, 99) / 1000.0,
+                    record->maxTime / 1000.0);
+        }
+
+        CmSafeRelease(record);
+    }
+
+    m_kernelTimeRecords.clear();
+
+    if (kernelTimeFile)
+    {
+        fclose(kernelTimeFile);
+    }
+}
+
 #if MDF_PROFILER_ENABLED
 
 CmPerfStatistics::CmPerfStatistics()
@@ -27,6 +27,68 @@
 #include "cm_def_hw.h"
 #include "cm_include.h"
 
+class CmEvent;
+
+#define KERNEL_NAME_STRING_SIZE 256
+#define KERNEL_TIME_BUCKET_NUM  64
+
+struct KernelTimeStatistic
+{
+    char     kernelName[KERNEL_NAME_STRING_SIZE];  // kernel names of the task
+    uint64_t totalTime;                             // accumulative gpu execution time in ns
+    uint64_t minTime;                               // shortest gpu execution time in ns
+    uint64_t maxTime;                               // longest gpu execution time in ns
+    uint32_t count;                                 // finished tasks
+    uint32_t buckets[KERNEL_TIME_BUCKET_NUM];       // bucket i counts times in [2^i, 2^(i+1)) ns
+};
+
+class CmKernelTimeStatistics
+{
+public:
+    CmKernelTimeStatistics();
+    ~CmKernelTimeStatistics();
+
+    //!
+    //! \brief    Insert the GPU execution time of a finished task
+    //! \details  Adds the execution time reported by the event into the
+    //!           log-bucketed histogram of the task's kernel names. Events
+    //!           which are not finished yet are ignored. No-op unless env
+    //!           variable "CM_RT_KERNEL_TIME_LOG" is set.
+    //! \param    [in] event
+    //!           pointer to the event of the task
+    //!
+    void InsertKernelExecutionTime(CmEvent *event);
+
+private:
+
+    //!
+    //! \brief    Estimate a percentile of the execution time
+    //! \details  Returns the upper bound of the bucket holding the
+    //!           percentile, clamped to the longest recorded time.
+    //! \param    [in] record
+    //!           pointer to the kernel time statistic
+    //! \param    [in] percent
+    //!           percentile in [0, 100]
+    //! \return   estimated execution time in ns
+    //!
+    uint64_t GetPercentile(KernelTimeStatistic *record, uint32_t percent);
+
+    //!
+    //! \brief    Dump kernel time statistic records into file
+    //! \details  Dump kernel time statistic records into file,
+    //!           "CmKernelTimeStatistics.txt" under app's location.
+    //!
+    void DumpKernelTimeStatistics();
+
+    CSync           m_criticalSection;
+    std::vector<KernelTimeStatistic*>  m_kernelTimeRecords;  // array to store kernel time statistics
+    bool            m_enabled;
+
+private:
+    CmKernelTimeStatistics(const CmKernelTimeStatistics &other);
+    CmKernelTimeStatistics &operator=(const CmKernelTimeStatistics &other);
+};
+
 #if MDF_PROFILER_ENABLED
 
 #define MAX_RECORD_NUM  256
@@ -24,8 +24,11 @@
 #include "cm_device.h"
 #include "cm_include.h"
 #include "cm_mem.h"
+#include "cm_perf_statistics.h"
 #include "cm_timer.h"
 
+extern CmKernelTimeStatistics gCmKernelTimeStatistics;
+
 struct CM_CREATEQUEUE_PARAM
 {
     CM_QUEUE_CREATE_OPTION createOption; // [in/out]
@@ -515,6 +518,8 @@ CM_RT_API int32_t CmQueue_RT::DestroyEvent(CmEvent *&event)
         return CM_FAILURE;
     }
 
+    gCmKernelTimeStatistics.InsertKernelExecutionTime(event);
+
     CM_DESTROYEVENT_PARAM inParam;
     CmSafeMemSet(&inParam, 0, sizeof(inParam));
     inParam.cmQueueHandle = m_cmQueueHandle;
@@ -858,6 +863,8 @@ CM_RT_API int32_t CmQueue_RT::DestroyEventFast(CmEvent *&event)
         return CM_INVALID_ARG_VALUE;
     }
 
+    gCmKernelTimeStatistics.InsertKernelExecutionTime(event);
+
     CM_DESTROYEVENT_PARAM inParam;
     CmSafeMemSet(&inParam, 0, sizeof(inParam));
     inParam.cmQueueHandle = m_cmQueueHandle;
@@ -46,6 +46,15 @@ public:
         clientControlled    //<! If space is not available, heap manager returns so client can decide what to do
     };
 
+    //! \brief Acquisition statistics, used to size the initial heap so that extends are avoided
+    struct Statistics
+    {
+        uint32_t m_acquireCount = 0;    //!< Number of AcquireSpace() calls
+        uint32_t m_waitCount = 0;       //!< Number of waits for space to become available
+        uint32_t m_extendCount = 0;     //!< Number of heaps allocated after the first one
+        uint32_t m_peakUsedSize = 0;    //!< Peak size of space allocated or submitted at once
+    };
+
     HeapManager()
     {
         HEAP_FUNCTION_ENTER;
@@ -172,6 +181,29 @@ public:
         return m_extendHeapSize;
     }
 
+    //!
+    //! \brief  Gets the acquisition statistics of the heap manager, which may be
+    //!         used to tune the initial heap size \see SetInitialHeapSize
+    //! \return The statistics collected since the heap manager was created
+    //!
+    const Statistics &GetStatistics()
+    {
+        HEAP_FUNCTION_ENTER;
+        m_statistics.m_peakUsedSize = m_blockManager.GetPeakUsedSize();
+        return m_statistics;
+    }
+
+    //!
+    //! \brief  Indicates whether any heap has been allocated yet
+    //! \return true if the first heap is allocated, heap allocation is delayed
+    //!         to the first AcquireSpace()
+    //!
+    bool IsHeapAllocated()
+    {
+        HEAP_FUNCTION_ENTER;
+        return !m_heapIds.empty();
+    }
+
     //!
     //! \brief   All heaps allocated are locked and kept locked for their lifetimes
     //! \details May only be set before any heaps are allocated.
@@ -240,6 +272,8 @@ private:
     std::list<uint32_t> m_heapIds;
     //! \brief OS interface used for managing graphics resources
     PMOS_INTERFACE m_osInterface = nullptr;
+    //! \brief Acquisition statistics \see GetStatistics
+    Statistics m_statistics;
     //!< Indictaes that heap is used by hardware write only.
     bool m_hwWriteOnlyHeap = false;
 };
@@ -173,6 +173,12 @@ protected:
     //!
     uint32_t GetSize() { return m_totalSizeOfHeaps; }
 
+    //!
+    //! \brief  Gets the largest amount of space in use at once
+    //! \return The peak of the allocated and submitted pool sizes
+    //!
+    uint32_t GetPeakUsedSize() { return m_peakUsedSize; }
+
     //!
     //! \brief  Determines whether a valid tracker data has been registered
     //! \return True if the pointer is valid, false otherwise
@@ -441,6 +447,8 @@ private:
     
     //! \brief Persistent storage for the sorted sizes used during AcquireSpace()
     std::list<SortedSizePair> m_sortedSizes;
+    //! \brief Peak of the allocated and submitted pool sizes \see GetPeakUsedSize
+    uint32_t m_peakUsedSize = 0;
     //! \brief TrackerProducer
     FrameTrackerProducer *m_trackerProducer = nullptr;
     //! \bried Whether trackerProducer is set
@@ -111,6 +111,7 @@ typedef enum _MOS_USER_FEATURE_VALUE_ID
     __MEDIA_USER_FEATURE_VALUE_PERF_PROFILER_OUTPUT_FILE,
     __MEDIA_USER_FEATURE_VALUE_PERF_PROFILER_BUFFER_SIZE,
     __MEDIA_USER_FEATURE_VALUE_PERF_PROFILER_ENABLE_MULTI_PROCESS,
+    __MEDIA_USER_FEATURE_VALUE_PERF_PROFILER_RING_BUFFER,
     __MEDIA_USER_FEATURE_VALUE_PERF_PROFILER_REGISTER_1,
     __MEDIA_USER_FEATURE_VALUE_PERF_PROFILER_REGISTER_2,
     __MEDIA_USER_FEATURE_VALUE_PERF_PROFILER_REGISTER_3,
@@ -169,7 +169,7 @@ public:
     inline bool IsDefinitionExist(const std::string &itemName)
     {
         bool ret = false;
-        for (auto defs : m_definitions)
+        for (auto &defs : m_definitions)
         {
             auto it = defs.find(MakeHash(itemName));
             if (it != defs.end())
@@ -197,6 +197,22 @@ public:
 
         return m_definitions[group];
     }
+
+    //!
+    //! \brief    Get the definition of specific item
+    //! \param    [in] itemName
+    //!           Name of the item
+    //! \param    [in] group
+    //!           Group of the item
+    //! \return   std::shared_ptr<Definition>
+    //!           The definition, nullptr if the item is not registered
+    //!
+    inline std::shared_ptr<Definition> GetDefinition(const std::string &itemName, const Group &group)
+    {
+        auto &defs = GetDefinitions(group);
+        auto it    = defs.find(MakeHash(itemName));
+        return (it != defs.end()) ? it->second : nullptr;
+    }
 protected:
 
     //!
@@ -39,5 +39,6 @@
 
 #define __MEDIA_USER_FEATURE_VALUE_ENABLE_SOFTPIN       "Enable Softpin"
 #define __MEDIA_USER_FEATURE_VALUE_DISABLE_KMD_WATCHDOG "Disable KMD Watchdog"
+#define __MEDIA_USER_FEATURE_VALUE_ENABLE_ASYNC_SUBMISSION "Enable Async Submission"
 
 #endif // __MOS_UTIL_USER_FEATURE_KEYS_SPECIFIC_H__
@@ -67,6 +67,14 @@ namespace CMRT_UMD
 {
 const uint32_t CmDeviceRTBase::m_maxPrintBuffer = 16;
 
+CSync CmDeviceRTBase::m_criticalSectionJitCache;
+
+std::map<uint64_t, CM_JIT_CACHE_ENTRY> CmDeviceRTBase::m_jitCache;
+
+size_t CmDeviceRTBase::m_jitCacheSize = 0;
+
+uint64_t CmDeviceRTBase::m_jitCacheUseCount = 0;
+
 //*-----------------------------------------------------------------------------
 //| Purpose:    Cm Device Acquire: Increae the m_cmDeviceRefCount
 //| Returns:    CM_SUCCESS
@@ -886,6 +894,122 @@ CSync* CmDeviceRTBase::GetProgramKernelLock()
     return &m_criticalSectionProgramKernel;
 }
 
+//*-----------------------------------------------------------------------------
+//| Purpose:    Find jitter output cached by an earlier program load, copy the
+//|             binary out since the entry may be evicted while it is in use.
+//| Returns:    true if found.
+//*-----------------------------------------------------------------------------
+bool CmDeviceRTBase::FindJitCacheEntry(uint64_t key,
+                                       const char *kernelName,
+                                       const void *isa,
+                                       uint32_t isaSize,
+                                       void *&binary,
+                                       uint32_t &binarySize,
+                                       FINALIZER_INFO *jitInfo)
+{
+    binary     = nullptr;
+    binarySize = 0;
+    if (kernelName == nullptr || isa == nullptr || isaSize == 0 || jitInfo == nullptr)
+    {
+        return false;
+    }
+
+    CLock locker(m_criticalSectionJitCache);
+
+    auto it = m_jitCache.find(key);
+    if (it == m_jitCache.end())
+    {
+        return false;
+    }
+
+    // key is a 64-bit content hash, compare the content to rule out a collision
+    CM_JIT_CACHE_ENTRY &entry = it->second;
+    if (entry.kernelName != kernelName ||
+        entry.isa == nullptr ||
+        entry.isa->size() != isaSize ||
+        memcmp(entry.isa->data(), isa, isaSize) != 0)
+    {
+        return false;
+    }
+
+    binary = malloc(entry.binary.size());
+    if (binary == nullptr)
+    {
+        return false;
+    }
+    CmSafeMemCopy(binary, entry.binary.data(), entry.binary.size());
+    binarySize = (uint32_t)entry.binary.size();
+    CmSafeMemCopy(jitInfo, entry.jitInfo.data(), CM_JIT_PROF_INFO_SIZE);
+
+    entry.lastUse = ++m_jitCacheUseCount;
+    return true;
+}
+
+//*-----------------------------------------------------------------------------
+//| Purpose:    Keep a copy of jitter output for later program loads. The whole
+//|             CM_JIT_PROF_INFO_SIZE block is kept, buffers allocated by the
+//|             jitter for debug info are not.
+//| Returns:    None.
+//*-----------------------------------------------------------------------------
+void CmDeviceRTBase::AddJitCacheEntry(uint64_t key,
+                                      const char *kernelName,
+                                      const std::shared_ptr<const std::vector<uint8_t>> &isa,
+                                      const void *binary,
+                                      uint32_t binarySize,
+                                      const FINALIZER_INFO *jitInfo)
+{
+    if (kernelName == nullptr || isa == nullptr || binary == nullptr || binarySize == 0 || jitInfo == nullptr)
+    {
+        return;
+    }
+
+    size_t entrySize = isa->size() + binarySize + CM_JIT_PROF_INFO_SIZE;
+    if (entrySize > CM_JIT_CACHE_MAX_SIZE)
+    {
+        return;
+    }
+
+    CLock locker(m_criticalSectionJitCache);
+
+    if (m_jitCache.find(key) != m_jitCache.end())
+    {
+        return;
+    }
+
+    // evict least recently used entries until the new one fits
+    while (!m_jitCache.empty() &&
+           (m_jitCacheSize + entrySize > CM_JIT_CACHE_MAX_SIZE || m_jitCache.size() >= CM_JIT_CACHE_MAX_ENTRIES))
+    {
+        auto lru = m_jitCache.begin();
+        for (auto it = m_jitCache.begin(); it != m_jitCache.end(); ++it)
+        {
+            if (it->second.lastUse < lru->second.lastUse)
+            {
+                lru = it;
+            }
+        }
+        m_jitCacheSize -= lru->second.size;
+        m_jitCache.erase(lru);
+    }
+
+    CM_JIT_CACHE_ENTRY &entry = m_jitCache[key];
+    entry.kernelName = kernelName;
+    entry.isa        = isa;
+    entry.size       = entrySize;
+    entry.lastUse    = ++m_jitCacheUseCount;
+    m_jitCacheSize  += entrySize;
+    entry.binary.assign((const uint8_t *)binary, (const uint8_t *)binary + binarySize);
+    entry.jitInfo.assign((const uint8_t *)jitInfo, (const uint8_t *)jitInfo + CM_JIT_PROF_INFO_SIZE);
+
+    FINALIZER_INFO *cachedInfo   = (FINALIZER_INFO *)entry.jitInfo.data();
+    cachedInfo->genDebugInfo     = nullptr;
+    cachedInfo->genDebugInfoSize = 0;
+    cachedInfo->bbNum            = 0;
+    cachedInfo->bbInfo           = nullptr;
+    cachedInfo->freeGRFInfo      = nullptr;
+    cachedInfo->freeGRFInfoSize  = 0;
+}
+
 std::vector<CmQueueRT *> &CmDeviceRTBase::GetQueue()
 {
     return m_queue;
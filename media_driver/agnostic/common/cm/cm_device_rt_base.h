@@ -37,6 +37,9 @@
 #include "cm_program.h"
 #include "cm_notifier.h"
 
+#include <map>
+#include <memory>
+
 #if USE_EXTENSION_CODE
 #include "cm_gtpin.h"
 #endif
@@ -78,6 +81,24 @@ struct CM_OBJECT_COUNT
     int32_t eventCount;
 };
 
+//! Jit cache budget. Least recently used entries are dropped beyond it. The ISA
+//! shared by the kernels of a program is counted for each of its entries.
+#define CM_JIT_CACHE_MAX_SIZE       (64 * 1024 * 1024)
+#define CM_JIT_CACHE_MAX_ENTRIES    1024
+
+//! \brief    Jitter output kept for reuse across program loads of the process
+struct CM_JIT_CACHE_ENTRY
+{
+    std::string          kernelName;
+    //! ISA the entry was built from, compared on lookup to rule out hash collisions
+    std::shared_ptr<const std::vector<uint8_t>> isa;
+    std::vector<uint8_t> binary;
+    //! whole CM_JIT_PROF_INFO_SIZE block handed to the jitter, FINALIZER_INFO first
+    std::vector<uint8_t> jitInfo;
+    size_t               size    = 0;   //!< bytes counted against CM_JIT_CACHE_MAX_SIZE
+    uint64_t             lastUse = 0;   //!< m_jitCacheUseCount of the last add or hit
+};
+
 
 //! \brief    Class CmDeviceRTBase definitions
 class CmDeviceRTBase: public CmDevice
@@ -348,6 +369,32 @@ public:
 
     CSync* GetQueueLock();
 
+    //! \brief    Find jitter output cached under the given content hash
+    //! \details  The cache is shared by all devices of the process. An entry
+    //!           only matches when kernel name and ISA are the same. On a hit
+    //!           the binary is copied to a buffer the caller releases with
+    //!           free(), since entries may be evicted later, and the cached
+    //!           CM_JIT_PROF_INFO_SIZE block is copied to jitInfo.
+    //! \return   true if found
+    static bool FindJitCacheEntry(uint64_t key,
+                                  const char *kernelName,
+                                  const void *isa,
+                                  uint32_t isaSize,
+                                  void *&binary,
+                                  uint32_t &binarySize,
+                                  FINALIZER_INFO *jitInfo);
+
+    //! \brief    Keep a copy of jitter output under the given content hash
+    //! \details  jitInfo points to a block of CM_JIT_PROF_INFO_SIZE bytes.
+    //!           Least recently used entries are evicted to stay within
+    //!           CM_JIT_CACHE_MAX_SIZE and CM_JIT_CACHE_MAX_ENTRIES.
+    static void AddJitCacheEntry(uint64_t key,
+                          const char *kernelName,
+                          const std::shared_ptr<const std::vector<uint8_t>> &isa,
+                          const void *binary,
+                          uint32_t binarySize,
+                          const FINALIZER_INFO *jitInfo);
+
     int32_t LoadPredefinedCopyKernel(CmProgram*& pProgram);
 
     int32_t LoadPredefinedInitKernel(CmProgram*& pProgram);
@@ -593,6 +640,14 @@ protected:
 
     CSync m_criticalSectionQueue;
 
+    static CSync m_criticalSectionJitCache;
+
+    static std::map<uint64_t, CM_JIT_CACHE_ENTRY> m_jitCache;
+
+    static size_t m_jitCacheSize;
+
+    static uint64_t m_jitCacheUseCount;
+
     std::list<uint8_t *> m_printBufferMems;
 
     std::list<CmBufferUP *> m_printBufferUPs;
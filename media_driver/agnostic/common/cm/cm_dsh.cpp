@@ -50,12 +50,67 @@ MOS_STATUS CmDSH::Initialize(FrameTrackerProducer *trackerProducer)
     CM_CHK_MOSSTATUS_RETURN(m_heapMgr->SetInitialHeapSize(m_initSize));
     CM_CHK_MOSSTATUS_RETURN(m_heapMgr->SetExtendHeapSize(m_stepSize));
     CM_CHK_MOSSTATUS_RETURN(m_heapMgr->RegisterTrackerProducer(trackerProducer));
+
+    // Size the first heap for maxTasks tasks in flight, each with a full curbe
+    // and one interface descriptor per kernel, before anything is allocated.
+    CM_CHK_NULL_RETURN_MOSERROR(m_cmhal->renderHal);
+    CM_CHK_NULL_RETURN_MOSERROR(m_cmhal->renderHal->pHwSizes);
+    uint64_t mediaStateSize = MOS_ALIGN_CEIL(CM_MAX_CURBE_SIZE_PER_TASK, MHW_SAMPLER_STATE_ALIGN) +
+        (uint64_t)m_cmhal->cmDeviceParam.maxKernelsPerTask * m_cmhal->renderHal->pHwSizes->dwSizeInterfaceDescriptor;
+    uint64_t size = (uint64_t)m_cmhal->cmDeviceParam.maxTasks * mediaStateSize;
+    CM_CHK_MOSSTATUS_RETURN(Reserve((uint32_t)MOS_MIN(size, (uint64_t)UINT32_MAX)));
+
     // lock the heap in the beginning, so cpu doesn't need to wait gpu finishing occupying it to lock it again
     CM_CHK_MOSSTATUS_RETURN(m_heapMgr->LockHeapsOnAllocate());
 
     return MOS_STATUS_SUCCESS;
 }
 
+MOS_STATUS CmDSH::Reserve(uint32_t size)
+{
+    CM_CHK_NULL_RETURN_MOSERROR(m_heapMgr);
+
+    uint32_t totalSize = m_heapMgr->GetTotalSize();
+    if (size <= totalSize)
+    {
+        return MOS_STATUS_SUCCESS;
+    }
+
+    if (!m_heapMgr->IsHeapAllocated())
+    {
+        // heap not allocated yet, the first AcquireSpace() will allocate this size
+        CM_CHK_MOSSTATUS_RETURN(m_heapMgr->SetInitialHeapSize(size));
+    }
+    else if (m_heapMgr->GetExtendSize() < size - totalSize)
+    {
+        CM_CHK_MOSSTATUS_RETURN(m_heapMgr->SetExtendHeapSize(size - totalSize));
+    }
+
+    return MOS_STATUS_SUCCESS;
+}
+
+void CmDSH::UpdateMediaStateSize(CmMediaState *mediaState)
+{
+    if (mediaState == nullptr)
+    {
+        return;
+    }
+
+    CMRT_UMD::CLock locker(m_sizeSection);
+    if (mediaState->GetSize() <= m_maxMediaStateSize)
+    {
+        return;
+    }
+    m_maxMediaStateSize = mediaState->GetSize();
+
+    // size the heap for the number of tasks allowed in flight
+    uint64_t size = (uint64_t)m_cmhal->cmDeviceParam.maxTasks * m_maxMediaStateSize;
+    if (Reserve((uint32_t)MOS_MIN(size, (uint64_t)UINT32_MAX)) != MOS_STATUS_SUCCESS)
+    {
+        CM_ASSERTMESSAGE("Error: Failed to reserve dynamic state heap space.");
+    }
+}
+
 CmMediaState* CmDSH::CreateMediaState()
 {
     CmMediaState *mediaState = MOS_New(CmMediaState, m_cmhal);
@@ -26,6 +26,7 @@
 #pragma once
 
 #include "cm_hal.h"
+#include "cm_csync.h"
 
 class CmMediaState;
 class HeapManager;
@@ -38,6 +39,31 @@ public:
     ~CmDSH();
     MOS_STATUS Initialize(FrameTrackerProducer *trackerProducer);
 
+    //!
+    //! \brief    Reserve heap capacity ahead of the next enqueues
+    //! \details  The heap is allocated lazily on the first space acquisition,
+    //!           so growing the initial size before it avoids the destructive
+    //!           extends (and the old heap waits) during the first frames.
+    //!           Once the heap exists, the size is applied to later extends.
+    //!           Initialize() reserves the worst case curbe and interface
+    //!           descriptors of cmDeviceParam.maxTasks tasks, and
+    //!           UpdateMediaStateSize() follows the largest media state seen.
+    //! \param    [in] size
+    //!           Total number of bytes the heap should be able to hold
+    //! \return   MOS_STATUS
+    //!
+    MOS_STATUS Reserve(uint32_t size);
+
+    //!
+    //! \brief    Record the size of an allocated media state
+    //! \details  When it is the largest so far, the heap is reserved for
+    //!           maxTasks media states of that size, so that the tasks in
+    //!           flight fit without one extend per task. Thread safe.
+    //! \param    [in] mediaState
+    //!           Media state after CmMediaState::Allocate()
+    //!
+    void UpdateMediaStateSize(CmMediaState *mediaState);
+
     CmMediaState* CreateMediaState();
     void DestroyMediaState(CmMediaState *mediaState);
     
@@ -47,5 +73,7 @@ protected:
 
     const uint32_t m_initSize = 0x80000;
     const uint32_t m_stepSize = 0x80000;
+    uint32_t m_maxMediaStateSize = 0;  // largest media state allocated so far
+    CMRT_UMD::CSync m_sizeSection;     // guards m_maxMediaStateSize across task flushes
     
 };
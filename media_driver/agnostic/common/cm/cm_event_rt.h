@@ -125,6 +125,14 @@ public:
 
     CM_STATUS GetStatusWithoutFlush();
 
+    //! \brief    Takes a reference on the OS sync object of an unfinished task.
+    //! \return   The referenced OS data, nullptr if the task is already finished.
+    void *ReferenceOsData();
+
+    //! \brief    Blocks on OS data returned by ReferenceOsData until GPU is done
+    //!           with it or timeout, then drops the reference.
+    static int32_t WaitForOsData(void *osData, uint32_t timeOutMs);
+
 #if CM_LOG_ON
     std::string Log(const char *callerFuncName);
 
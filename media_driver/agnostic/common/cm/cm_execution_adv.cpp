@@ -351,6 +351,7 @@ int CmExecutionAdv::SubmitTask(CMRT_UMD::CmQueueRT *queue,
     CmMediaState *cmMediaState = cmdsh->CreateMediaState();
     CM_CHK_NULL_RETURN_CMERROR(cmMediaState);
     cmMediaState->Allocate(kernels, kernelCount, queue->GetFastTrackerIndex(), tracker);
+    cmdsh->UpdateMediaStateSize(cmMediaState);
 
     // generate curbe and load media id
     for (uint32_t i = 0; i < kernelCount; i++)
@@ -730,6 +731,7 @@ int CmExecutionAdv::SubmitGpgpuTask(CMRT_UMD::CmQueueRT *queue,
     CmMediaState *cmMediaState = cmdsh->CreateMediaState();
     CM_CHK_NULL_RETURN_CMERROR(cmMediaState);
     cmMediaState->Allocate(kernels, kernelCount, 0, tracker);
+    cmdsh->UpdateMediaStateSize(cmMediaState);
 
     // generate curbe and load media id
     for (uint32_t i = 0; i < kernelCount; i++)
@@ -21,140 +21,130 @@
 */
 //!
 //! \file      cm_hal_hashtable.cpp  
-//! \brief         This modules implements a simple coalesced hash table used 
-//!                for kernel search in dynamic state heap based CmHal. 
+//! \brief         This modules implements a simple open addressing hash table
+//!                used for kernel search in dynamic state heap based CmHal. 
 //!                It exposes hash table initialization, destruction,     
 //!                registration, unregistration and search functions used to 
-//!                speed up kernel search. The hash table size is currently 
-//!                limited to 65535 (MAX uint16_t-1), and 2 keys may be used
+//!                speed up kernel search. 2 keys may be used,
 //!                iKUID (Kernel Unique Identifier - int32_t) and 
-//!                CacheID (Arbitrary Kernel Cache ID - int32_t).
+//!                CacheID (Arbitrary Kernel Cache ID - int32_t), packed in a
+//!                64-bit slot key. Slots are probed linearly from the hash of
+//!                iKUID, so entries sharing an iKUID stay in one probe run.
 //!                Given the dynamic nature of the ISH and kernel allocation,
-//!                the hash table is allowed to grow dynamically as needed.  
+//!                the hash table is allowed to grow dynamically as needed, 
+//!                up to CM_HAL_HASHTABLE_MAX entries.
 //!
 
 #include "cm_hal_hashtable.h"
 
-MOS_STATUS CmHashTable::Init()
+static inline uint64_t CmHashTableKey(int32_t UniqID, int32_t CacheID)
 {
-    MOS_STATUS               eStatus = MOS_STATUS_SUCCESS;
-    PCM_HAL_HASH_TABLE_ENTRY pHashEntry = nullptr;
-
-    pHashEntry = (PCM_HAL_HASH_TABLE_ENTRY)MOS_AllocMemory(CM_HAL_HASHTABLE_INITIAL * sizeof(CM_HAL_HASH_TABLE_ENTRY));
-    if (!pHashEntry)
-    {
-        eStatus = MOS_STATUS_NO_SPACE;
-        return eStatus;
-    }
-
+    return ((uint64_t)(uint32_t)UniqID << 32) | (uint32_t)CacheID;
+}
 
-    m_hashTable.pHashEntries = pHashEntry;
-    m_hashTable.wSize = CM_HAL_HASHTABLE_INITIAL;
-    m_hashTable.wFree = 1; // First free element = 1 (0 is reserved for nullptr; 0xffff could be used instead, but 0 makes it cleaner/easier to read/understand)
-    for (int i = 0; i < CM_HAL_HASHTABLE_INITIAL - 1; i++, pHashEntry++)
-    {
-        pHashEntry->UniqID = -1;
-        pHashEntry->CacheID = -1;
-        pHashEntry->wNext = i + 1;
-        pHashEntry->pData = nullptr;
-    }
-    pHashEntry--;
-    pHashEntry->wNext = 0;
+MOS_STATUS CmHashTable::Init()
+{
+    MOS_ZeroMemory(&m_hashTable, sizeof(m_hashTable));
 
-    return eStatus;
+    // Keep load factor at or below 1/2 so that probe runs stay short
+    return Resize(CM_HAL_HASHTABLE_INITIAL * 2);
 }
 
 void CmHashTable::Free()
 {
-    if (m_hashTable.pHashEntries) MOS_FreeMemory(m_hashTable.pHashEntries);
+    // Keys and data share a single allocation
+    if (m_hashTable.pKeys) MOS_FreeMemory(m_hashTable.pKeys);
+    MOS_ZeroMemory(&m_hashTable, sizeof(m_hashTable));
 }
 
 uint16_t CmHashTable::SimpleHash(int32_t value)
 {
-    uint16_t wHash = ((value >> 16) ^ value) & 0xFFFF;
-    wHash = ((wHash >> 8) ^ wHash) & 0xFF;
-    return wHash;
+    // Multiplicative hash, kernel ids are often sequential
+    uint32_t dwHash = (uint32_t)value * 0x9E3779B1;
+    return (uint16_t)((dwHash >> 16) ^ dwHash);
 }
 
-MOS_STATUS CmHashTable::Extend()
+MOS_STATUS CmHashTable::Resize(uint16_t wSize)
 {
-    uint16_t                    wEntry;
-    PCM_HAL_HASH_TABLE_ENTRY    pEntry;
-    int32_t                     iPrevSize, iNewSize;
-    MOS_STATUS                  hr = MOS_STATUS_UNKNOWN;
+    uint64_t    *pKeys;
+    void        **pData;
+    uint16_t    wMask = wSize - 1;
 
-    if (m_hashTable.wSize >= CM_HAL_HASHTABLE_MAX)
+    pKeys = (uint64_t *)MOS_AllocMemory(wSize * (sizeof(uint64_t) + sizeof(void *)));
+    if (!pKeys)
     {
-        goto finish;
+        return MOS_STATUS_NO_SPACE;
     }
+    pData = (void **)(pKeys + wSize);
 
-    iPrevSize = m_hashTable.wSize * sizeof(CM_HAL_HASH_TABLE_ENTRY);
-    iNewSize = iPrevSize + CM_HAL_HASHTABLE_INCREMENT * sizeof(CM_HAL_HASH_TABLE_ENTRY);
-    pEntry = (PCM_HAL_HASH_TABLE_ENTRY)MOS_AllocMemory(iNewSize);
-    if (!pEntry)
+    for (uint16_t i = 0; i < wSize; i++)
     {
-        hr = MOS_STATUS_NO_SPACE;
-        goto finish;
+        pKeys[i] = CM_HAL_HASHTABLE_EMPTY_KEY;
+        pData[i] = nullptr;
     }
 
-    // Transfer the hash entries to larger table, free old (smaller) table
-    MOS_SecureMemcpy(pEntry, iPrevSize, m_hashTable.pHashEntries, iPrevSize);
-    MOS_FreeMemory(m_hashTable.pHashEntries);
-    m_hashTable.pHashEntries = pEntry;
-
-    // Initialize entries
-    wEntry = m_hashTable.wSize + 1;
-    pEntry += m_hashTable.wSize;
-    for (int i = CM_HAL_HASHTABLE_INCREMENT; i > 0; i--, wEntry++, pEntry++)
+    // Rehash existing entries into the new slots
+    for (uint16_t i = 0; i < m_hashTable.wSize; i++)
     {
-        pEntry->UniqID = -1;
-        pEntry->CacheID = -1;
-        pEntry->wNext = wEntry;
-        pEntry->pData = nullptr;
-    }
-    pEntry--;
+        uint64_t qwKey = m_hashTable.pKeys[i];
+        if (qwKey == CM_HAL_HASHTABLE_EMPTY_KEY)
+        {
+            continue;
+        }
 
-    // Update free list - new array is appended at the beginning of the free list, avoiding the need to traverse it.
-    pEntry->wNext = m_hashTable.wFree;               // Last entry of newly created entries points to first pre-existing free entry
-    m_hashTable.wFree = m_hashTable.wSize;               // Free list points to newly created array, which points to pre-existing array
-    m_hashTable.wSize += CM_HAL_HASHTABLE_INCREMENT; // Update size of the hash table
+        uint16_t wSlot = SimpleHash((int32_t)(qwKey >> 32)) & wMask;
+        while (pKeys[wSlot] != CM_HAL_HASHTABLE_EMPTY_KEY)
+        {
+            wSlot = (wSlot + 1) & wMask;
+        }
+        pKeys[wSlot] = qwKey;
+        pData[wSlot] = m_hashTable.pData[i];
+    }
 
-    hr = MOS_STATUS_SUCCESS;
+    if (m_hashTable.pKeys) MOS_FreeMemory(m_hashTable.pKeys);
+    m_hashTable.pKeys = pKeys;
+    m_hashTable.pData = pData;
+    m_hashTable.wSize = wSize;
 
-finish:
-    return hr;
+    return MOS_STATUS_SUCCESS;
 }
+
 MOS_STATUS CmHashTable::Register(int32_t UniqID, int32_t CacheID, void  *pData)
 {
-    uint16_t                    wHash;
-    uint16_t                    wEntry;
-    PCM_HAL_HASH_TABLE_ENTRY    pEntry;
-    MOS_STATUS                  hr = MOS_STATUS_UNKNOWN;
-
-    wHash = SimpleHash(UniqID);
+    uint64_t    qwKey = CmHashTableKey(UniqID, CacheID);
+    uint16_t    wMask;
+    uint16_t    wSlot;
+    MOS_STATUS  hr = MOS_STATUS_UNKNOWN;
 
-    // Get new entry
-    wEntry = m_hashTable.wFree;
+    if (qwKey == CM_HAL_HASHTABLE_EMPTY_KEY || !m_hashTable.pKeys)
+    {
+        hr = MOS_STATUS_INVALID_PARAMETER;
+        goto finish;
+    }
 
-    // Extend hash table, get new free entry
-    if (wEntry == 0)
+    // Grow hash table before the load factor goes above 1/2
+    if ((m_hashTable.wCount + 1) * 2 > m_hashTable.wSize)
     {
-        hr = Extend();
+        if (m_hashTable.wCount >= CM_HAL_HASHTABLE_MAX)
+        {
+            goto finish;
+        }
+        hr = Resize(m_hashTable.wSize * 2);
         if (hr != MOS_STATUS_SUCCESS)
             goto finish;
-        wEntry = m_hashTable.wFree;
     }
 
-    // Remove entry from free list
-    pEntry = m_hashTable.pHashEntries + wEntry;
-    m_hashTable.wFree = pEntry->wNext;
+    // Take first free slot of the probe run
+    wMask = m_hashTable.wSize - 1;
+    wSlot = SimpleHash(UniqID) & wMask;
+    while (m_hashTable.pKeys[wSlot] != CM_HAL_HASHTABLE_EMPTY_KEY)
+    {
+        wSlot = (wSlot + 1) & wMask;
+    }
 
-    // Link hash entry
-    pEntry->UniqID = UniqID;                   // save unique id
-    pEntry->CacheID = CacheID;                  // save unique id
-    pEntry->pData = pData;                    // save pointer to data
-    pEntry->wNext = m_hashTable.wHead[wHash]; // points to next entry in same bucket
-    m_hashTable.wHead[wHash] = wEntry;          // move entry to head of the bucket
+    m_hashTable.pKeys[wSlot] = qwKey;
+    m_hashTable.pData[wSlot] = pData;
+    m_hashTable.wCount++;
 
     hr = MOS_STATUS_SUCCESS;
 
@@ -164,97 +154,87 @@ finish:
 
 void* CmHashTable::Search(int32_t UniqID, int32_t CacheID, uint16_t &wSearchIndex)
 {
-    PCM_HAL_HASH_TABLE_ENTRY    pEntry = nullptr;
-    void                        *pData = nullptr;
-    bool                        bFound;
+    uint64_t    qwKey    = CmHashTableKey(UniqID, CacheID);
+    uint64_t    qwKeyMask;
+    uint16_t    wMask;
+    uint16_t    wSlot;
 
-    // Get first entry, or continue previous search
-    if (wSearchIndex == 0 ||
-        wSearchIndex >= m_hashTable.wSize)
+    if (!m_hashTable.pKeys)
     {
-        uint16_t wHash = SimpleHash(UniqID);
-        wSearchIndex = m_hashTable.wHead[wHash];
+        wSearchIndex = 0;
+        return nullptr;
     }
 
-    if (CacheID >= 0)
+    // Search for UniqID/CacheID, or for UniqID only (don't care about CacheID)
+    qwKeyMask = (CacheID >= 0) ? CM_HAL_HASHTABLE_EMPTY_KEY : 0xFFFFFFFF00000000ULL;
+
+    // Get first slot, or continue previous search (search index is slot + 1)
+    wMask = m_hashTable.wSize - 1;
+    if (wSearchIndex == 0 ||
+        wSearchIndex > m_hashTable.wSize)
     {
-        // Search for UniqID/CacheID
-        for (bFound = false; (wSearchIndex > 0) && (!bFound); wSearchIndex = pEntry->wNext)
-        {
-            pEntry = m_hashTable.pHashEntries + wSearchIndex;
-            bFound = (pEntry->UniqID == UniqID) && (pEntry->CacheID == CacheID);
-        }
+        wSlot = SimpleHash(UniqID) & wMask;
     }
     else
     {
-        // Search for UniqID (don't care about CacheID)
-        for (bFound = false; (wSearchIndex > 0) && (!bFound); wSearchIndex = pEntry->wNext)
-        {
-            pEntry = m_hashTable.pHashEntries + wSearchIndex;
-            bFound = (pEntry->UniqID == UniqID);
-        }
+        wSlot = wSearchIndex - 1;
     }
 
-    // Retrieve user data
-    if (bFound)
+    // Load factor is at most 1/2, so the probe run always ends on an empty slot
+    for (; m_hashTable.pKeys[wSlot] != CM_HAL_HASHTABLE_EMPTY_KEY; wSlot = (wSlot + 1) & wMask)
     {
-        pData = pEntry->pData;
+        if (((m_hashTable.pKeys[wSlot] ^ qwKey) & qwKeyMask) == 0)
+        {
+            wSearchIndex = ((wSlot + 1) & wMask) + 1;
+            return m_hashTable.pData[wSlot];
+        }
     }
 
-    return pData;
+    wSearchIndex = 0;
+    return nullptr;
 }
 
 void* CmHashTable::Unregister(int32_t UniqID, int32_t CacheID)
 {
-    uint16_t                    wHash;
-    uint16_t                    wEntry = 0;
-    uint16_t                    wSearchIndex;
-    PCM_HAL_HASH_TABLE_ENTRY    pEntry, pPrevEntry;
-    void                        *pData = nullptr;
-
-
-    wHash = SimpleHash(UniqID);
+    uint16_t    wSearchIndex = 0;
+    uint16_t    wMask;
+    uint16_t    wSlot, wNext;
+    void        *pData;
 
     // Search for UniqID/CacheID (hashing should significantly speedup this search)
-    pEntry = pPrevEntry = nullptr;
-    wSearchIndex = m_hashTable.wHead[wHash];
-    bool bFound;
-
-    if (CacheID >= 0)
+    pData = Search(UniqID, CacheID, wSearchIndex);
+    if (wSearchIndex == 0)
     {
-        // Search for UniqID/CacheID
-        for (bFound = false; (wSearchIndex > 0) && (!bFound); wSearchIndex = pEntry->wNext)
-        {
-            wEntry = wSearchIndex;
-            pEntry = m_hashTable.pHashEntries + wSearchIndex;
-            bFound = (pEntry->UniqID == UniqID) && (pEntry->CacheID == CacheID);
-        }
+        return nullptr;
     }
-    else
+
+    wMask = m_hashTable.wSize - 1;
+    wSlot = (wSearchIndex - 2) & wMask;
+
+    // Shift following entries of the probe run back into the hole, so no
+    // tombstones are needed and searches still stop on the first empty slot
+    for (wNext = (wSlot + 1) & wMask;
+         m_hashTable.pKeys[wNext] != CM_HAL_HASHTABLE_EMPTY_KEY;
+         wNext = (wNext + 1) & wMask)
     {
-        // Search for UniqID (don't care about CacheID)
-        for (bFound = false; (wSearchIndex > 0) && (!bFound); wSearchIndex = pEntry->wNext)
+        uint16_t wHome = SimpleHash((int32_t)(m_hashTable.pKeys[wNext] >> 32)) & wMask;
+
+        // Entry stays if its home slot lies cyclically within (wSlot, wNext]
+        bool bStays = (wSlot <= wNext) ? (wSlot < wHome && wHome <= wNext)
+                                       : (wSlot < wHome || wHome <= wNext);
+        if (bStays)
         {
-            wEntry = wSearchIndex;
-            pEntry = m_hashTable.pHashEntries + wSearchIndex;
-            bFound = (pEntry->UniqID == UniqID);
+            continue;
         }
-    }
 
-    // Entry found
-    if (wEntry > 0)
-    {
-        // Detach from hash list
-        if (pPrevEntry)
-            pPrevEntry->wNext = pEntry->wNext;
-        else
-            m_hashTable.wHead[wHash] = pEntry->wNext;
-
-        // Move hash entry to free list
-        pEntry->wNext = m_hashTable.wFree;
-        m_hashTable.wFree = wEntry;
-        pData = pEntry->pData;
+        m_hashTable.pKeys[wSlot] = m_hashTable.pKeys[wNext];
+        m_hashTable.pData[wSlot] = m_hashTable.pData[wNext];
+        wSlot = wNext;
     }
 
+    m_hashTable.pKeys[wSlot] = CM_HAL_HASHTABLE_EMPTY_KEY;
+    m_hashTable.pData[wSlot] = nullptr;
+    m_hashTable.wCount--;
+
     return pData;
 }
@@ -29,27 +29,17 @@
 #include "mos_os.h"
 #include "stdint.h"
 
-#define CM_HAL_HASHTABLE_INITIAL   128
-#define CM_HAL_HASHTABLE_INCREMENT 64
-#define CM_HAL_HASHTABLE_MAX       2048
+#define CM_HAL_HASHTABLE_INITIAL   128                  // Initial number of entries
+#define CM_HAL_HASHTABLE_MAX       2048                 // Max number of entries
+#define CM_HAL_HASHTABLE_EMPTY_KEY 0xFFFFFFFFFFFFFFFFULL // Key of an empty slot
 
-typedef struct _CM_HAL_HASH_TABLE_ENTRY
+typedef struct _CM_HAL_OPEN_HASH_TABLE
 {
-    int32_t UniqID;
-    int32_t CacheID;
-    uint16_t wNext;
-    void    *pData;
-} CM_HAL_HASH_TABLE_ENTRY, *PCM_HAL_HASH_TABLE_ENTRY;
-
-typedef struct _CM_HAL_COALESCED_HASH_TABLE
-{
-    uint16_t                    wHead[256];         // Head of bucket list, 0 if empty
-    uint16_t                    wFree;              // Head of the free hash table list, 0 if not present
-    uint16_t                    wSize;              // Size of the hash table currently allocated
-    CM_HAL_HASH_TABLE_ENTRY *pHashEntries;       // Dynamically expanding coalescing hash table
-} CM_HAL_COALESCED_HASH_TABLE, *PCM_HAL_COALESCED_HASH_TABLE;
-
-typedef struct _CM_HAL_COALESCED_HASH_TABLE *PCM_HAL_COALESCED_HASH_TABLE;
+    uint64_t    *pKeys;             // Slot keys, UniqID in high dword and CacheID in low dword
+    void        **pData;            // Slot data, stored apart from keys to keep probing on a dense array
+    uint16_t    wSize;              // Number of slots, power of 2, kept at least twice the entry count
+    uint16_t    wCount;             // Number of registered entries
+} CM_HAL_OPEN_HASH_TABLE, *PCM_HAL_OPEN_HASH_TABLE;
 
 class CmHashTable
 {
@@ -62,8 +52,8 @@ public:
 
 private:
     uint16_t   SimpleHash(int32_t value);
-    MOS_STATUS Extend();
-    CM_HAL_COALESCED_HASH_TABLE m_hashTable;
+    MOS_STATUS Resize(uint16_t wSize);
+    CM_HAL_OPEN_HASH_TABLE m_hashTable;
 };
 
 #endif // __CM_HAL_HASHTABLE_H__
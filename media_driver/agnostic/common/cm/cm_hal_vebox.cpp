@@ -91,8 +91,13 @@ MOS_STATUS HalCm_ExecuteVeboxTask(
     // (clear allocations, get GSH allocation index + any additional housekeeping)
     osInterface->pfnResetOsStates(osInterface);
 
-    // reset HW
-    CM_CHK_MOSSTATUS_GOTOFINISH(state->renderHal->pfnReset(state->renderHal));
+    // no full render HW reset here: vebox commands don't reference the render GSH/ISH,
+    // registering them would only add resources, and cross-context syncs, to the submission.
+    // Only clear the power options left by the last render task.
+    renderHal->bRequestSingleSlice   = false;
+    renderHal->PowerOption.nSlice    = 0;
+    renderHal->PowerOption.nEU       = 0;
+    renderHal->PowerOption.nSubSlice = 0;
 
     // get the Task Id
     CM_CHK_MOSSTATUS_GOTOFINISH(HalCm_GetNewTaskId(state, &taskId));
@@ -47,6 +47,8 @@ public:
 
     inline MOS_RESOURCE* GetHeapResource() {return m_memoryBlock.GetResource(); }
 
+    inline uint32_t GetSize() {return m_memoryBlock.GetSize(); }
+
     inline uint32_t GetCurbeOffset() {return m_curbeOffsetInternal + m_memoryBlock.GetOffset();}
 
     inline uint32_t GetCurbeOffset(uint32_t kernelIndex) {return m_curbeOffsets[kernelIndex] + m_curbeOffsetInternal + m_memoryBlock.GetOffset();}
@@ -40,6 +40,7 @@ enum CPU_INSTRUCTION_LEVEL
     CPU_INSTRUCTION_LEVEL_SSE3,
     CPU_INSTRUCTION_LEVEL_SSE4,
     CPU_INSTRUCTION_LEVEL_SSE4_1,
+    CPU_INSTRUCTION_LEVEL_AVX2,
     NUM_CPU_INSTRUCTION_LEVELS
 };
 
@@ -235,7 +236,7 @@ inline CPU_INSTRUCTION_LEVEL GetCpuInstructionLevel( void )
     CPU_INSTRUCTION_LEVEL cpuInstructionLevel = CPU_INSTRUCTION_LEVEL_UNKNOWN;
     if( (cpuInfo[2] & BIT(19)) && TestSSE4_1() )
     {
-        cpuInstructionLevel = CPU_INSTRUCTION_LEVEL_SSE4_1;
+        cpuInstructionLevel = TestAVX2() ? CPU_INSTRUCTION_LEVEL_AVX2 : CPU_INSTRUCTION_LEVEL_SSE4_1;
     }
     else if( cpuInfo[2] & BIT(1) )
     {
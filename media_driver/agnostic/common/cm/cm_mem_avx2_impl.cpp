@@ -0,0 +1,144 @@
+/*
+* Copyright (c) 2024, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file      cm_mem_avx2_impl.cpp
+//! \brief     Contains CM memory function implementations
+//!
+
+#include "cm_mem.h"
+#include "cm_mem_avx2_impl.h"
+
+#include <immintrin.h>
+
+#define CM_AVX2_REG_BYTES   32
+#define CM_AVX2_LOOP_BYTES  (4 * CM_AVX2_REG_BYTES)
+
+/*****************************************************************************\
+Function:
+    FastMemCopy_AVX2_stream
+
+Description:
+    Copies whole 32-byte blocks with streaming (non-temporal) stores, so the
+    destination does not pollute the cache. Returns the number of bytes copied.
+
+Input:
+    dst - 32-byte aligned pointer to destination buffer
+    src - pointer to source buffer
+    bytes - number of bytes available for copy
+\*****************************************************************************/
+CM_AVX2_TARGET static size_t FastMemCopy_AVX2_stream( uint8_t *dst, const uint8_t *src, const size_t bytes )
+{
+    CM_ASSERT( IsAligned( dst, CM_AVX2_REG_BYTES ) );
+
+    const bool isSrcAligned = IsAligned( (void *)src, CM_AVX2_REG_BYTES );
+    __m256i *mmDst = (__m256i *)dst;
+    const __m256i *mmSrc = (const __m256i *)src;
+    size_t count = bytes;
+
+    if( isSrcAligned )
+    {
+        for( ; count >= CM_AVX2_LOOP_BYTES; count -= CM_AVX2_LOOP_BYTES )
+        {
+            __m256i ymm0 = _mm256_load_si256( mmSrc );
+            __m256i ymm1 = _mm256_load_si256( mmSrc + 1 );
+            __m256i ymm2 = _mm256_load_si256( mmSrc + 2 );
+            __m256i ymm3 = _mm256_load_si256( mmSrc + 3 );
+            mmSrc += 4;
+
+            _mm256_stream_si256( mmDst, ymm0 );
+            _mm256_stream_si256( mmDst + 1, ymm1 );
+            _mm256_stream_si256( mmDst + 2, ymm2 );
+            _mm256_stream_si256( mmDst + 3, ymm3 );
+            mmDst += 4;
+        }
+    }
+    else
+    {
+        for( ; count >= CM_AVX2_LOOP_BYTES; count -= CM_AVX2_LOOP_BYTES )
+        {
+            __m256i ymm0 = _mm256_loadu_si256( mmSrc );
+            __m256i ymm1 = _mm256_loadu_si256( mmSrc + 1 );
+            __m256i ymm2 = _mm256_loadu_si256( mmSrc + 2 );
+            __m256i ymm3 = _mm256_loadu_si256( mmSrc + 3 );
+            mmSrc += 4;
+
+            _mm256_stream_si256( mmDst, ymm0 );
+            _mm256_stream_si256( mmDst + 1, ymm1 );
+            _mm256_stream_si256( mmDst + 2, ymm2 );
+            _mm256_stream_si256( mmDst + 3, ymm3 );
+            mmDst += 4;
+        }
+    }
+
+    for( ; count >= CM_AVX2_REG_BYTES; count -= CM_AVX2_REG_BYTES )
+    {
+        _mm256_stream_si256( mmDst++, _mm256_loadu_si256( mmSrc++ ) );
+    }
+
+    // Make streaming stores globally visible before the buffer is handed to GPU
+    _mm_sfence();
+
+    return bytes - count;
+}
+
+void CmFastMemCopyWC_AVX2( void* dst, const void* src, const size_t bytes )
+{
+    // Cache pointers to memory
+    uint8_t *cacheDst = (uint8_t*)dst;
+    uint8_t *cacheSrc = (uint8_t*)src;
+
+    size_t count = bytes;
+
+    if( count >= CM_CPU_FASTCOPY_THRESHOLD )
+    {
+        const size_t alignBytes = GetAlignmentOffset( cacheDst, CM_AVX2_REG_BYTES );
+
+        // The destination pointer should be 256-bit aligned
+        if( alignBytes )
+        {
+            MOS_SecureMemcpy( cacheDst, alignBytes, cacheSrc, alignBytes );
+
+            cacheDst += alignBytes;
+            cacheSrc += alignBytes;
+            count -= alignBytes;
+        }
+
+        const size_t copied = FastMemCopy_AVX2_stream( cacheDst, cacheSrc, count );
+
+        cacheDst += copied;
+        cacheSrc += copied;
+        count -= copied;
+    }
+
+    // Copy remaining uint8_t(s)
+    if( count )
+    {
+        MOS_SecureMemcpy( cacheDst, count, cacheSrc, count );
+    }
+}
+
+void CmFastMemCopy_AVX2( void* dst, const void* src, const size_t bytes )
+{
+    // Streaming stores pay off for both cached and WC destinations once the
+    // copy is above the fast copy threshold
+    CmFastMemCopyWC_AVX2( dst, src, bytes );
+}
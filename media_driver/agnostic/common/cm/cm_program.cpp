@@ -170,6 +170,31 @@ CmProgramRT::~CmProgramRT( void )
     CmSafeDelete(m_isaFile);
 }
 
+//*-----------------------------------------------------------------------------
+//| Purpose:    Accumulate bytes into a 64-bit FNV-1a hash used as jit cache key
+//| Returns:    Updated hash value.
+//*-----------------------------------------------------------------------------
+static uint64_t JitCacheHashBytes(uint64_t hash, const void *data, size_t size)
+{
+    const uint8_t *bytes = (const uint8_t *)data;
+    for (size_t i = 0; i < size; i++)
+    {
+        hash ^= bytes[i];
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+static uint64_t JitCacheHashString(uint64_t hash, const char *str)
+{
+    if (str == nullptr)
+    {
+        return hash;
+    }
+    // include the terminator so that adjacent strings can not alias
+    return JitCacheHashBytes(hash, str, strlen(str) + 1);
+}
+
 //*-----------------------------------------------------------------------------
 //| Purpose:    Initialize Cm Program
 //| Returns:    Result of the operation.
@@ -190,6 +215,10 @@ int32_t CmProgramRT::Initialize( void* cisaCode, const uint32_t cisaCodeSize, co
 
     char* flagStepInfo = nullptr;
 
+    bool     useJitCache  = false;
+    uint64_t jitCacheHash = 0;
+    std::shared_ptr<const std::vector<uint8_t>> jitCacheIsa;
+
     if( options )
     {
         size_t length = strnlen( options, CM_MAX_OPTION_SIZE_IN_BYTE );
@@ -383,6 +412,22 @@ int32_t CmProgramRT::Initialize( void* cisaCode, const uint32_t cisaCodeSize, co
         CM_NORMALMESSAGE("Jitter Compiling...");
 #endif
 
+    // Jitter output only depends on the ISA, the target and the jit flags, so it
+    // is shared process wide by programs loading the same ISA. Debugger and
+    // GTPin builds need per-load jitter output and bypass the cache.
+    useJitCache = m_isJitterEnabled && !m_isHwDebugEnabled && !m_device->CheckGTPinEnabled();
+    if (useJitCache)
+    {
+        jitCacheHash = JitCacheHashBytes(0xcbf29ce484222325ULL, cisaCode, cisaCodeSize);
+        jitCacheHash = JitCacheHashString(jitCacheHash, platform);
+        jitCacheHash = JitCacheHashBytes(jitCacheHash, &m_cisaMajorVersion, sizeof(m_cisaMajorVersion));
+        jitCacheHash = JitCacheHashBytes(jitCacheHash, &m_cisaMinorVersion, sizeof(m_cisaMinorVersion));
+        for (int j = 0; j < numJitFlags; j++)
+        {
+            jitCacheHash = JitCacheHashString(jitCacheHash, jitFlags[j]);
+        }
+    }
+
     for (uint32_t i = 0; i < m_kernelCount; i++)
     {
         CM_KERNEL_INFO* kernInfo = new (std::nothrow) CM_KERNEL_INFO;
@@ -599,7 +644,20 @@ int32_t CmProgramRT::Initialize( void* cisaCode, const uint32_t cisaCodeSize, co
                 notifiers->NotifyCallingJitter(&extra_info);
             }
 
-            if (m_fJITCompile_v2)
+            bool jitCacheable = useJitCache && (extra_info == nullptr);
+            uint64_t jitCacheKey = 0;
+            if (jitCacheable)
+            {
+                jitCacheKey = JitCacheHashString(jitCacheHash, kernInfo->kernelName);
+                kernInfo->jitBinaryCached = m_device->FindJitCacheEntry(jitCacheKey, kernInfo->kernelName,
+                    cisaCode, cisaCodeSize, jitBinary, jitBinarySize, jitProfInfo);
+            }
+
+            if (kernInfo->jitBinaryCached)
+            {
+                result = CM_SUCCESS;
+            }
+            else if (m_fJITCompile_v2)
             {
                 result = m_fJITCompile_v2( kernInfo->kernelName, (uint8_t*)cisaCode, cisaCodeSize,
                                     jitBinary, jitBinarySize, platform, m_cisaMajorVersion, m_cisaMinorVersion, numJitFlags, jitFlags, errorMsg, jitProfInfo, extra_info );
@@ -623,6 +681,10 @@ int32_t CmProgramRT::Initialize( void* cisaCode, const uint32_t cisaCodeSize, co
             // if spill code exists and scrach space disabled, return error to user
             if( jitProfInfo->isSpill &&  m_device->IsScratchSpaceDisabled())
             {
+                if (kernInfo->jitBinaryCached)
+                {
+                    free(jitBinary);
+                }
                 CmSafeDelete(kernInfo);
                 free(errorMsg);
                 return CM_INVALID_KERNEL_SPILL_CODE;
@@ -630,6 +692,17 @@ int32_t CmProgramRT::Initialize( void* cisaCode, const uint32_t cisaCodeSize, co
 
             free(errorMsg);
 
+            if (jitCacheable && !kernInfo->jitBinaryCached)
+            {
+                // one copy of the ISA is shared by the entries of all kernels in the program
+                if (jitCacheIsa == nullptr)
+                {
+                    jitCacheIsa = std::make_shared<const std::vector<uint8_t>>(
+                        (const uint8_t *)cisaCode, (const uint8_t *)cisaCode + cisaCodeSize);
+                }
+                m_device->AddJitCacheEntry(jitCacheKey, kernInfo->kernelName, jitCacheIsa, jitBinary, jitBinarySize, jitProfInfo);
+            }
+
             kernInfo->jitBinaryCode = jitBinary;
             kernInfo->jitBinarySize = jitBinarySize;
             kernInfo->jitInfo = jitProfInfo;
@@ -860,7 +933,9 @@ uint32_t CmProgramRT::ReleaseKernelInfo(uint32_t index)
             {
                 if(m_isJitterEnabled)
                 {
-                    if(kernelInfo->jitBinaryCode)
+                    if(kernelInfo->jitBinaryCode && kernelInfo->jitBinaryCached)
+                        free(kernelInfo->jitBinaryCode);
+                    else if(kernelInfo->jitBinaryCode)
                         m_fFreeBlock(kernelInfo->jitBinaryCode);
                     if(kernelInfo->jitInfo)
                     {
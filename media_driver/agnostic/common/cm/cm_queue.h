@@ -455,6 +455,34 @@ public:
     CM_RT_API virtual int32_t EnqueueWithGroupFast(CmTask *task,
                                   CmEvent *&event,
                                   const CmThreadGroupSpace *threadGroupSpace = nullptr) = 0;
+
+    //!
+    //! \brief    Enqueues a list of GPU to GPU surface copies.
+    //! \details  Copies are submitted in as few tasks as the max kernel count per
+    //!           task allows, instead of one task per copy. Each pair of surfaces
+    //!           has the same restrictions as EnqueueCopyGPUToGPU. A copy which
+    //!           reads or writes a surface written by an earlier one, or writes a
+    //!           surface read by it, starts after that copy finished.
+    //! \param    [in] outputSurfaces
+    //!           array of surfaces as copy destination
+    //! \param    [in] inputSurfaces
+    //!           array of surfaces as copy source
+    //! \param    [in] copyCount
+    //!           number of copies, size of both arrays
+    //! \param    [in] option
+    //!           same as EnqueueCopyGPUToGPU.
+    //! \param    [in,out] event
+    //!           reference to pointer of event signaled when all the copies are done.
+    //!           If it is set as CM_NO_EVENT, its value returned by runtime is NULL.
+    //! \retval   CM_SUCCESS if all the copies are successfully enqueued
+    //! \retval   CM_INVALID_ARG_VALUE if surface arrays are NULL or copy count is 0
+    //! \retval   error of EnqueueCopyGPUToGPU if one of the copies is not valid
+    //!
+    CM_RT_API virtual int32_t EnqueueCopyGPUToGPUBatch(CmSurface2D **outputSurfaces,
+                                                       CmSurface2D **inputSurfaces,
+                                                       uint32_t copyCount,
+                                                       uint32_t option,
+                                                       CmEvent *&event) = 0;
 };
 };//namespace
 
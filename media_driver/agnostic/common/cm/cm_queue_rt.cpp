@@ -1976,6 +1976,212 @@ CM_RT_API int32_t CmQueueRT::EnqueueCopyGPUToGPU( CmSurface2D* outputSurface, Cm
         return CM_NOT_IMPLEMENTED;
     }
 
+    int32_t             hr = CM_SUCCESS;
+    CmKernel            *kernel = nullptr;
+    CmThreadSpace       *threadSpace = nullptr;
+    CmTask              *task = nullptr;
+    CM_GPUCOPY_KERNEL   *gpuCopyKernelParam = nullptr;
+
+    hr = PrepareGPUToGPUCopy(outputSurface, inputSurface, gpuCopyKernelParam, threadSpace);
+    if (hr != CM_SUCCESS)
+    {
+        return hr;
+    }
+    kernel = gpuCopyKernelParam->kernel;
+
+    CM_CHK_CMSTATUS_GOTOFINISH(m_device->CreateTask(task));
+    CM_CHK_NULL_GOTOFINISH_CMERROR(task);
+    CM_CHK_CMSTATUS_GOTOFINISH(task->AddKernel(kernel));
+
+    if (option & CM_FASTCOPY_OPTION_DISABLE_TURBO_BOOST)
+    {
+        // disable turbo
+        CM_TASK_CONFIG taskConfig;
+        CmSafeMemSet(&taskConfig, 0, sizeof(CM_TASK_CONFIG));
+        taskConfig.turboBoostFlag = CM_TURBO_BOOST_DISABLE;
+        task->SetProperty(taskConfig);
+    }
+
+    CM_CHK_CMSTATUS_GOTOFINISH(EnqueueFast(task, event, threadSpace));
+    if ((option & CM_FASTCOPY_OPTION_BLOCKING) && (event))
+    {
+        CM_CHK_CMSTATUS_GOTOFINISH(event->WaitForTaskFinished());
+    }
+
+finish:
+
+    if (kernel && gpuCopyKernelParam)        GPUCOPY_KERNEL_UNLOCK(gpuCopyKernelParam);
+    if (threadSpace)                                m_device->DestroyThreadSpace(threadSpace);
+    if (task)                              m_device->DestroyTask(task);
+
+    return hr;
+}
+
+//*-----------------------------------------------------------------------------
+//! Enqueue a list of GPU to GPU surface copies. Copies are packed into tasks of
+//! up to max kernels per task, each GPU copy kernel running on its own
+//! associated thread space, so a batch costs one flush per task instead of one
+//! flush per copy. Tasks of the same queue execute in order, so only the event
+//! of the last task is returned.
+//! INPUT:
+//!     1) Array of pointers to output surfaces
+//!     2) Array of pointers to input surfaces
+//!     3) Number of copies
+//!     4) Option passed from user, blocking copy, non-blocking copy or disable turbo boost
+//!     5) Reference to the pointer to CMEvent
+//! OUTPUT:
+//!     CM_SUCCESS if all the tasks are successfully enqueued;
+//!     CM_INVALID_ARG_VALUE if surface arrays are null or copy count is 0;
+//!     the error of EnqueueCopyGPUToGPU if one of the copies is invalid.
+//! Restrictions:
+//!     Same as EnqueueCopyGPUToGPU for each pair of surfaces. Copies run in
+//!     array order where they share a surface another one writes, a sync is
+//!     added to the task between such copies.
+//*-----------------------------------------------------------------------------
+CM_RT_API int32_t CmQueueRT::EnqueueCopyGPUToGPUBatch(CmSurface2D **outputSurfaces,
+                                                      CmSurface2D **inputSurfaces,
+                                                      uint32_t copyCount,
+                                                      uint32_t option,
+                                                      CmEvent *&event)
+{
+    INSERT_API_CALL_LOG(GetHalState());
+
+    if (!m_device->HasGpuCopyKernel())
+    {
+        return CM_NOT_IMPLEMENTED;
+    }
+
+    if ((outputSurfaces == nullptr) || (inputSurfaces == nullptr) || (copyCount == 0))
+    {
+        CM_ASSERTMESSAGE("Error: Invalid surface arrays or copy count.");
+        return CM_INVALID_ARG_VALUE;
+    }
+
+    int32_t             hr = CM_SUCCESS;
+    uint32_t            maxKernelsPerTask = MOS_MIN(m_halMaxValues->maxKernelsPerTask, CM_MAX_KERNELS_PER_TASK);
+    uint32_t            kernelCount = 0;
+    CM_GPUCOPY_KERNEL   *gpuCopyKernelParams[CM_MAX_KERNELS_PER_TASK];
+    CmThreadSpace       *threadSpaces[CM_MAX_KERNELS_PER_TASK];
+    bool                associated[CM_MAX_KERNELS_PER_TASK];
+    CmTask              *task = nullptr;
+    CmEvent             *internalEvent = nullptr;
+
+    CmSafeMemSet(associated, 0, sizeof(associated));
+
+    for (uint32_t start = 0; start < copyCount; start += maxKernelsPerTask)
+    {
+        uint32_t batchCount = MOS_MIN(maxKernelsPerTask, copyCount - start);
+
+        CM_CHK_CMSTATUS_GOTOFINISH(m_device->CreateTask(task));
+        CM_CHK_NULL_GOTOFINISH_CMERROR(task);
+
+        // First copy since the last sync, kernels of a task run concurrently in between
+        uint32_t syncStart = start;
+        for (uint32_t i = 0; i < batchCount; i++)
+        {
+            CmSurface2D *dst = outputSurfaces[start + i];
+            CmSurface2D *src = inputSurfaces[start + i];
+            for (uint32_t j = syncStart; j < start + i; j++)
+            {
+                // RAW, WAW and WAR on a surface of an earlier copy need a sync
+                if ((src == outputSurfaces[j]) || (dst == outputSurfaces[j]) || (dst == inputSurfaces[j]))
+                {
+                    CM_CHK_CMSTATUS_GOTOFINISH(task->AddSync());
+                    syncStart = start + i;
+                    break;
+                }
+            }
+
+            CM_CHK_CMSTATUS_GOTOFINISH(PrepareGPUToGPUCopy(outputSurfaces[start + i], inputSurfaces[start + i],
+                                                           gpuCopyKernelParams[i], threadSpaces[i]));
+            kernelCount++;
+
+            CmKernel *kernel = gpuCopyKernelParams[i]->kernel;
+            CM_CHK_CMSTATUS_GOTOFINISH(kernel->AssociateThreadSpace(threadSpaces[i]));
+            associated[i] = true;
+            CM_CHK_CMSTATUS_GOTOFINISH(task->AddKernel(kernel));
+        }
+
+        if (option & CM_FASTCOPY_OPTION_DISABLE_TURBO_BOOST)
+        {
+            // disable turbo
+            CM_TASK_CONFIG taskConfig;
+            CmSafeMemSet(&taskConfig, 0, sizeof(CM_TASK_CONFIG));
+            taskConfig.turboBoostFlag = CM_TURBO_BOOST_DISABLE;
+            task->SetProperty(taskConfig);
+        }
+
+        if (internalEvent)  //Intermediate event, we don't need it
+        {
+            CM_CHK_CMSTATUS_GOTOFINISH(DestroyEventFast(internalEvent));
+        }
+        CM_CHK_CMSTATUS_GOTOFINISH(EnqueueFast(task, internalEvent));
+
+        // Kernel state is captured at enqueue, release the copy kernels for reuse
+        for (uint32_t i = 0; i < kernelCount; i++)
+        {
+            if (associated[i])
+            {
+                gpuCopyKernelParams[i]->kernel->DeAssociateThreadSpace(threadSpaces[i]);
+                associated[i] = false;
+            }
+            GPUCOPY_KERNEL_UNLOCK(gpuCopyKernelParams[i]);
+            m_device->DestroyThreadSpace(threadSpaces[i]);
+        }
+        kernelCount = 0;
+
+        CM_CHK_CMSTATUS_GOTOFINISH(m_device->DestroyTask(task));
+    }
+
+    if ((option & CM_FASTCOPY_OPTION_BLOCKING) && (internalEvent))
+    {
+        CM_CHK_CMSTATUS_GOTOFINISH(internalEvent->WaitForTaskFinished());
+    }
+
+    if (event == CM_NO_EVENT)  //User doesn't need CmEvent for this copy
+    {
+        event = nullptr;
+        CM_CHK_CMSTATUS_GOTOFINISH(DestroyEventFast(internalEvent));
+    }
+    else //User needs this CmEvent
+    {
+        event = internalEvent;
+        internalEvent = nullptr;
+    }
+
+finish:
+
+    if (hr != CM_SUCCESS)
+    {
+        for (uint32_t i = 0; i < kernelCount; i++)
+        {
+            if (associated[i])
+            {
+                gpuCopyKernelParams[i]->kernel->DeAssociateThreadSpace(threadSpaces[i]);
+            }
+            GPUCOPY_KERNEL_UNLOCK(gpuCopyKernelParams[i]);
+            m_device->DestroyThreadSpace(threadSpaces[i]);
+        }
+        if (task)                              m_device->DestroyTask(task);
+        if (internalEvent)                     DestroyEventFast(internalEvent);
+    }
+
+    return hr;
+}
+
+//*-----------------------------------------------------------------------------
+//! Validate a GPU to GPU surface copy, then get a locked GPU copy kernel with
+//! its arguments set and create the thread space covering the copy.
+//! The caller unlocks the kernel and destroys the thread space once enqueued.
+//! OUTPUT:
+//!     CM_SUCCESS if kernel and thread space are ready;
+//!     CM_GPUCOPY_INVALID_SURFACES / CM_GPUCOPY_INVALID_SIZE as EnqueueCopyGPUToGPU.
+//*-----------------------------------------------------------------------------
+int32_t CmQueueRT::PrepareGPUToGPUCopy(CmSurface2D *outputSurface,
+                                       CmSurface2D *inputSurface,
+                                       CM_GPUCOPY_KERNEL *&gpuCopyKernelParam,
+                                       CmThreadSpace *&threadSpace)
+{
     uint32_t srcSurfaceWidth = 0;
     uint32_t srcSurfaceHeight = 0;
     uint32_t dstSurfaceWidth = 0;
@@ -1993,10 +2199,10 @@ CM_RT_API int32_t CmQueueRT::EnqueueCopyGPUToGPU( CmSurface2D* outputSurface, Cm
     CmKernel            *kernel = nullptr;
     SurfaceIndex        *surfaceInputIndex = nullptr;
     SurfaceIndex        *surfaceOutputIndex = nullptr;
-    CmThreadSpace       *threadSpace = nullptr;
-    CmTask              *task = nullptr;
     uint32_t            srcSurfAlignedWidthInBytes = 0;
-    CM_GPUCOPY_KERNEL *gpuCopyKernelParam = nullptr;
+
+    gpuCopyKernelParam = nullptr;
+    threadSpace = nullptr;
 
     if ((outputSurface == nullptr) || (inputSurface == nullptr))
     {
@@ -2063,31 +2269,16 @@ CM_RT_API int32_t CmQueueRT::EnqueueCopyGPUToGPU( CmSurface2D* outputSurface, Cm
 
     CM_CHK_CMSTATUS_GOTOFINISH(m_device->CreateThreadSpace(threadWidth, threadHeight, threadSpace));
 
-    CM_CHK_CMSTATUS_GOTOFINISH(m_device->CreateTask(task));
-    CM_CHK_NULL_GOTOFINISH_CMERROR(task);
-    CM_CHK_CMSTATUS_GOTOFINISH(task->AddKernel(kernel));
-
-    if (option & CM_FASTCOPY_OPTION_DISABLE_TURBO_BOOST)
-    {
-        // disable turbo
-        CM_TASK_CONFIG taskConfig;
-        CmSafeMemSet(&taskConfig, 0, sizeof(CM_TASK_CONFIG));
-        taskConfig.turboBoostFlag = CM_TURBO_BOOST_DISABLE;
-        task->SetProperty(taskConfig);
-    }
+finish:
 
-    CM_CHK_CMSTATUS_GOTOFINISH(EnqueueFast(task, event, threadSpace));
-    if ((option & CM_FASTCOPY_OPTION_BLOCKING) && (event))
+    if (hr != CM_SUCCESS)
     {
-        CM_CHK_CMSTATUS_GOTOFINISH(event->WaitForTaskFinished());
+        if (kernel && gpuCopyKernelParam)        GPUCOPY_KERNEL_UNLOCK(gpuCopyKernelParam);
+        if (threadSpace)                                m_device->DestroyThreadSpace(threadSpace);
+        gpuCopyKernelParam = nullptr;
+        threadSpace = nullptr;
     }
 
-finish:
-
-    if (kernel && gpuCopyKernelParam)        GPUCOPY_KERNEL_UNLOCK(gpuCopyKernelParam);
-    if (threadSpace)                                m_device->DestroyThreadSpace(threadSpace);
-    if (task)                              m_device->DestroyTask(task);
-
     return hr;
 }
 
@@ -2622,6 +2813,41 @@ finish:
     return hr;
 }
 
+//*-----------------------------------------------------------------------------
+//! Block until the oldest task in flushed queue is done on GPU, or timeout.
+//! It waits on the OS sync object of the task, so the calling thread sleeps
+//! in the OS instead of polling task status. Flushed queue is in order, so
+//! the finish of the oldest task is the first one that frees a task slot.
+//! INPUT:
+//!     Timeout in Milliseconds
+//! OUTPUT:
+//!     CM_SUCCESS if the task is done or no task is flushed;
+//!     CM_EXCEED_MAX_TIMEOUT if timeout.
+//*-----------------------------------------------------------------------------
+int32_t CmQueueRT::WaitForOldestFlushedTask(uint32_t timeOutMs)
+{
+    void *osData = nullptr;
+
+    m_criticalSectionFlushedTask.Acquire();
+    if( !m_flushedTasks.IsEmpty() )
+    {
+        CmTaskInternal *task = (CmTaskInternal*)m_flushedTasks.Top();
+        CmEventRT *event = nullptr;
+        if( task )
+        {
+            task->GetTaskEvent(event);
+        }
+        if( event )
+        {
+            // Keep the sync object alive when the event is finished by another thread
+            osData = event->ReferenceOsData();
+        }
+    }
+    m_criticalSectionFlushedTask.Release();
+
+    return CmEventRT::WaitForOsData(osData, timeOutMs);
+}
+
 //*-----------------------------------------------------------------------------
 //! This is a blocking call. It will NOT return untill
 //! all tasks in GPU and all tasks in queue finishes execution.
@@ -3337,6 +3563,11 @@ int32_t CmQueueRT::FlushTaskWithoutSync( bool flushBlocked )
                 // query the staus of flushed task queue. Remove any finished tasks from the queue
                 QueryFlushedTasks();
                 flushedTaskCount = m_flushedTasks.GetCount();
+                if( flushedTaskCount >= m_halMaxValues->maxTasks )
+                {
+                    // Sleep in the OS until the oldest task is done instead of polling
+                    WaitForOldestFlushedTask(CM_MAX_TIMEOUT_MS);
+                }
             }
         }
         else
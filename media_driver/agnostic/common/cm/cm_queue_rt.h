@@ -184,6 +184,17 @@ public:
                                       CmEvent *&event,
                                       const CmThreadGroupSpace *threadGroupSpace = nullptr);
 
+    CM_RT_API int32_t EnqueueCopyGPUToGPUBatch(CmSurface2D **outputSurfaces,
+                                               CmSurface2D **inputSurfaces,
+                                               uint32_t copyCount,
+                                               uint32_t option,
+                                               CmEvent *&event);
+
+    int32_t PrepareGPUToGPUCopy(CmSurface2D *outputSurface,
+                                CmSurface2D *inputSurface,
+                                CM_GPUCOPY_KERNEL *&gpuCopyKernelParam,
+                                CmThreadSpace *&threadSpace);
+
     int32_t EnqueueCopyInternal_1Plane(CmSurface2DRT *surface,
                                        unsigned char *sysMem,
                                        CM_SURFACE_FORMAT format,
@@ -224,6 +235,8 @@ public:
 
     int32_t FlushTaskWithoutSync(bool flushBlocked = false);
 
+    int32_t WaitForOldestFlushedTask(uint32_t timeOutMs);
+
     int32_t GetTaskCount(uint32_t &numTasks);
 
     int32_t TouchFlushedTasks();
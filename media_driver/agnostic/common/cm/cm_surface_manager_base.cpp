@@ -83,6 +83,7 @@ int32_t CmSurfaceManagerBase::UpdateStateForRealDestroy(uint32_t index,
     }
 
     m_surfaceArray[index] = nullptr;
+    m_freeSurfaceIndices.push_back(index);
 
     m_surfaceSizes[index] = 0;
 
@@ -180,6 +181,7 @@ CmSurfaceManagerBase::CmSurfaceManagerBase(CmDeviceRT* device) :
     m_surfaceArraySize(0),
     m_surfaceArray(nullptr),
     m_maxSurfaceIndexAllocated(0),
+    m_untouchedSurfaceIndexStart(0),
     m_surfaceSizes(nullptr),
     m_maxBufferCount(0),
     m_bufferCount(0),
@@ -361,6 +363,8 @@ int32_t CmSurfaceManagerBase::Initialize( CM_HAL_MAX_VALUES halMaxValues,
                                         halMaxValuesEx.maxSampler8x8TableSize;
     m_surfaceArraySize = totalSurfaceCount + totalVirtualSurfaceCount;
     m_maxSurfaceIndexAllocated = 0;
+    m_untouchedSurfaceIndexStart = ValidSurfaceIndexStart();
+    m_freeSurfaceIndices.clear();
 
     m_maxBufferCount = halMaxValues.maxBufferTableSize;
     m_max2DSurfaceCount = halMaxValues.max2DSurfaceTableSize;
@@ -509,6 +513,26 @@ int32_t CmSurfaceManagerBase::TouchSurfaceInPoolForDestroy()
 
 int32_t CmSurfaceManagerBase::GetFreeSurfaceIndexFromPool(uint32_t &freeIndex)
 {
+    // Released indices first. An entry may be stale if the slot was taken by the scan below.
+    while (!m_freeSurfaceIndices.empty())
+    {
+        uint32_t index = m_freeSurfaceIndices.back();
+        m_freeSurfaceIndices.pop_back();
+        if (index >= ValidSurfaceIndexStart() && index < m_surfaceArraySize && !m_surfaceArray[index])
+        {
+            freeIndex = index;
+            return CM_SUCCESS;
+        }
+    }
+
+    // Then indices never handed out.
+    if (m_untouchedSurfaceIndexStart < m_surfaceArraySize && !m_surfaceArray[m_untouchedSurfaceIndexStart])
+    {
+        freeIndex = m_untouchedSurfaceIndexStart++;
+        return CM_SUCCESS;
+    }
+
+    // Fall back to scan, covering indices handed out but not used by caller.
     uint32_t index = ValidSurfaceIndexStart();
 
     while( ( index < m_surfaceArraySize ) && m_surfaceArray[ index ] )
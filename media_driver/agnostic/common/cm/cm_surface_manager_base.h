@@ -31,6 +31,7 @@
 #include "cm_def.h"
 #include "cm_hal.h"
 #include <set>
+#include <vector>
 
 typedef enum _MOS_FORMAT MOS_FORMAT;
 
@@ -209,6 +210,10 @@ protected:
     CmSurface** m_surfaceArray;
     // the max index allocated in the m_SurfaceArray
     uint32_t m_maxSurfaceIndexAllocated;
+    // indices released by real destroy, reused first to avoid scanning m_surfaceArray
+    std::vector<uint32_t> m_freeSurfaceIndices;
+    // start of indices in m_surfaceArray which have never been handed out
+    uint32_t m_untouchedSurfaceIndexStart;
     // Size of each surface in surface array
     int32_t *m_surfaceSizes;
 
@@ -1738,17 +1738,13 @@ MOS_STATUS CodechalDecodeVc1::BitplaneNorm2Mode()
         count--;
     }
 
+    // Norm-2 codes for each pair of MBs are "0", "11" or "10x", so the code
+    // length follows from the next 3 bits and the pair can be skipped at once
     for (uint32_t i = 0; i < count / 2; i++)
     {
-        CODECHAL_DECODE_CHK_STATUS_RETURN(GetBits(1, value));
-        if (value)
-        {
-            CODECHAL_DECODE_CHK_STATUS_RETURN(GetBits(1, value));
-            if (value == 0)
-            {
-                CODECHAL_DECODE_CHK_STATUS_RETURN(GetBits(1, value));
-            }
-        }
+        uint32_t code       = PeekBits(3);
+        uint32_t codeLength = (code & 4) ? ((code & 2) ? 2 : 3) : 1;
+        CODECHAL_DECODE_CHK_STATUS_RETURN(SkipBits(codeLength, value));
     }
 
     return eStatus;
@@ -2147,6 +2147,8 @@ MOS_STATUS CodechalEncodeAvcEnc::InitBrcConstantBuffer(PCODECHAL_ENCODE_AVC_INIT
     MOS_LOCK_PARAMS lockFlags;
     MOS_ZeroMemory(&lockFlags, sizeof(MOS_LOCK_PARAMS));
     lockFlags.WriteOnly = 1;
+    // using an async lock because the wait has already occured for recycled buffers
+    lockFlags.NoOverWrite = 1;
     uint8_t* pbData = (uint8_t*)params->pOsInterface->pfnLockResource(
         params->pOsInterface,
         &params->sBrcConstantDataBuffer.OsResource,
@@ -387,9 +387,13 @@ MOS_STATUS MediaPerfProfiler::AddPerfCollectStartCmd(
 
     if (BASE_OF_NODE(perfDataIndex) + sizeof(PerfEntry) > m_bufferSize)
     {
-        MosUtilities::MosUnlockMutex(m_mutex);
-        MOS_OS_ASSERTMESSAGE("Reached maximum perf data buffer size, please increase it in Performance\\Perf Profiler Buffer Size");
-        return MOS_STATUS_NOT_ENOUGH_BUFFER;
+        if (!m_ringBuffer || MaxPerfDataNodes() == 0)
+        {
+            MosUtilities::MosUnlockMutex(m_mutex);
+            MOS_OS_ASSERTMESSAGE("Reached maximum perf data buffer size, please increase it in Performance\\Perf Profiler Buffer Size");
+            return MOS_STATUS_NOT_ENOUGH_BUFFER;
+        }
+        perfDataIndex %= MaxPerfDataNodes();
     }
 
     m_contextIndexMap[context] = perfDataIndex;
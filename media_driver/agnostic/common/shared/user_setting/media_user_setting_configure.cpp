@@ -132,8 +132,7 @@ MOS_STATUS Configure::Read(Value &value,
 {
     int32_t     ret     = 0;
     MOS_STATUS  status  = MOS_STATUS_SUCCESS;
-    auto        &defs   = GetDefinitions(group);
-    auto        def     = defs[MakeHash(valueName)];
+    auto        def     = GetDefinition(valueName, group);
     if (def == nullptr)
     {
         return MOS_STATUS_INVALID_HANDLE;
@@ -195,9 +194,7 @@ MOS_STATUS Configure::Write(
     bool isForReport,
     uint32_t option)
 {
-    auto &defs = GetDefinitions(group);
-
-    auto def = defs[MakeHash(valueName)];
+    auto def = GetDefinition(valueName, group);
     if (def == nullptr)
     {
         return MOS_STATUS_INVALID_HANDLE;
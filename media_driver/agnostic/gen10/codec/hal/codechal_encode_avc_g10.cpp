@@ -3986,6 +3986,8 @@ MOS_STATUS CodechalEncodeAvcEncG10::InitBrcConstantBuffer(
     MOS_LOCK_PARAMS lockFlags;
     memset(&lockFlags, 0, sizeof(MOS_LOCK_PARAMS));
     lockFlags.WriteOnly = 1;
+    // using an async lock because the wait has already occured for recycled buffers
+    lockFlags.NoOverWrite = 1;
     auto dataPtr = (uint8_t*)params->pOsInterface->pfnLockResource(
         params->pOsInterface,
         &params->sBrcConstantDataBuffer.OsResource,
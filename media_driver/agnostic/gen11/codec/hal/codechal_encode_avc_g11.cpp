@@ -5921,6 +5921,7 @@ MOS_STATUS CodechalEncodeAvcEncG11::InitBrcConstantBuffer(PCODECHAL_ENCODE_AVC_I
     MOS_LOCK_PARAMS     LockFlags;
     MOS_ZeroMemory(&LockFlags, sizeof(MOS_LOCK_PARAMS));
     LockFlags.WriteOnly = 1;
+    LockFlags.NoOverWrite = 1;
     auto data = (uint8_t*)params->pOsInterface->pfnLockResource(
         params->pOsInterface,
         &params->sBrcConstantDataBuffer.OsResource,
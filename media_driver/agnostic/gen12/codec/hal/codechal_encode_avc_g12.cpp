@@ -2787,6 +2787,7 @@ MOS_STATUS CodechalEncodeAvcEncG12::InitBrcConstantBuffer(PCODECHAL_ENCODE_AVC_I
     MOS_LOCK_PARAMS lockFlags;
     memset(&lockFlags, 0, sizeof(MOS_LOCK_PARAMS));
     lockFlags.WriteOnly = 1;
+    lockFlags.NoOverWrite = 1;
     auto dataPtr         = (uint8_t*)params->pOsInterface->pfnLockResource(
         params->pOsInterface,
         &params->sBrcConstantDataBuffer.OsResource,
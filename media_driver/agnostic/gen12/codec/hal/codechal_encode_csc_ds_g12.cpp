@@ -108,7 +108,14 @@ MOS_STATUS CodechalEncodeCscDsG12::CheckRawColorFormat(MOS_FORMAT format, MOS_TI
         break;
     case Format_A8B8G8R8:
         m_colorRawSurface = cscColorABGR;
+        m_cscUsingSfc = IsSfcEnabled() ? 1 : 0;
         m_cscRequireColor = 1;
+        //Use EU for better performance in big resolution cases
+        if (m_cscRawSurfWidth * m_cscRawSurfHeight > 1920 * 1088
+            && !MEDIA_IS_WA(m_hwInterface->GetWaTable(), Wa_1409932735))
+        {
+            m_cscUsingSfc = 0;
+        }
         break;
     case Format_P010:
     case Format_P016:
@@ -3868,6 +3868,7 @@ MOS_STATUS CodechalEncodeAvcEncG8::InitBrcConstantBufferMultiRefQP(
     MOS_LOCK_PARAMS     lockFlags;
     MOS_ZeroMemory(&lockFlags, sizeof(MOS_LOCK_PARAMS));
     lockFlags.WriteOnly = 1;
+    lockFlags.NoOverWrite = 1;
     auto data = (uint8_t*)params->pOsInterface->pfnLockResource(
         params->pOsInterface,
         &params->sBrcConstantDataBuffer.OsResource,
@@ -2681,6 +2681,7 @@ MOS_STATUS CodechalEncodeAvcEncG9Bxt::InitBrcConstantBufferMultiRefQP(PCODECHAL_
     MOS_LOCK_PARAMS LockFlags;
     MOS_ZeroMemory(&LockFlags, sizeof(MOS_LOCK_PARAMS));
     LockFlags.WriteOnly = 1;
+    LockFlags.NoOverWrite = 1;
     uint8_t* pbData = (uint8_t*)pParams->pOsInterface->pfnLockResource(
         pParams->pOsInterface,
         &pParams->sBrcConstantDataBuffer.OsResource,
@@ -2681,6 +2681,8 @@ MOS_STATUS CodechalEncodeAvcEncG9Skl::InitBrcConstantBufferMultiRefQP(PCODECHAL_
     MOS_LOCK_PARAMS LockFlags;
     MOS_ZeroMemory(&LockFlags, sizeof(MOS_LOCK_PARAMS));
     LockFlags.WriteOnly = 1;
+    // using an async lock because the wait has already occured for recycled buffers
+    LockFlags.NoOverWrite = 1;
     uint8_t* pbData = (uint8_t*)pParams->pOsInterface->pfnLockResource(
         pParams->pOsInterface,
         &pParams->sBrcConstantDataBuffer.OsResource,
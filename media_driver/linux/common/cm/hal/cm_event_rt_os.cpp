@@ -87,6 +87,15 @@ CM_RT_API int32_t CmEventRT::WaitForTaskFinished(uint32_t timeOutMs)
     while ( m_status == CM_STATUS_QUEUED )
     {
         m_queue->FlushTaskWithoutSync();  //Flush none if 1st task NOT finished yet
+        if ( m_status == CM_STATUS_QUEUED )
+        {
+            // Flushed queue is full, sleep until its oldest task frees a slot
+            result = m_queue->WaitForOldestFlushedTask(timeOutMs);
+            if (result != CM_SUCCESS)
+            {
+                goto finish;
+            }
+        }
     }
 
     CM_ASSERT(m_osData != nullptr);
@@ -117,6 +126,45 @@ finish:
     return result;
 }
 
+//*-----------------------------------------------------------------------------
+//! Reference the bo of the task in linux if the task is not finished.
+//! INPUT:
+//!     No input is needed
+//! OUTPUT:
+//!     bo in a void * format, nullptr if the task is finished
+//*-----------------------------------------------------------------------------
+void *CmEventRT::ReferenceOsData()
+{
+    if( m_status == CM_STATUS_FINISHED || m_osData == nullptr )
+    {
+        return nullptr;
+    }
+    mos_bo_reference((MOS_LINUX_BO*)m_osData);
+    return m_osData;
+}
+
+//*-----------------------------------------------------------------------------
+//! Wait for the bo in linux, then unreference it.
+//! INPUT:
+//!     bo in a void * format, referenced by ReferenceOsData
+//!     Timeout in Milliseconds
+//! OUTPUT:
+//!     CM_SUCCESS:  if GPU is done with the bo, or there is no bo
+//!     CM_EXCEED_MAX_TIMEOUT:  if timeout in synchoinization system call.
+//*-----------------------------------------------------------------------------
+int32_t CmEventRT::WaitForOsData(void *osData, uint32_t timeOutMs)
+{
+    if( osData == nullptr )
+    {
+        return CM_SUCCESS;
+    }
+
+    int result = mos_gem_bo_wait((MOS_LINUX_BO*)osData, 1000000LL*timeOutMs);
+    mos_bo_unreference((MOS_LINUX_BO*)osData);
+
+    return result ? CM_EXCEED_MAX_TIMEOUT : CM_SUCCESS;
+}
+
 //*-----------------------------------------------------------------------------
 //! Unreference the bo in linux.
 //! INPUT:
@@ -28,16 +28,20 @@
 #include "cm_mem_os.h"
 #include "cm_mem_os_c_impl.h"
 #include "cm_mem_os_sse4_impl.h"
+#include "cm_mem_os_avx2_impl.h"
 
 typedef void(*t_CmFastMemCopyFromWC)( void* dst, const void* src, const size_t bytes );
 
 #define CM_FAST_MEM_COPY_CPU_INIT_C(func)       (func ## _C)
 #define CM_FAST_MEM_COPY_CPU_INIT_SSE4(func)    (func ## _SSE4)
-#define CM_FAST_MEM_COPY_CPU_INIT(func)         (is_SSE4_available ? CM_FAST_MEM_COPY_CPU_INIT_SSE4(func) : CM_FAST_MEM_COPY_CPU_INIT_C(func))
+#define CM_FAST_MEM_COPY_CPU_INIT_AVX2(func)    (func ## _AVX2)
+#define CM_FAST_MEM_COPY_CPU_INIT(func)         (is_AVX2_available ? CM_FAST_MEM_COPY_CPU_INIT_AVX2(func) : \
+                                                 is_SSE4_available ? CM_FAST_MEM_COPY_CPU_INIT_SSE4(func) : CM_FAST_MEM_COPY_CPU_INIT_C(func))
 
 void CmFastMemCopyFromWC( void* dst, const void* src, const size_t bytes, CPU_INSTRUCTION_LEVEL cpuInstructionLevel )
 {
     static const bool is_SSE4_available = (cpuInstructionLevel >= CPU_INSTRUCTION_LEVEL_SSE4_1);
+    static const bool is_AVX2_available = (cpuInstructionLevel >= CPU_INSTRUCTION_LEVEL_AVX2);
     static const t_CmFastMemCopyFromWC CmFastMemCopyFromWC_impl = CM_FAST_MEM_COPY_CPU_INIT(CmFastMemCopyFromWC);
 
     CmFastMemCopyFromWC_impl(dst, src, bytes);
@@ -107,6 +107,41 @@ inline bool TestSSE4_1( void )
     return success;
 }
 
+/*****************************************************************************\
+Inline Function:
+    TestAVX2
+
+Description:
+    Checks that CPU supports AVX2 and that OS saves YMM state on context switch
+\*****************************************************************************/
+inline bool TestAVX2( void )
+{
+    unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+
+    // OSXSAVE and AVX
+    if ( !__get_cpuid(1, &eax, &ebx, &ecx, &edx) ||
+         !(ecx & (1u << 27)) || !(ecx & (1u << 28)) )
+    {
+        return false;
+    }
+
+    // XMM and YMM state enabled in XCR0
+    unsigned int xcr0Low = 0, xcr0High = 0;
+    __asm__ __volatile__ ("xgetbv" : "=a"(xcr0Low), "=d"(xcr0High) : "c"(0));
+    if ( (xcr0Low & 0x6) != 0x6 )
+    {
+        return false;
+    }
+
+    if ( __get_cpuid_max(0, nullptr) < 7 )
+    {
+        return false;
+    }
+    __cpuid_count(7, 0, eax, ebx, ecx, edx);
+
+    return (ebx & (1u << 5)) != 0;
+}
+
 /*****************************************************************************\
 Inline Function:
     GetCPUID
@@ -28,6 +28,7 @@ set(TMP_HEADERS_
     ${CMAKE_CURRENT_LIST_DIR}/cm_mem_os.h
     ${CMAKE_CURRENT_LIST_DIR}/cm_mem_os_c_impl.h
     ${CMAKE_CURRENT_LIST_DIR}/cm_mem_os_sse4_impl.h
+    ${CMAKE_CURRENT_LIST_DIR}/cm_mem_os_avx2_impl.h
     ${CMAKE_CURRENT_LIST_DIR}/cm_ish.h)
 
 set(SOURCES_
@@ -41,6 +42,11 @@ set(HEADERS_
 )
 
 set(SOURCES_SSE4
+    ${SOURCES_SSE4}
     ${CMAKE_CURRENT_LIST_DIR}/cm_mem_os_sse4_impl.cpp)
 
+set(SOURCES_AVX2
+    ${SOURCES_AVX2}
+    ${CMAKE_CURRENT_LIST_DIR}/cm_mem_os_avx2_impl.cpp)
+
 media_add_curr_to_include_path()
@@ -53,10 +53,12 @@ VAStatus DdiDecodeAV1::ParseTileParams(
     CodecAv1TileParams     *tileParams;
     VASliceParameterBufferAV1 *pTileCtrl = nullptr;
 
-    // if number of tile group exceed av1MaxTileNum, need to increase the memory
-    if (av1MaxTileNum < numTiles)
+    // Tile groups of one picture are appended to the same tile param array,
+    // the accumulated tile number should not exceed av1MaxTileNum
+    if (av1MaxTileNum < numTiles + m_ddiDecodeCtx->DecodeParams.m_numSlices)
     {
-        DDI_ASSERTMESSAGE("numTiles = %d : exceeds av1MaxTileNum = %d", numTiles, av1MaxTileNum);
+        DDI_ASSERTMESSAGE("numTiles = %d, accumulated tiles = %d : exceeds av1MaxTileNum = %d",
+            numTiles, m_ddiDecodeCtx->DecodeParams.m_numSlices, av1MaxTileNum);
         return VA_STATUS_ERROR_MAX_NUM_EXCEEDED;
     }
 
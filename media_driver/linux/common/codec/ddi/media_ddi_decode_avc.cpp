@@ -595,6 +595,7 @@ VAStatus DdiDecodeAVC::AllocSliceControlBuffer(
     DDI_CODEC_COM_BUFFER_MGR   *bufMgr;
     uint32_t                    availSize;
     uint32_t                    newSize;
+    uint32_t                    extraSlices;
 
     bufMgr     = &(m_ddiDecodeCtx->BufMgr);
     availSize = m_sliceCtrlBufNum - bufMgr->dwNumSliceControl;
@@ -603,14 +604,17 @@ VAStatus DdiDecodeAVC::AllocSliceControlBuffer(
     {
         if(availSize < buf->uiNumElements)
                 {
-            newSize   = sizeof(VASliceParameterBufferBase) * (m_sliceCtrlBufNum - availSize + buf->uiNumElements);
+            // in order to avoid that the buffer is reallocated multi-times,
+            // extra 10 slices are added.
+            extraSlices = buf->uiNumElements - availSize + 10;
+            newSize     = sizeof(VASliceParameterBufferBase) * (m_sliceCtrlBufNum + extraSlices);
             bufMgr->Codec_Param.Codec_Param_H264.pVASliceParaBufH264Base = (VASliceParameterBufferBase *)realloc(bufMgr->Codec_Param.Codec_Param_H264.pVASliceParaBufH264Base, newSize);
             if(bufMgr->Codec_Param.Codec_Param_H264.pVASliceParaBufH264Base == nullptr)
             {
                 return VA_STATUS_ERROR_ALLOCATION_FAILED;
             }
-            MOS_ZeroMemory(bufMgr->Codec_Param.Codec_Param_H264.pVASliceParaBufH264Base + m_sliceCtrlBufNum, sizeof(VASliceParameterBufferBase) * (buf->uiNumElements - availSize));
-            m_sliceCtrlBufNum = m_sliceCtrlBufNum - availSize + buf->uiNumElements;
+            MOS_ZeroMemory(bufMgr->Codec_Param.Codec_Param_H264.pVASliceParaBufH264Base + m_sliceCtrlBufNum, sizeof(VASliceParameterBufferBase) * extraSlices);
+            m_sliceCtrlBufNum += extraSlices;
         }
         buf->pData      = (uint8_t*)bufMgr->Codec_Param.Codec_Param_H264.pVASliceParaBufH264Base;
         buf->uiOffset   = bufMgr->dwNumSliceControl * sizeof(VASliceParameterBufferBase);
@@ -619,14 +623,17 @@ VAStatus DdiDecodeAVC::AllocSliceControlBuffer(
     {
         if(availSize < buf->uiNumElements)
         {
-            newSize   = sizeof(VASliceParameterBufferH264) * (m_sliceCtrlBufNum - availSize + buf->uiNumElements);
+            // in order to avoid that the buffer is reallocated multi-times,
+            // extra 10 slices are added.
+            extraSlices = buf->uiNumElements - availSize + 10;
+            newSize     = sizeof(VASliceParameterBufferH264) * (m_sliceCtrlBufNum + extraSlices);
             bufMgr->Codec_Param.Codec_Param_H264.pVASliceParaBufH264 = (VASliceParameterBufferH264 *)realloc(bufMgr->Codec_Param.Codec_Param_H264.pVASliceParaBufH264, newSize);
             if(bufMgr->Codec_Param.Codec_Param_H264.pVASliceParaBufH264 == nullptr)
             {
                 return VA_STATUS_ERROR_ALLOCATION_FAILED;
             }
-            MOS_ZeroMemory(bufMgr->Codec_Param.Codec_Param_H264.pVASliceParaBufH264 + m_sliceCtrlBufNum, sizeof(VASliceParameterBufferH264) * (buf->uiNumElements - availSize));
-            m_sliceCtrlBufNum = m_sliceCtrlBufNum - availSize + buf->uiNumElements;
+            MOS_ZeroMemory(bufMgr->Codec_Param.Codec_Param_H264.pVASliceParaBufH264 + m_sliceCtrlBufNum, sizeof(VASliceParameterBufferH264) * extraSlices);
+            m_sliceCtrlBufNum += extraSlices;
          }
          buf->pData      = (uint8_t*)bufMgr->Codec_Param.Codec_Param_H264.pVASliceParaBufH264;
          buf->uiOffset   = bufMgr->dwNumSliceControl * sizeof(VASliceParameterBufferH264);
@@ -242,6 +242,18 @@ VAStatus DdiMediaDecode::BeginPicture(
     /* As it is already checked in the upper caller, skip the check */
     mediaCtx = DdiMedia_GetMediaContext(ctx);
 
+    // Pipelined execution of previous picture may still be using the render target
+    // table and decode params, wait before they get updated for current picture.
+    // Failure of previous picture is reported by BeginFrame which clears it.
+    if (m_ddiDecodeCtx->pCodecHal != nullptr && m_ddiDecodeCtx->pCodecHal->IsApogeiosEnabled())
+    {
+        DecodePipelineAdapter *decoder = dynamic_cast<DecodePipelineAdapter *>(m_ddiDecodeCtx->pCodecHal);
+        if (decoder != nullptr)
+        {
+            decoder->WaitPendingExecute();
+        }
+    }
+
 #ifdef _DECODE_PROCESSING_SUPPORTED
     //renderTarget is decode output surface; set renderTarget as vp sfc input surface m_procBuf->surface = rederTarget
     if(m_procBuf)
@@ -723,6 +735,13 @@ VAStatus DdiMediaDecode::ExtraDownScaling(
     DDI_CHK_NULL(mediaCtx, "nullptr ctx", VA_STATUS_ERROR_INVALID_CONTEXT);
     DDI_CHK_NULL(m_ddiDecodeCtx, "nullptr ctx", VA_STATUS_ERROR_INVALID_CONTEXT);
 
+    // Query decoder only when extra down scaling requested, the query has to
+    // wait for the pipelined execution of current picture
+    if (m_ddiDecodeCtx->DecodeParams.m_procParams == nullptr || m_procBuf == nullptr)
+    {
+        return VA_STATUS_SUCCESS;
+    }
+
     bool isDecodeDownScalingSupported = false;
     if (m_ddiDecodeCtx->pCodecHal->IsApogeiosEnabled())
     {
@@ -737,9 +756,7 @@ VAStatus DdiMediaDecode::ExtraDownScaling(
         isDecodeDownScalingSupported = decoder->IsVdSfcSupported();
     }
 
-    if(m_ddiDecodeCtx->DecodeParams.m_procParams != nullptr &&
-       m_procBuf &&
-       !isDecodeDownScalingSupported)
+    if(!isDecodeDownScalingSupported)
     {
         //check vp context
         VAContextID vpCtxID = VA_INVALID_ID;
@@ -171,6 +171,7 @@ VAStatus DdiEncodeBase::StatusReport(
     int32_t  index        = 0;
     uint32_t status       = 0;
     uint32_t timeOutCount = 0;
+    bool     waitedForBo  = false;
     VAStatus eStatus      = VA_STATUS_SUCCESS;
 
     // Get encoded frame information from status buffer queue.
@@ -190,8 +191,8 @@ VAStatus DdiEncodeBase::StatusReport(
             break;
         }
 
-        mos_bo_wait_rendering(mediaBuf->bo);
-
+        // Query the status before waiting on the coded buffer, when the application already
+        // synced the buffer or the frame has completed, the report is ready and no wait is needed.
         EncodeStatusReport *encodeStatusReport = (EncodeStatusReport*)m_encodeCtx->pEncodeStatusReport;
         encodeStatusReport->bSequential = true;  //Query the encoded frame status in sequential.
 
@@ -248,6 +249,14 @@ VAStatus DdiEncodeBase::StatusReport(
         }
         else if (CODECHAL_STATUS_INCOMPLETE == encodeStatusReport[0].CodecStatus)
         {
+            if (!waitedForBo)
+            {
+                // frame still in flight, block on the coded buffer once and query again
+                mos_bo_wait_rendering(mediaBuf->bo);
+                waitedForBo = true;
+                continue;
+            }
+
             bool inlineEncodeStatusUpdate;
             CodechalEncoderState *encoder = dynamic_cast<CodechalEncoderState *>(m_encodeCtx->pCodecHal);
             inlineEncodeStatusUpdate = encoder == nullptr ? false : encoder->m_inlineEncodeStatusUpdate;
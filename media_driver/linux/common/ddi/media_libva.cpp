@@ -41,6 +41,8 @@
 #include "media_libva.h"
 
 #include "media_libva_util.h"
+#include "media_libva_swizzle.h"
+#include "media_libva_copy_pool.h"
 #include "media_libva_decoder.h"
 #include "media_libva_encoder.h"
 #if !defined(ANDROID) && defined(X11_FOUND)
@@ -962,12 +964,9 @@ VAImage* DdiMedia_GetVAImageFromVAImageID (PDDI_MEDIA_CONTEXT mediaCtx, VAImageI
     DDI_CHK_NULL(mediaCtx, "nullptr mediaCtx", nullptr);
 
     uint32_t i       = (uint32_t)imageID;
-    DDI_CHK_LESS(i, mediaCtx->pImageHeap->uiAllocatedHeapElements, "invalid image id", nullptr);
-    DdiMediaUtil_LockMutex(&mediaCtx->ImageMutex);
-    PDDI_MEDIA_IMAGE_HEAP_ELEMENT imageElement = (PDDI_MEDIA_IMAGE_HEAP_ELEMENT)mediaCtx->pImageHeap->pHeapBase;
-    imageElement    += i;
+    PDDI_MEDIA_IMAGE_HEAP_ELEMENT imageElement = (PDDI_MEDIA_IMAGE_HEAP_ELEMENT)DdiMediaUtil_GetHeapElement(mediaCtx->pImageHeap, i);
+    DDI_CHK_NULL(imageElement, "invalid image id", nullptr);
     VAImage *vaImage = imageElement->pImage;
-    DdiMediaUtil_UnLockMutex(&mediaCtx->ImageMutex);
 
     return vaImage;
 }
@@ -988,12 +987,9 @@ void* DdiMedia_GetCtxFromVABufferID (PDDI_MEDIA_CONTEXT mediaCtx, VABufferID buf
     DDI_CHK_NULL(mediaCtx, "nullptr mediaCtx", nullptr);
 
     uint32_t i      = (uint32_t)bufferID;
-    DDI_CHK_LESS(i, mediaCtx->pBufferHeap->uiAllocatedHeapElements, "invalid buffer id", nullptr);
-    DdiMediaUtil_LockMutex(&mediaCtx->BufferMutex);
-    PDDI_MEDIA_BUFFER_HEAP_ELEMENT bufHeapElement  = (PDDI_MEDIA_BUFFER_HEAP_ELEMENT)mediaCtx->pBufferHeap->pHeapBase;
-    bufHeapElement += i;
+    PDDI_MEDIA_BUFFER_HEAP_ELEMENT bufHeapElement  = (PDDI_MEDIA_BUFFER_HEAP_ELEMENT)DdiMediaUtil_GetHeapElement(mediaCtx->pBufferHeap, i);
+    DDI_CHK_NULL(bufHeapElement, "invalid buffer id", nullptr);
     void *temp      = bufHeapElement->pCtx;
-    DdiMediaUtil_UnLockMutex(&mediaCtx->BufferMutex);
 
     return temp;
 }
@@ -1014,12 +1010,9 @@ uint32_t DdiMedia_GetCtxTypeFromVABufferID (PDDI_MEDIA_CONTEXT mediaCtx, VABuffe
     DDI_CHK_NULL(mediaCtx, "nullptr mediaCtx", DDI_MEDIA_CONTEXT_TYPE_NONE);
 
     uint32_t i       = (uint32_t)bufferID;
-    DDI_CHK_LESS(i, mediaCtx->pBufferHeap->uiAllocatedHeapElements, "invalid buffer id", DDI_MEDIA_CONTEXT_TYPE_NONE);
-    DdiMediaUtil_LockMutex(&mediaCtx->BufferMutex);
-    PDDI_MEDIA_BUFFER_HEAP_ELEMENT bufHeapElement  = (PDDI_MEDIA_BUFFER_HEAP_ELEMENT)mediaCtx->pBufferHeap->pHeapBase;
-    bufHeapElement  += i;
+    PDDI_MEDIA_BUFFER_HEAP_ELEMENT bufHeapElement  = (PDDI_MEDIA_BUFFER_HEAP_ELEMENT)DdiMediaUtil_GetHeapElement(mediaCtx->pBufferHeap, i);
+    DDI_CHK_NULL(bufHeapElement, "invalid buffer id", DDI_MEDIA_CONTEXT_TYPE_NONE);
     uint32_t ctxType = bufHeapElement->uiCtxType;
-    DdiMediaUtil_UnLockMutex(&mediaCtx->BufferMutex);
 
     return ctxType;
 
@@ -1435,12 +1428,15 @@ static VAStatus DdiMedia_HeapDestroy(
 {
     DDI_CHK_NULL(mediaCtx, "nullptr ctx", VA_STATUS_ERROR_INVALID_CONTEXT);
     // destroy heaps
+    DdiMediaUtil_FreeRetiredHeapBases(mediaCtx->pSurfaceHeap);
     MOS_FreeMemory(mediaCtx->pSurfaceHeap->pHeapBase);
     MOS_FreeMemory(mediaCtx->pSurfaceHeap);
 
+    DdiMediaUtil_FreeRetiredHeapBases(mediaCtx->pBufferHeap);
     MOS_FreeMemory(mediaCtx->pBufferHeap->pHeapBase);
     MOS_FreeMemory(mediaCtx->pBufferHeap);
 
+    DdiMediaUtil_FreeRetiredHeapBases(mediaCtx->pImageHeap);
     MOS_FreeMemory(mediaCtx->pImageHeap->pHeapBase);
     MOS_FreeMemory(mediaCtx->pImageHeap);
 
@@ -2022,11 +2018,19 @@ VAStatus DdiMedia_InitMediaContext (
         return VA_STATUS_ERROR_ALLOCATION_FAILED;
     }
 
+    if (DdiMediaCopyPool_Create(mediaCtx) != VA_STATUS_SUCCESS)
+    {
+        DestroyMediaContextMutex(mediaCtx);
+        FreeForMediaContext(mediaCtx);
+        return VA_STATUS_ERROR_ALLOCATION_FAILED;
+    }
+
     //Caps need platform and sku table, especially in MediaLibvaCapsCp::IsDecEncryptionSupported
     mediaCtx->m_caps = MediaLibvaCaps::CreateMediaLibvaCaps(mediaCtx);
     if (!mediaCtx->m_caps)
     {
         DDI_ASSERTMESSAGE("Caps create failed. Not supported GFX device.");
+        DdiMediaCopyPool_Destroy(mediaCtx);
         DestroyMediaContextMutex(mediaCtx);
         FreeForMediaContext(mediaCtx);
         return VA_STATUS_ERROR_ALLOCATION_FAILED;
@@ -2036,6 +2040,7 @@ VAStatus DdiMedia_InitMediaContext (
     {
         DDI_ASSERTMESSAGE("Caps init failed. Not supported GFX device.");
         DdiMedia_CleanUp(mediaCtx);
+        DdiMediaCopyPool_Destroy(mediaCtx);
         DestroyMediaContextMutex(mediaCtx);
         FreeForMediaContext(mediaCtx);
         return VA_STATUS_ERROR_ALLOCATION_FAILED;
@@ -2049,6 +2054,7 @@ VAStatus DdiMedia_InitMediaContext (
         if (DdiMedia__InitializeSoftlet(mediaCtx, apoDdiEnabled) != VA_STATUS_SUCCESS)
         {
             DDI_ASSERTMESSAGE("Softlet initialize failed");
+            DdiMediaCopyPool_Destroy(mediaCtx);
             return VA_STATUS_ERROR_ALLOCATION_FAILED;
         }
     }
@@ -2254,6 +2260,7 @@ VAStatus DdiMedia_Terminate (
     DdiMedia_FreeContextCMElements(ctx);
 
     DdiMedia_HeapDestroy(mediaCtx);
+    DdiMediaCopyPool_Destroy(mediaCtx);
     DdiMediaProtected::FreeInstances();
 
     mosCtx.fd               = mediaCtx->fd;
@@ -3600,6 +3607,11 @@ VAStatus DdiMedia_MapBufferInternal (
         default:
             if((buf->format != Media_Format_CPU) && (DdiMedia_MediaFormatToOsFormat(buf->format) != VA_STATUS_ERROR_UNSUPPORTED_RT_FORMAT))
             {
+                if (nullptr != buf->pSurface)
+                {
+                    DDI_CHK_RET(DdiMedia_WaitPendingDecode(mediaCtx, buf->pSurface), "Pending decode of derived surface failed!");
+                }
+
                 DdiMediaUtil_LockMutex(&mediaCtx->BufferMutex);
                 // A critical section starts.
                 // Make sure not to bailout with a return until the section ends.
@@ -3954,6 +3966,13 @@ VAStatus DdiMedia_BeginPicture (
 
     PDDI_MEDIA_SURFACE surface = DdiMedia_GetSurfaceFromVASurfaceID(mediaCtx, render_target);
     DDI_CHK_NULL(surface, "nullptr surface", VA_STATUS_ERROR_INVALID_SURFACE);
+    // bo handle lets the picture be matched with the batch submit and sync events of the same surface
+    MOS_TraceEventExt(EVENT_VA_PICTURE, EVENT_TYPE_INFO, surface->bo? &surface->bo->handle:nullptr, sizeof(uint32_t), nullptr, 0);
+
+    if (ctxType != DDI_MEDIA_CONTEXT_TYPE_DECODER)
+    {
+        DDI_CHK_RET(DdiMedia_WaitPendingDecode(mediaCtx, surface), "Pending decode of render target failed!");
+    }
 
     DdiMediaUtil_LockMutex(&mediaCtx->SurfaceMutex);
     surface->curCtxType = ctxType;
@@ -4055,6 +4074,39 @@ VAStatus DdiMedia_EndPicture (
     return vaStatus;
 }
 
+VAStatus DdiMedia_WaitPendingDecode(
+    PDDI_MEDIA_CONTEXT mediaCtx,
+    DDI_MEDIA_SURFACE  *surface)
+{
+    DDI_CHK_NULL(mediaCtx, "nullptr mediaCtx", VA_STATUS_ERROR_INVALID_CONTEXT);
+    DDI_CHK_NULL(surface,  "nullptr surface",  VA_STATUS_ERROR_INVALID_SURFACE);
+
+    PDDI_DECODE_CONTEXT decCtx = (PDDI_DECODE_CONTEXT)surface->pDecCtx;
+    if (decCtx == nullptr || surface->curCtxType != DDI_MEDIA_CONTEXT_TYPE_DECODER)
+    {
+        return VA_STATUS_SUCCESS;
+    }
+
+    DdiMediaUtil_LockGuard guard(&mediaCtx->SurfaceMutex);
+
+    Codechal *codecHal = decCtx->pCodecHal;
+    if (codecHal == nullptr || !codecHal->IsApogeiosEnabled())
+    {
+        return VA_STATUS_SUCCESS;
+    }
+
+    // Submission of a pipelined decode may still be pending on the decoder
+    // worker, make sure it is queued to HW before other context uses the output.
+    DecodePipelineAdapter *decoder = dynamic_cast<DecodePipelineAdapter *>(codecHal);
+    DDI_CHK_NULL(decoder, "nullptr (DecodePipelineAdapter *decoder) ", VA_STATUS_SUCCESS);
+    if (decoder->WaitPendingExecute() != MOS_STATUS_SUCCESS)
+    {
+        return VA_STATUS_ERROR_DECODING_ERROR;
+    }
+
+    return VA_STATUS_SUCCESS;
+}
+
 static VAStatus DdiMedia_StatusCheck (
     PDDI_MEDIA_CONTEXT mediaCtx,
     DDI_MEDIA_SURFACE  *surface,
@@ -4181,6 +4233,7 @@ VAStatus DdiMedia_SyncSurface (
         DdiMediaUtil_WaitSemaphore(surface->pCurrentFrameSemaphore);
         DdiMediaUtil_PostSemaphore(surface->pCurrentFrameSemaphore);
     }
+    DDI_CHK_RET(DdiMedia_WaitPendingDecode(mediaCtx, surface), "Pending decode of surface failed!");
 
     MOS_TraceEventExt(EVENT_VA_SYNC, EVENT_TYPE_INFO, surface->bo? &surface->bo->handle:nullptr, sizeof(uint32_t), nullptr, 0);
     // check the bo here?
@@ -4191,7 +4244,7 @@ VAStatus DdiMedia_SyncSurface (
         // Just loop while gem_bo_wait times-out.
     }
 
-    MOS_TraceEventExt(EVENT_VA_SYNC, EVENT_TYPE_END, nullptr, 0, nullptr, 0);
+    MOS_TraceEventExt(EVENT_VA_SYNC, EVENT_TYPE_END, &render_target, sizeof(VAGenericID), nullptr, 0);
     return DdiMedia_StatusCheck(mediaCtx, surface, render_target);
 }
 
@@ -4222,6 +4275,7 @@ VAStatus DdiMedia_SyncSurface2 (
         DdiMediaUtil_WaitSemaphore(surface->pCurrentFrameSemaphore);
         DdiMediaUtil_PostSemaphore(surface->pCurrentFrameSemaphore);
     }
+    DDI_CHK_RET(DdiMedia_WaitPendingDecode(mediaCtx, surface), "Pending decode of surface failed!");
     MOS_TraceEventExt(EVENT_VA_SYNC, EVENT_TYPE_INFO, surface->bo? &surface->bo->handle:nullptr, sizeof(uint32_t), nullptr, 0);
 
     if (timeout_ns == VA_TIMEOUT_INFINITE)
@@ -4263,7 +4317,7 @@ VAStatus DdiMedia_SyncSurface2 (
             }
         }
     }
-    MOS_TraceEventExt(EVENT_VA_SYNC, EVENT_TYPE_END, nullptr, 0, nullptr, 0);
+    MOS_TraceEventExt(EVENT_VA_SYNC, EVENT_TYPE_END, &surface_id, sizeof(VAGenericID), nullptr, 0);
     return DdiMedia_StatusCheck(mediaCtx, surface, surface_id);
 }
 
@@ -4366,6 +4420,7 @@ VAStatus DdiMedia_QuerySurfaceStatus (
             return VA_STATUS_SUCCESS;
         }
     }
+    DDI_CHK_RET(DdiMedia_WaitPendingDecode(mediaCtx, surface), "Pending decode of surface failed!");
 
     // Query the busy state of bo.
     // check the bo here?
@@ -4805,6 +4860,7 @@ VAStatus DdiMedia_DeriveImage (
 
     DDI_MEDIA_SURFACE *mediaSurface = DdiMedia_GetSurfaceFromVASurfaceID(mediaCtx, surface);
     DDI_CHK_NULL(mediaSurface, "nullptr mediaSurface", VA_STATUS_ERROR_INVALID_SURFACE);
+    DDI_CHK_RET(DdiMedia_WaitPendingDecode(mediaCtx, mediaSurface), "Pending decode of surface failed!");
 
     VAImage *vaimg                  = (VAImage*)MOS_AllocAndZeroMemory(sizeof(VAImage));
     DDI_CHK_NULL(vaimg, "nullptr vaimg", VA_STATUS_ERROR_ALLOCATION_FAILED);
@@ -5159,6 +5215,21 @@ VAStatus SwizzleSurface(PDDI_MEDIA_CONTEXT mediaCtx, PGMM_RESOURCE_INFO pGmmResI
     DDI_CHK_NULL(pLockedAddr, "pLockedAddr is NULL", VA_STATUS_ERROR_OPERATION_FAILED);
     DDI_CHK_NULL(pResourceBase, "pResourceBase is NULL", VA_STATUS_ERROR_ALLOCATION_FAILED);
 
+    // Legacy tile Y surfaces made of whole tile rows are converted by the SIMD tile engine,
+    // other layouts go through GMM CpuBlt.
+    uiPitch = pGmmResInfo->GetRenderPitch();
+    size_t mainSurfaceSize = (size_t)pGmmResInfo->GetSizeMainSurface();
+    if (pGmmResInfo->GetTileType() == GMM_TILED_Y &&
+        DdiMediaSwizzle_IsTileYLayoutSupported(uiPitch, mainSurfaceSize))
+    {
+        DdiMediaSwizzle_TileY((uint8_t *)pLockedAddr,
+                              pResourceBase,
+                              uiPitch,
+                              (uint32_t)(mainSurfaceSize / uiPitch),
+                              bUpload);
+        return vaStatus;
+    }
+
     memset(&gmmResCopyBlt, 0x0, sizeof(GMM_RES_COPY_BLT));
     uiPicHeight = pGmmResInfo->GetBaseHeight();
     uiSize = pGmmResInfo->GetSizeSurface();
@@ -5183,8 +5254,10 @@ VAStatus SwizzleSurface(PDDI_MEDIA_CONTEXT mediaCtx, PGMM_RESOURCE_INFO pGmmResI
 }
 
 //!
-//! \brief  Copy plane from src to dst row by row when src and dst strides are different
+//! \brief  Copy plane from src to dst, row by row when src and dst strides are different
 //!
+//! \param  [in] mediaCtx
+//!         Pointer to ddi media context
 //! \param  [in] dst
 //!         Destination plane
 //! \param  [in] dstPitch
@@ -5197,19 +5270,14 @@ VAStatus SwizzleSurface(PDDI_MEDIA_CONTEXT mediaCtx, PGMM_RESOURCE_INFO pGmmResI
 //!         Plane hight
 //!
 static void DdiMedia_CopyPlane(
+    PDDI_MEDIA_CONTEXT mediaCtx,
     uint8_t *dst,
     uint32_t dstPitch,
     uint8_t *src,
     uint32_t srcPitch,
     uint32_t height)
 {
-    uint32_t rowSize = std::min(dstPitch, srcPitch);
-    for (int y = 0; y < height; y += 1)
-    {
-        memcpy(dst, src, rowSize);
-        dst += dstPitch;
-        src += srcPitch;
-    }
+    DdiMediaCopyPool_CopyPlane(mediaCtx, dst, dstPitch, src, srcPitch, height);
 }
 
 //!
@@ -5250,7 +5318,12 @@ static VAStatus DdiMedia_CopySurfaceToImage(
         }
     }
 
-    if (image->format.fourcc != VA_FOURCC_NV12)
+    // When SW swizzling is in use, the lock itself hands back a linear copy of
+    // a TileY surface (vebox tile convert to the shadow buffer on local memory),
+    // so there is no need to map raw tiles and swizzle them again here.
+    bool lockDetiles = surface->pMediaCtx->m_useSwSwizzling && surface->TileType == I915_TILING_Y;
+
+    if (image->format.fourcc != VA_FOURCC_NV12 && !lockDetiles)
        flag = flag | MOS_LOCKFLAG_NO_SWIZZLE;
 
     void* surfData = DdiMediaUtil_LockSurface(surface, flag);
@@ -5275,7 +5348,7 @@ static VAStatus DdiMedia_CopySurfaceToImage(
 
     uint8_t* swizzleData = nullptr;
 
-    if (!surface->pMediaCtx->bIsAtomSOC && surface->TileType != I915_TILING_NONE && image->format.fourcc != VA_FOURCC_NV12)
+    if (!surface->pMediaCtx->bIsAtomSOC && surface->TileType != I915_TILING_NONE && image->format.fourcc != VA_FOURCC_NV12 && !lockDetiles)
     {
         swizzleData = (uint8_t*)MOS_AllocMemory(surface->data_size);
         if (nullptr != swizzleData)
@@ -5296,7 +5369,7 @@ static VAStatus DdiMedia_CopySurfaceToImage(
         ySrc = (uint8_t*)surfData;
     }
 
-    DdiMedia_CopyPlane(yDst, image->pitches[0], ySrc, surface->iPitch, image->height);
+    DdiMedia_CopyPlane(mediaCtx, yDst, image->pitches[0], ySrc, surface->iPitch, image->height);
     if (image->num_planes > 1)
     {
         uint8_t *uSrc = ySrc + surface->iPitch * surface->iHeight;
@@ -5307,13 +5380,13 @@ static VAStatus DdiMedia_CopySurfaceToImage(
         uint32_t imageChromaHeight = 0;
         DdiMedia_GetChromaPitchHeight(DdiMedia_MediaFormatToOsFormat(surface->format), surface->iPitch, surface->iHeight, &chromaPitch, &chromaHeight);
         DdiMedia_GetChromaPitchHeight(image->format.fourcc, image->pitches[0], image->height, &imageChromaPitch, &imageChromaHeight);
-        DdiMedia_CopyPlane(uDst, image->pitches[1], uSrc, chromaPitch, imageChromaHeight);
+        DdiMedia_CopyPlane(mediaCtx, uDst, image->pitches[1], uSrc, chromaPitch, imageChromaHeight);
 
         if(image->num_planes > 2)
         {
             uint8_t *vSrc = uSrc + chromaPitch * chromaHeight;
             uint8_t *vDst = yDst + image->offsets[2];
-            DdiMedia_CopyPlane(vDst, image->pitches[2], vSrc, chromaPitch, imageChromaHeight);
+            DdiMedia_CopyPlane(mediaCtx, vDst, image->pitches[2], vSrc, chromaPitch, imageChromaHeight);
         }
     }
 
@@ -5390,6 +5463,7 @@ VAStatus DdiMedia_GetImage(
     DDI_MEDIA_SURFACE *inputSurface = DdiMedia_GetSurfaceFromVASurfaceID(mediaCtx, surface);
     DDI_CHK_NULL(inputSurface,     "nullptr inputSurface.",      VA_STATUS_ERROR_INVALID_SURFACE);
     DDI_CHK_NULL(inputSurface->bo, "nullptr inputSurface->bo.",  VA_STATUS_ERROR_INVALID_SURFACE);
+    DDI_CHK_RET(DdiMedia_WaitPendingDecode(mediaCtx, inputSurface), "Pending decode of surface failed!");
 
     VAStatus vaStatus = VA_STATUS_SUCCESS;
 #ifndef _FULL_OPEN_SOURCE
@@ -5688,7 +5762,7 @@ VAStatus DdiMedia_PutImage(
         {
             uint8_t *ySrc = (uint8_t *)imageData + vaimg->offsets[0];
             uint8_t *yDst = (uint8_t *)surfData;
-            DdiMedia_CopyPlane(yDst, mediaSurface->iPitch, ySrc, vaimg->pitches[0], src_height);
+            DdiMedia_CopyPlane(mediaCtx, yDst, mediaSurface->iPitch, ySrc, vaimg->pitches[0], src_height);
 
             if (vaimg->num_planes > 1)
             {
@@ -5703,12 +5777,12 @@ VAStatus DdiMedia_PutImage(
 
                 uint8_t *uSrc = (uint8_t *)imageData + vaimg->offsets[1];
                 uint8_t *uDst = yDst + mediaSurface->iPitch * mediaSurface->iHeight;
-                DdiMedia_CopyPlane(uDst, chromaPitch, uSrc, vaimg->pitches[1], chromaHeight);
+                DdiMedia_CopyPlane(mediaCtx, uDst, chromaPitch, uSrc, vaimg->pitches[1], chromaHeight);
                 if (vaimg->num_planes > 2)
                 {
                     uint8_t *vSrc = (uint8_t *)imageData + vaimg->offsets[2];
                     uint8_t *vDst = uDst + chromaPitch * chromaHeight;
-                    DdiMedia_CopyPlane(vDst, chromaPitch, vSrc, vaimg->pitches[2], chromaHeight);
+                    DdiMedia_CopyPlane(mediaCtx, vDst, chromaPitch, vSrc, vaimg->pitches[2], chromaHeight);
                 }
             }
         } 
@@ -7200,6 +7274,8 @@ VAStatus DdiMedia_ExportSurfaceHandle(
         return VA_STATUS_ERROR_UNSUPPORTED_MEMORY_TYPE;
     }
 
+    DDI_CHK_RET(DdiMedia_WaitPendingDecode(mediaCtx, mediaSurface), "Pending decode of surface failed!");
+
     if (mos_bo_gem_export_to_prime(mediaSurface->bo, (int32_t*)&mediaSurface->name))
     {
         DDI_ASSERTMESSAGE("Failed drm_intel_gem_export_to_prime operation!!!\n");
@@ -142,12 +142,9 @@ DDI_MEDIA_SURFACE* DdiMedia_GetSurfaceFromVASurfaceID (PDDI_MEDIA_CONTEXT mediaC
     bool validSurface = (i != VA_INVALID_SURFACE);
     if(validSurface)
     {
-        DDI_CHK_LESS(i, mediaCtx->pSurfaceHeap->uiAllocatedHeapElements, "invalid surface id", nullptr);
-        DdiMediaUtil_LockMutex(&mediaCtx->SurfaceMutex);
-        surfaceElement  = (PDDI_MEDIA_SURFACE_HEAP_ELEMENT)mediaCtx->pSurfaceHeap->pHeapBase;
-        surfaceElement += i;
+        surfaceElement  = (PDDI_MEDIA_SURFACE_HEAP_ELEMENT)DdiMediaUtil_GetHeapElement(mediaCtx->pSurfaceHeap, i);
+        DDI_CHK_NULL(surfaceElement, "invalid surface id", nullptr);
         surface         = surfaceElement->pSurface;
-        DdiMediaUtil_UnLockMutex(&mediaCtx->SurfaceMutex);
     }
 
     return surface;
@@ -339,12 +336,9 @@ DDI_MEDIA_BUFFER* DdiMedia_GetBufferFromVABufferID (PDDI_MEDIA_CONTEXT mediaCtx,
     PDDI_MEDIA_BUFFER              buf = nullptr;
 
     i                = (uint32_t)bufferID;
-    DDI_CHK_LESS(i, mediaCtx->pBufferHeap->uiAllocatedHeapElements, "invalid buffer id", nullptr);
-    DdiMediaUtil_LockMutex(&mediaCtx->BufferMutex);
-    bufHeapElement  = (PDDI_MEDIA_BUFFER_HEAP_ELEMENT)mediaCtx->pBufferHeap->pHeapBase;
-    bufHeapElement += i;
+    bufHeapElement  = (PDDI_MEDIA_BUFFER_HEAP_ELEMENT)DdiMediaUtil_GetHeapElement(mediaCtx->pBufferHeap, i);
+    DDI_CHK_NULL(bufHeapElement, "invalid buffer id", nullptr);
     buf             = bufHeapElement->pBuffer;
-    DdiMediaUtil_UnLockMutex(&mediaCtx->BufferMutex);
 
     return buf;
 }
@@ -365,12 +359,9 @@ void* DdiMedia_GetContextFromVABufferID (PDDI_MEDIA_CONTEXT mediaCtx, VABufferID
     void *                         ctx;
 
     i                = (uint32_t)bufferID;
-    DDI_CHK_LESS(i, mediaCtx->pBufferHeap->uiAllocatedHeapElements, "invalid buffer id", nullptr);
-    DdiMediaUtil_LockMutex(&mediaCtx->BufferMutex);
-    bufHeapElement  = (PDDI_MEDIA_BUFFER_HEAP_ELEMENT)mediaCtx->pBufferHeap->pHeapBase;
-    bufHeapElement += bufferID;
+    bufHeapElement  = (PDDI_MEDIA_BUFFER_HEAP_ELEMENT)DdiMediaUtil_GetHeapElement(mediaCtx->pBufferHeap, i);
+    DDI_CHK_NULL(bufHeapElement, "invalid buffer id", nullptr);
     ctx            = bufHeapElement->pCtx;
-    DdiMediaUtil_UnLockMutex(&mediaCtx->BufferMutex);
 
     return ctx;
 }
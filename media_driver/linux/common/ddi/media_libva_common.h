@@ -389,12 +389,19 @@ typedef struct _DDI_MEDIA_VACONTEXT_HEAP_ELEMENT
     struct _DDI_MEDIA_VACONTEXT_HEAP_ELEMENT   *pNextFree;
 }DDI_MEDIA_VACONTEXT_HEAP_ELEMENT, *PDDI_MEDIA_VACONTEXT_HEAP_ELEMENT;
 
+typedef struct _DDI_MEDIA_HEAP_RETIRED_BASE
+{
+    void                                *pHeapBase;
+    struct _DDI_MEDIA_HEAP_RETIRED_BASE *pNext;
+}DDI_MEDIA_HEAP_RETIRED_BASE, *PDDI_MEDIA_HEAP_RETIRED_BASE;
+
 typedef struct _DDI_MEDIA_HEAP
 {
     void               *pHeapBase;
     uint32_t            uiHeapElementSize;
     uint32_t            uiAllocatedHeapElements;
     void               *pFirstFreeHeapElement;
+    PDDI_MEDIA_HEAP_RETIRED_BASE pRetiredHeapBases;   // bases replaced on growth, kept until heap destroy for lock-free lookups
 }DDI_MEDIA_HEAP, *PDDI_MEDIA_HEAP;
 
 #ifndef ANDROID
@@ -491,6 +498,9 @@ struct DDI_MEDIA_CONTEXT
     // Media copy data structure
     void               *pMediaCopyState         = nullptr;
 
+    // Worker pool for CPU plane copies in vaGetImage/vaPutImage
+    struct _DDI_MEDIA_COPY_POOL *pCopyPool     = nullptr;
+
     // Perf tag
     PERF_DATA          *perfData                = nullptr;
 
@@ -621,6 +631,19 @@ void* DdiMedia_GetContextFromContextID (VADriverContextP ctx, VAContextID vaCtxI
 //!
 DDI_MEDIA_SURFACE* DdiMedia_GetSurfaceFromVASurfaceID (PDDI_MEDIA_CONTEXT mediaCtx, VASurfaceID surfaceID);
 
+//!
+//! \brief  Wait for pending pipelined decode which outputs to the surface
+//!
+//! \param  [in] mediaCtx
+//!     Pointer to ddi media context
+//! \param  [in] surface
+//!     Pointer to ddi media surface
+//!
+//! \return VAStatus
+//!     VA_STATUS_SUCCESS if success, else fail reason
+//!
+VAStatus DdiMedia_WaitPendingDecode(PDDI_MEDIA_CONTEXT mediaCtx, DDI_MEDIA_SURFACE *surface);
+
 //!
 //! \brief  replace the surface with given format
 //!
@@ -0,0 +1,202 @@
+/*
+* Copyright (c) 2022, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file      media_libva_copy_pool.cpp
+//! \brief     Worker pool used to split large CPU plane copies into row bands
+//!
+
+#include <stdlib.h>
+#include "media_libva_copy_pool.h"
+#include "media_libva_util.h"
+#include "cm_mem.h"
+
+static void DdiMediaCopyPool_CopyRows(const DDI_MEDIA_COPY_TASK *task)
+{
+    static const CPU_INSTRUCTION_LEVEL cpuInstructionLevel = GetCpuInstructionLevel();
+
+    uint8_t *dst = task->dst;
+    uint8_t *src = task->src;
+
+    if (task->dstPitch == task->srcPitch)
+    {
+        CmFastMemCopyFromWC(dst, src, (size_t)task->srcPitch * task->height, cpuInstructionLevel);
+        return;
+    }
+
+    uint32_t rowSize = MOS_MIN(task->dstPitch, task->srcPitch);
+    for (uint32_t y = 0; y < task->height; y++)
+    {
+        CmFastMemCopyFromWC(dst, src, rowSize, cpuInstructionLevel);
+        dst += task->dstPitch;
+        src += task->srcPitch;
+    }
+}
+
+static void *DdiMediaCopyPool_WorkerThread(void *data)
+{
+    PDDI_MEDIA_COPY_WORKER worker = (PDDI_MEDIA_COPY_WORKER)data;
+    PDDI_MEDIA_COPY_POOL   pool   = worker->pool;
+
+    while (true)
+    {
+        DdiMediaUtil_WaitSemaphore(&worker->startSem);
+        if (pool->exit)
+        {
+            break;
+        }
+
+        DdiMediaCopyPool_CopyRows(&worker->task);
+        DdiMediaUtil_PostSemaphore(&pool->doneSem);
+    }
+
+    return nullptr;
+}
+
+static void DdiMediaCopyPool_StartWorkers(PDDI_MEDIA_COPY_POOL pool)
+{
+    while (pool->numWorkers < pool->maxWorkers)
+    {
+        PDDI_MEDIA_COPY_WORKER worker = &pool->workers[pool->numWorkers];
+        worker->pool = pool;
+        sem_init(&worker->startSem, 0, 0);
+
+        if (pthread_create(&worker->thread, nullptr, DdiMediaCopyPool_WorkerThread, worker) != 0)
+        {
+            DDI_NORMALMESSAGE("Failed to create plane copy worker, use %d workers.", pool->numWorkers);
+            DdiMediaUtil_DestroySemaphore(&worker->startSem);
+            pool->maxWorkers = pool->numWorkers;
+            break;
+        }
+        pool->numWorkers++;
+    }
+}
+
+VAStatus DdiMediaCopyPool_Create(PDDI_MEDIA_CONTEXT mediaCtx)
+{
+    DDI_CHK_NULL(mediaCtx, "nullptr mediaCtx", VA_STATUS_ERROR_INVALID_CONTEXT);
+
+    PDDI_MEDIA_COPY_POOL pool = (PDDI_MEDIA_COPY_POOL)MOS_AllocAndZeroMemory(sizeof(DDI_MEDIA_COPY_POOL));
+    DDI_CHK_NULL(pool, "nullptr pool", VA_STATUS_ERROR_ALLOCATION_FAILED);
+
+    DdiMediaUtil_InitMutex(&pool->mutex);
+    sem_init(&pool->doneSem, 0, 0);
+
+    uint32_t coreNum = MosUtilities::MosGetLogicalCoreNumber();
+    pool->maxWorkers = (coreNum > 1) ? MOS_MIN(coreNum - 1, DDI_MEDIA_COPY_POOL_MAX_WORKERS) : 0;
+    pool->threshold  = DDI_MEDIA_COPY_POOL_DEFAULT_THRESHOLD;
+
+    // Plane size in bytes above which plane copies are split in bands, 0 to disable
+    char *thresholdEnv = getenv("INTEL_MEDIA_COPY_MT_THRESHOLD");
+    if (thresholdEnv)
+    {
+        pool->threshold = (size_t)strtoull(thresholdEnv, nullptr, 0);
+    }
+
+    mediaCtx->pCopyPool = pool;
+    return VA_STATUS_SUCCESS;
+}
+
+void DdiMediaCopyPool_Destroy(PDDI_MEDIA_CONTEXT mediaCtx)
+{
+    DDI_CHK_NULL(mediaCtx, "nullptr mediaCtx", );
+
+    PDDI_MEDIA_COPY_POOL pool = mediaCtx->pCopyPool;
+    if (pool == nullptr)
+    {
+        return;
+    }
+
+    DdiMediaUtil_LockMutex(&pool->mutex);
+    pool->exit = true;
+    for (uint32_t i = 0; i < pool->numWorkers; i++)
+    {
+        DdiMediaUtil_PostSemaphore(&pool->workers[i].startSem);
+    }
+    for (uint32_t i = 0; i < pool->numWorkers; i++)
+    {
+        pthread_join(pool->workers[i].thread, nullptr);
+        DdiMediaUtil_DestroySemaphore(&pool->workers[i].startSem);
+    }
+    DdiMediaUtil_UnLockMutex(&pool->mutex);
+
+    DdiMediaUtil_DestroySemaphore(&pool->doneSem);
+    DdiMediaUtil_DestroyMutex(&pool->mutex);
+    MOS_FreeMemory(pool);
+    mediaCtx->pCopyPool = nullptr;
+}
+
+void DdiMediaCopyPool_CopyPlane(
+    PDDI_MEDIA_CONTEXT mediaCtx,
+    uint8_t           *dst,
+    uint32_t           dstPitch,
+    uint8_t           *src,
+    uint32_t           srcPitch,
+    uint32_t           height)
+{
+    DDI_MEDIA_COPY_TASK task = {dst, dstPitch, src, srcPitch, height};
+
+    PDDI_MEDIA_COPY_POOL pool = mediaCtx ? mediaCtx->pCopyPool : nullptr;
+    size_t planeSize = (size_t)MOS_MIN(dstPitch, srcPitch) * height;
+    if (pool == nullptr || pool->maxWorkers == 0 || pool->threshold == 0 || planeSize < pool->threshold)
+    {
+        DdiMediaCopyPool_CopyRows(&task);
+        return;
+    }
+
+    // Another thread owns the workers, copying on the calling thread beats waiting for them
+    if (pthread_mutex_trylock(&pool->mutex) != 0)
+    {
+        DdiMediaCopyPool_CopyRows(&task);
+        return;
+    }
+
+    DdiMediaCopyPool_StartWorkers(pool);
+
+    uint32_t numBands   = pool->numWorkers + 1;
+    uint32_t bandHeight = (height + numBands - 1) / numBands;
+    uint32_t startRow   = bandHeight;
+    uint32_t numPosted  = 0;
+
+    for (uint32_t i = 0; i < pool->numWorkers && startRow < height; i++)
+    {
+        PDDI_MEDIA_COPY_TASK workerTask = &pool->workers[i].task;
+        workerTask->dst      = dst + (size_t)startRow * dstPitch;
+        workerTask->dstPitch = dstPitch;
+        workerTask->src      = src + (size_t)startRow * srcPitch;
+        workerTask->srcPitch = srcPitch;
+        workerTask->height   = MOS_MIN(bandHeight, height - startRow);
+        startRow += workerTask->height;
+
+        DdiMediaUtil_PostSemaphore(&pool->workers[i].startSem);
+        numPosted++;
+    }
+
+    task.height = MOS_MIN(bandHeight, height);
+    DdiMediaCopyPool_CopyRows(&task);
+
+    for (uint32_t i = 0; i < numPosted; i++)
+    {
+        DdiMediaUtil_WaitSemaphore(&pool->doneSem);
+    }
+
+    DdiMediaUtil_UnLockMutex(&pool->mutex);
+}
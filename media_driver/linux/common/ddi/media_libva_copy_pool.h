@@ -0,0 +1,110 @@
+/*
+* Copyright (c) 2022, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file      media_libva_copy_pool.h
+//! \brief     Worker pool used to split large CPU plane copies into row bands
+//!
+#ifndef __MEDIA_LIBVA_COPY_POOL_H__
+#define __MEDIA_LIBVA_COPY_POOL_H__
+
+#include "media_libva_common.h"
+
+#define DDI_MEDIA_COPY_POOL_MAX_WORKERS         3                   // worker threads, the caller copies one more band
+#define DDI_MEDIA_COPY_POOL_DEFAULT_THRESHOLD   (4 * 1024 * 1024)   // plane size in bytes above which bands are used
+
+typedef struct _DDI_MEDIA_COPY_POOL DDI_MEDIA_COPY_POOL, *PDDI_MEDIA_COPY_POOL;
+
+typedef struct _DDI_MEDIA_COPY_TASK
+{
+    uint8_t            *dst;
+    uint32_t            dstPitch;
+    uint8_t            *src;
+    uint32_t            srcPitch;
+    uint32_t            height;
+} DDI_MEDIA_COPY_TASK, *PDDI_MEDIA_COPY_TASK;
+
+typedef struct _DDI_MEDIA_COPY_WORKER
+{
+    PDDI_MEDIA_COPY_POOL pool;
+    pthread_t            thread;
+    MEDIA_SEM_T          startSem;
+    DDI_MEDIA_COPY_TASK  task;
+} DDI_MEDIA_COPY_WORKER, *PDDI_MEDIA_COPY_WORKER;
+
+struct _DDI_MEDIA_COPY_POOL
+{
+    MEDIA_MUTEX_T        mutex;                                 // serializes users of the pool
+    MEDIA_SEM_T          doneSem;                               // posted by a worker when its band is copied
+    DDI_MEDIA_COPY_WORKER workers[DDI_MEDIA_COPY_POOL_MAX_WORKERS];
+    uint32_t             maxWorkers;                            // workers allowed on this CPU
+    uint32_t             numWorkers;                            // workers started so far, started on first use
+    size_t               threshold;                             // 0 disables banded copies
+    bool                 exit;
+};
+
+//!
+//! \brief  Create the plane copy pool, worker threads are started on first use
+//!
+//! \param  [in] mediaCtx
+//!         Pointer to ddi media context
+//!
+//! \return VAStatus
+//!     VA_STATUS_SUCCESS if success, else fail reason
+//!
+VAStatus DdiMediaCopyPool_Create(PDDI_MEDIA_CONTEXT mediaCtx);
+
+//!
+//! \brief  Stop the worker threads and destroy the plane copy pool
+//!
+//! \param  [in] mediaCtx
+//!         Pointer to ddi media context
+//!
+void DdiMediaCopyPool_Destroy(PDDI_MEDIA_CONTEXT mediaCtx);
+
+//!
+//! \brief  Copy a plane from src to dst
+//! \details Planes with matching pitches are copied in one go, otherwise row by row.
+//!          Planes above the pool threshold are split in row bands copied in parallel.
+//!          Rows are read with streaming loads since surfaces may be mapped write-combined.
+//!
+//! \param  [in] mediaCtx
+//!         Pointer to ddi media context
+//! \param  [in] dst
+//!         Destination plane
+//! \param  [in] dstPitch
+//!         Destination plane pitch
+//! \param  [in] src
+//!         Source plane
+//! \param  [in] srcPitch
+//!         Source plane pitch
+//! \param  [in] height
+//!         Plane height
+//!
+void DdiMediaCopyPool_CopyPlane(
+    PDDI_MEDIA_CONTEXT mediaCtx,
+    uint8_t           *dst,
+    uint32_t           dstPitch,
+    uint8_t           *src,
+    uint32_t           srcPitch,
+    uint32_t           height);
+
+#endif //__MEDIA_LIBVA_COPY_POOL_H__
@@ -0,0 +1,96 @@
+/*
+* Copyright (c) 2022, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file      media_libva_swizzle.cpp
+//! \brief     CPU tile-Y swizzle/de-swizzle helpers used when HW swizzling is unavailable
+//!
+
+#include <string.h>
+#include <cpuid.h>
+#include "media_libva_swizzle.h"
+
+typedef void (*t_DdiMediaSwizzleTileY)(uint8_t *tiled, uint8_t *linear, uint32_t pitch, uint32_t height, bool upload);
+
+static bool DdiMediaSwizzle_IsSSE4Available()
+{
+    uint32_t eax = 0, ebx = 0, ecx = 0, edx = 0;
+
+    if (__get_cpuid(1, &eax, &ebx, &ecx, &edx) == 0)
+    {
+        return false;
+    }
+
+    return (ecx & bit_SSE4_1) != 0;
+}
+
+bool DdiMediaSwizzle_IsTileYLayoutSupported(uint32_t pitch, size_t size)
+{
+    if (pitch == 0 || (pitch % DDI_TILEY_WIDTH_BYTES) != 0)
+    {
+        return false;
+    }
+
+    size_t tileRowSize = (size_t)pitch * DDI_TILEY_HEIGHT_ROWS;
+    return (size != 0) && ((size % tileRowSize) == 0);
+}
+
+void DdiMediaSwizzle_TileY_C(uint8_t *tiled, uint8_t *linear, uint32_t pitch, uint32_t height, bool upload)
+{
+    uint32_t tilesPerRow = pitch / DDI_TILEY_WIDTH_BYTES;
+    uint32_t tileRows    = height / DDI_TILEY_HEIGHT_ROWS;
+
+    for (uint32_t ty = 0; ty < tileRows; ty++)
+    {
+        uint8_t *linearTileRow = linear + (size_t)ty * DDI_TILEY_HEIGHT_ROWS * pitch;
+        for (uint32_t tx = 0; tx < tilesPerRow; tx++)
+        {
+            uint8_t *tile       = tiled + ((size_t)ty * tilesPerRow + tx) * DDI_TILEY_SIZE_BYTES;
+            uint8_t *linearTile = linearTileRow + tx * DDI_TILEY_WIDTH_BYTES;
+            for (uint32_t c = 0; c < DDI_TILEY_COLUMNS; c++)
+            {
+                uint8_t *column    = tile + c * DDI_TILEY_COLUMN_BYTES;
+                uint8_t *linearPtr = linearTile + c * DDI_TILEY_OWORD_BYTES;
+                for (uint32_t y = 0; y < DDI_TILEY_HEIGHT_ROWS; y++)
+                {
+                    if (upload)
+                    {
+                        memcpy(column, linearPtr, DDI_TILEY_OWORD_BYTES);
+                    }
+                    else
+                    {
+                        memcpy(linearPtr, column, DDI_TILEY_OWORD_BYTES);
+                    }
+                    column    += DDI_TILEY_OWORD_BYTES;
+                    linearPtr += pitch;
+                }
+            }
+        }
+    }
+}
+
+void DdiMediaSwizzle_TileY(uint8_t *tiled, uint8_t *linear, uint32_t pitch, uint32_t height, bool upload)
+{
+    static const t_DdiMediaSwizzleTileY swizzleTileYImpl =
+        DdiMediaSwizzle_IsSSE4Available() ? DdiMediaSwizzle_TileY_SSE4 : DdiMediaSwizzle_TileY_C;
+
+    swizzleTileYImpl(tiled, linear, pitch, height, upload);
+}
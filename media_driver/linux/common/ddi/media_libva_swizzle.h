@@ -0,0 +1,72 @@
+/*
+* Copyright (c) 2022, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file      media_libva_swizzle.h
+//! \brief     CPU tile-Y swizzle/de-swizzle helpers used when HW swizzling is unavailable
+//!
+#ifndef __MEDIA_LIBVA_SWIZZLE_H__
+#define __MEDIA_LIBVA_SWIZZLE_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define DDI_TILEY_WIDTH_BYTES   128                                         // A tile Y is 128B wide
+#define DDI_TILEY_HEIGHT_ROWS   32                                          // and 32 rows high
+#define DDI_TILEY_OWORD_BYTES   16                                          // organized as 16B wide columns
+#define DDI_TILEY_COLUMN_BYTES  (DDI_TILEY_OWORD_BYTES * DDI_TILEY_HEIGHT_ROWS)
+#define DDI_TILEY_COLUMNS       (DDI_TILEY_WIDTH_BYTES / DDI_TILEY_OWORD_BYTES)
+#define DDI_TILEY_SIZE_BYTES    (DDI_TILEY_WIDTH_BYTES * DDI_TILEY_HEIGHT_ROWS)
+
+//!
+//! \brief  Check whether a surface layout can be handled by DdiMediaSwizzle_TileY
+//!
+//! \param  [in] pitch
+//!         Surface pitch in bytes
+//! \param  [in] size
+//!         Main surface size in bytes
+//!
+//! \return bool
+//!     true if the surface is made of whole tile Y rows, else false
+//!
+bool DdiMediaSwizzle_IsTileYLayoutSupported(uint32_t pitch, size_t size);
+
+//!
+//! \brief  Convert between tile Y and linear layouts on CPU, whole 4KB tiles at a time
+//!
+//! \param  [in] tiled
+//!         Tiled surface base, must be 4KB aligned
+//! \param  [in] linear
+//!         Linear buffer base, using the same pitch as the tiled surface
+//! \param  [in] pitch
+//!         Surface pitch in bytes, multiple of the tile width
+//! \param  [in] height
+//!         Surface height in rows, multiple of the tile height
+//! \param  [in] upload
+//!         true to copy from linear to tiled, false to copy from tiled to linear
+//!
+void DdiMediaSwizzle_TileY(uint8_t *tiled, uint8_t *linear, uint32_t pitch, uint32_t height, bool upload);
+
+void DdiMediaSwizzle_TileY_C(uint8_t *tiled, uint8_t *linear, uint32_t pitch, uint32_t height, bool upload);
+
+void DdiMediaSwizzle_TileY_SSE4(uint8_t *tiled, uint8_t *linear, uint32_t pitch, uint32_t height, bool upload);
+
+#endif //__MEDIA_LIBVA_SWIZZLE_H__
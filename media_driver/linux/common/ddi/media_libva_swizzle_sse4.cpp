@@ -0,0 +1,142 @@
+/*
+* Copyright (c) 2022, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+//!
+//! \file      media_libva_swizzle_sse4.cpp
+//! \brief     SSE4.1 implementation of the CPU tile-Y swizzle/de-swizzle helpers
+//!
+
+#include "media_libva_swizzle.h"
+
+#if defined(__SSE4_1__)
+
+#include <smmintrin.h>
+
+//!
+//! \brief  De-swizzle one 4KB tile into the linear buffer
+//! \details The tile is first read sequentially with streaming loads into a cached bounce
+//!          buffer, since the tiled surface is usually mapped write-combined. Each 128B tile
+//!          row is then written out as two full cache lines with non-temporal stores so the
+//!          destination image does not pollute the cache.
+//!
+static inline void DdiMediaSwizzle_DetileY_SSE4(uint8_t *tile, uint8_t *linear, uint32_t pitch, bool streamStore)
+{
+    alignas(64) __m128i bounce[DDI_TILEY_SIZE_BYTES / sizeof(__m128i)];
+    __m128i *src = (__m128i *)tile;
+
+    for (uint32_t i = 0; i < DDI_TILEY_SIZE_BYTES / sizeof(__m128i); i += 4)
+    {
+        bounce[i]     = _mm_stream_load_si128(src + i);
+        bounce[i + 1] = _mm_stream_load_si128(src + i + 1);
+        bounce[i + 2] = _mm_stream_load_si128(src + i + 2);
+        bounce[i + 3] = _mm_stream_load_si128(src + i + 3);
+    }
+
+    const uint32_t columnStride = DDI_TILEY_COLUMN_BYTES / sizeof(__m128i);
+    for (uint32_t y = 0; y < DDI_TILEY_HEIGHT_ROWS; y++)
+    {
+        __m128i *dst = (__m128i *)(linear + (size_t)y * pitch);
+        __m128i *row = bounce + y;
+        if (streamStore)
+        {
+            for (uint32_t c = 0; c < DDI_TILEY_COLUMNS; c++)
+            {
+                _mm_stream_si128(dst + c, row[c * columnStride]);
+            }
+        }
+        else
+        {
+            for (uint32_t c = 0; c < DDI_TILEY_COLUMNS; c++)
+            {
+                _mm_storeu_si128(dst + c, row[c * columnStride]);
+            }
+        }
+    }
+}
+
+//!
+//! \brief  Swizzle one 4KB tile from the linear buffer
+//! \details Tile memory is written sequentially with non-temporal stores, so every cache
+//!          line of the tile is fully written before it is evicted.
+//!
+static inline void DdiMediaSwizzle_TileY_Upload_SSE4(uint8_t *tile, uint8_t *linear, uint32_t pitch)
+{
+    __m128i *dst = (__m128i *)tile;
+
+    for (uint32_t c = 0; c < DDI_TILEY_COLUMNS; c++)
+    {
+        uint8_t *src = linear + c * DDI_TILEY_OWORD_BYTES;
+        for (uint32_t y = 0; y < DDI_TILEY_HEIGHT_ROWS; y += 4)
+        {
+            __m128i xmm0 = _mm_loadu_si128((__m128i *)(src));
+            __m128i xmm1 = _mm_loadu_si128((__m128i *)(src + pitch));
+            __m128i xmm2 = _mm_loadu_si128((__m128i *)(src + 2 * (size_t)pitch));
+            __m128i xmm3 = _mm_loadu_si128((__m128i *)(src + 3 * (size_t)pitch));
+            src += 4 * (size_t)pitch;
+
+            _mm_stream_si128(dst,     xmm0);
+            _mm_stream_si128(dst + 1, xmm1);
+            _mm_stream_si128(dst + 2, xmm2);
+            _mm_stream_si128(dst + 3, xmm3);
+            dst += 4;
+        }
+    }
+}
+
+void DdiMediaSwizzle_TileY_SSE4(uint8_t *tiled, uint8_t *linear, uint32_t pitch, uint32_t height, bool upload)
+{
+    // Streaming loads need 16B aligned tiles, fall back to C path otherwise
+    if (((uintptr_t)tiled & (sizeof(__m128i) - 1)) != 0)
+    {
+        DdiMediaSwizzle_TileY_C(tiled, linear, pitch, height, upload);
+        return;
+    }
+
+    uint32_t tilesPerRow = pitch / DDI_TILEY_WIDTH_BYTES;
+    uint32_t tileRows    = height / DDI_TILEY_HEIGHT_ROWS;
+    bool     linearAligned = ((uintptr_t)linear & (sizeof(__m128i) - 1)) == 0;
+
+    // Sync the WC memory data before issuing the MOVNTDQA instructions.
+    _mm_mfence();
+
+    for (uint32_t ty = 0; ty < tileRows; ty++)
+    {
+        uint8_t *linearTileRow = linear + (size_t)ty * DDI_TILEY_HEIGHT_ROWS * pitch;
+        uint8_t *tile          = tiled + (size_t)ty * tilesPerRow * DDI_TILEY_SIZE_BYTES;
+        for (uint32_t tx = 0; tx < tilesPerRow; tx++)
+        {
+            if (upload)
+            {
+                DdiMediaSwizzle_TileY_Upload_SSE4(tile, linearTileRow + tx * DDI_TILEY_WIDTH_BYTES, pitch);
+            }
+            else
+            {
+                DdiMediaSwizzle_DetileY_SSE4(tile, linearTileRow + tx * DDI_TILEY_WIDTH_BYTES, pitch, linearAligned);
+            }
+            tile += DDI_TILEY_SIZE_BYTES;
+        }
+    }
+
+    // Make the non-temporal stores globally visible before the caller unmaps or reads back
+    _mm_sfence();
+}
+
+#endif // __SSE4_1__
@@ -1339,19 +1339,26 @@ void DdiMediaUtil_UnlockSurfaceInternal(DDI_MEDIA_SURFACE  *surface)
         }
         else if (surface->pShadowBuffer != nullptr)
         {
-            SwizzleSurfaceByHW(surface, true);
+            // a read-only mapping leaves the shadow untouched, skip the write back
+            if (surface->uiMapFlag & MOS_LOCKFLAG_WRITEONLY)
+            {
+                SwizzleSurfaceByHW(surface, true);
+            }
 
             mos_bo_unmap(surface->pShadowBuffer->bo);
             mos_bo_unmap(surface->bo);
         }
         else if (surface->pSystemShadow)
         {
-            SwizzleSurface(surface->pMediaCtx,
-                           surface->pGmmResourceInfo,
-                           surface->bo->virt,
-                           (MOS_TILE_TYPE)surface->TileType,
-                           (uint8_t *)surface->pSystemShadow,
-                           true);
+            if (surface->uiMapFlag & MOS_LOCKFLAG_WRITEONLY)
+            {
+                SwizzleSurface(surface->pMediaCtx,
+                               surface->pGmmResourceInfo,
+                               surface->bo->virt,
+                               (MOS_TILE_TYPE)surface->TileType,
+                               (uint8_t *)surface->pSystemShadow,
+                               true);
+            }
 
             MOS_FreeMemory(surface->pSystemShadow);
             surface->pSystemShadow = nullptr;
@@ -1623,6 +1630,72 @@ void DdiMediaUtil_PostSemaphore(PMEDIA_SEM_T  sem)
 }
 
 // heap related
+//!
+//! \brief  Allocate a larger copy of the heap elements
+//! \details The heap grows geometrically into a new allocation instead of being
+//!          reallocated in place, the old base is retired by DdiMediaUtil_PublishHeap.
+//!
+static void *DdiMediaUtil_GrowHeap(PDDI_MEDIA_HEAP heap, uint32_t *growElements)
+{
+    uint32_t allocated   = heap->uiAllocatedHeapElements;
+    uint32_t grow        = MOS_MAX(allocated, DDI_MEDIA_HEAP_INCREMENTAL_SIZE);
+    size_t   usedSize    = (size_t)allocated * heap->uiHeapElementSize;
+    size_t   newHeapSize = (size_t)(allocated + grow) * heap->uiHeapElementSize;
+
+    uint8_t *newHeapBase = (uint8_t *)MOS_AllocAndZeroMemory(newHeapSize);
+    if (nullptr == newHeapBase)
+    {
+        DDI_ASSERTMESSAGE("DDI: heap allocation failed.");
+        return nullptr;
+    }
+
+    if (heap->pHeapBase)
+    {
+        MOS_SecureMemcpy(newHeapBase, usedSize, heap->pHeapBase, usedSize);
+    }
+
+    *growElements = grow;
+    return newHeapBase;
+}
+
+//!
+//! \brief  Publish a grown heap to lock-free readers
+//! \details The new base is published before the new element count, the old base
+//!          stays valid until DdiMediaUtil_FreeRetiredHeapBases.
+//!
+static VAStatus DdiMediaUtil_PublishHeap(PDDI_MEDIA_HEAP heap, void *newHeapBase, uint32_t growElements)
+{
+    if (heap->pHeapBase)
+    {
+        PDDI_MEDIA_HEAP_RETIRED_BASE retired = (PDDI_MEDIA_HEAP_RETIRED_BASE)MOS_AllocAndZeroMemory(sizeof(DDI_MEDIA_HEAP_RETIRED_BASE));
+        if (nullptr == retired)
+        {
+            MOS_FreeMemory(newHeapBase);
+            return VA_STATUS_ERROR_ALLOCATION_FAILED;
+        }
+        retired->pHeapBase      = heap->pHeapBase;
+        retired->pNext          = heap->pRetiredHeapBases;
+        heap->pRetiredHeapBases = retired;
+    }
+
+    __atomic_store_n(&heap->pHeapBase, newHeapBase, __ATOMIC_RELEASE);
+    __atomic_store_n(&heap->uiAllocatedHeapElements, heap->uiAllocatedHeapElements + growElements, __ATOMIC_RELEASE);
+    return VA_STATUS_SUCCESS;
+}
+
+void DdiMediaUtil_FreeRetiredHeapBases(PDDI_MEDIA_HEAP heap)
+{
+    DDI_CHK_NULL(heap, "nullptr heap", );
+
+    while (heap->pRetiredHeapBases)
+    {
+        PDDI_MEDIA_HEAP_RETIRED_BASE retired = heap->pRetiredHeapBases;
+        heap->pRetiredHeapBases = retired->pNext;
+        MOS_FreeMemory(retired->pHeapBase);
+        MOS_FreeMemory(retired);
+    }
+}
+
 PDDI_MEDIA_SURFACE_HEAP_ELEMENT DdiMediaUtil_AllocPMediaSurfaceFromHeap(PDDI_MEDIA_HEAP surfaceHeap)
 {
     DDI_CHK_NULL(surfaceHeap, "nullptr surfaceHeap", nullptr);
@@ -1631,23 +1704,24 @@ PDDI_MEDIA_SURFACE_HEAP_ELEMENT DdiMediaUtil_AllocPMediaSurfaceFromHeap(PDDI_MED
 
     if (nullptr == surfaceHeap->pFirstFreeHeapElement)
     {
-        void *newHeapBase = MOS_ReallocMemory(surfaceHeap->pHeapBase, (surfaceHeap->uiAllocatedHeapElements + DDI_MEDIA_HEAP_INCREMENTAL_SIZE) * sizeof(DDI_MEDIA_SURFACE_HEAP_ELEMENT));
-
-        if (nullptr == newHeapBase)
+        uint32_t growElements = 0;
+        PDDI_MEDIA_SURFACE_HEAP_ELEMENT surfaceHeapBase = (PDDI_MEDIA_SURFACE_HEAP_ELEMENT)DdiMediaUtil_GrowHeap(surfaceHeap, &growElements);
+        if (nullptr == surfaceHeapBase)
         {
-            DDI_ASSERTMESSAGE("DDI: realloc failed.");
             return nullptr;
         }
-        surfaceHeap->pHeapBase                    = newHeapBase;
-        PDDI_MEDIA_SURFACE_HEAP_ELEMENT surfaceHeapBase  = (PDDI_MEDIA_SURFACE_HEAP_ELEMENT)surfaceHeap->pHeapBase;
-        surfaceHeap->pFirstFreeHeapElement        = (void*)(&surfaceHeapBase[surfaceHeap->uiAllocatedHeapElements]);
-        for (int32_t i = 0; i < (DDI_MEDIA_HEAP_INCREMENTAL_SIZE); i++)
+        for (uint32_t i = 0; i < growElements; i++)
         {
             mediaSurfaceHeapElmt                  = &surfaceHeapBase[surfaceHeap->uiAllocatedHeapElements + i];
-            mediaSurfaceHeapElmt->pNextFree       = (i == (DDI_MEDIA_HEAP_INCREMENTAL_SIZE - 1))? nullptr : &surfaceHeapBase[surfaceHeap->uiAllocatedHeapElements + i + 1];
+            mediaSurfaceHeapElmt->pNextFree       = (i == (growElements - 1))? nullptr : &surfaceHeapBase[surfaceHeap->uiAllocatedHeapElements + i + 1];
             mediaSurfaceHeapElmt->uiVaSurfaceID   = surfaceHeap->uiAllocatedHeapElements + i;
         }
-        surfaceHeap->uiAllocatedHeapElements     += DDI_MEDIA_HEAP_INCREMENTAL_SIZE;
+        void *firstFree = (void*)(&surfaceHeapBase[surfaceHeap->uiAllocatedHeapElements]);
+        if (DdiMediaUtil_PublishHeap(surfaceHeap, surfaceHeapBase, growElements) != VA_STATUS_SUCCESS)
+        {
+            return nullptr;
+        }
+        surfaceHeap->pFirstFreeHeapElement        = firstFree;
     }
 
     mediaSurfaceHeapElmt                          = (PDDI_MEDIA_SURFACE_HEAP_ELEMENT)surfaceHeap->pFirstFreeHeapElement;
@@ -1681,22 +1755,24 @@ PDDI_MEDIA_BUFFER_HEAP_ELEMENT DdiMediaUtil_AllocPMediaBufferFromHeap(PDDI_MEDIA
     PDDI_MEDIA_BUFFER_HEAP_ELEMENT  mediaBufferHeapElmt = nullptr;
     if (nullptr == bufferHeap->pFirstFreeHeapElement)
     {
-        void *newHeapBase = MOS_ReallocMemory(bufferHeap->pHeapBase, (bufferHeap->uiAllocatedHeapElements + DDI_MEDIA_HEAP_INCREMENTAL_SIZE) * sizeof(DDI_MEDIA_BUFFER_HEAP_ELEMENT));
-        if (nullptr == newHeapBase)
+        uint32_t growElements = 0;
+        PDDI_MEDIA_BUFFER_HEAP_ELEMENT mediaBufferHeapBase = (PDDI_MEDIA_BUFFER_HEAP_ELEMENT)DdiMediaUtil_GrowHeap(bufferHeap, &growElements);
+        if (nullptr == mediaBufferHeapBase)
         {
-            DDI_ASSERTMESSAGE("DDI: realloc failed.");
             return nullptr;
         }
-        bufferHeap->pHeapBase                                 = newHeapBase;
-        PDDI_MEDIA_BUFFER_HEAP_ELEMENT mediaBufferHeapBase    = (PDDI_MEDIA_BUFFER_HEAP_ELEMENT)bufferHeap->pHeapBase;
-        bufferHeap->pFirstFreeHeapElement     = (void*)(&mediaBufferHeapBase[bufferHeap->uiAllocatedHeapElements]);
-        for (int32_t i = 0; i < (DDI_MEDIA_HEAP_INCREMENTAL_SIZE); i++)
+        for (uint32_t i = 0; i < growElements; i++)
         {
             mediaBufferHeapElmt               = &mediaBufferHeapBase[bufferHeap->uiAllocatedHeapElements + i];
-            mediaBufferHeapElmt->pNextFree    = (i == (DDI_MEDIA_HEAP_INCREMENTAL_SIZE - 1))? nullptr : &mediaBufferHeapBase[bufferHeap->uiAllocatedHeapElements + i + 1];
+            mediaBufferHeapElmt->pNextFree    = (i == (growElements - 1))? nullptr : &mediaBufferHeapBase[bufferHeap->uiAllocatedHeapElements + i + 1];
             mediaBufferHeapElmt->uiVaBufferID = bufferHeap->uiAllocatedHeapElements + i;
         }
-        bufferHeap->uiAllocatedHeapElements  += DDI_MEDIA_HEAP_INCREMENTAL_SIZE;
+        void *firstFree = (void*)(&mediaBufferHeapBase[bufferHeap->uiAllocatedHeapElements]);
+        if (DdiMediaUtil_PublishHeap(bufferHeap, mediaBufferHeapBase, growElements) != VA_STATUS_SUCCESS)
+        {
+            return nullptr;
+        }
+        bufferHeap->pFirstFreeHeapElement     = firstFree;
     }
 
     mediaBufferHeapElmt                       = (PDDI_MEDIA_BUFFER_HEAP_ELEMENT)bufferHeap->pFirstFreeHeapElement;
@@ -1727,24 +1803,24 @@ PDDI_MEDIA_IMAGE_HEAP_ELEMENT DdiMediaUtil_AllocPVAImageFromHeap(PDDI_MEDIA_HEAP
 
     if (nullptr == imageHeap->pFirstFreeHeapElement)
     {
-        void *newHeapBase = MOS_ReallocMemory(imageHeap->pHeapBase, (imageHeap->uiAllocatedHeapElements + DDI_MEDIA_HEAP_INCREMENTAL_SIZE) * sizeof(DDI_MEDIA_IMAGE_HEAP_ELEMENT));
-
-        if (nullptr == newHeapBase)
+        uint32_t growElements = 0;
+        PDDI_MEDIA_IMAGE_HEAP_ELEMENT vaimageHeapBase = (PDDI_MEDIA_IMAGE_HEAP_ELEMENT)DdiMediaUtil_GrowHeap(imageHeap, &growElements);
+        if (nullptr == vaimageHeapBase)
         {
-            DDI_ASSERTMESSAGE("DDI: realloc failed.");
             return nullptr;
         }
-        imageHeap->pHeapBase                           = newHeapBase;
-        PDDI_MEDIA_IMAGE_HEAP_ELEMENT vaimageHeapBase  = (PDDI_MEDIA_IMAGE_HEAP_ELEMENT)imageHeap->pHeapBase;
-        imageHeap->pFirstFreeHeapElement               = (void*)(&vaimageHeapBase[imageHeap->uiAllocatedHeapElements]);
-        for (int32_t i = 0; i < (DDI_MEDIA_HEAP_INCREMENTAL_SIZE); i++)
+        for (uint32_t i = 0; i < growElements; i++)
         {
             vaimageHeapElmt                   = &vaimageHeapBase[imageHeap->uiAllocatedHeapElements + i];
-            vaimageHeapElmt->pNextFree        = (i == (DDI_MEDIA_HEAP_INCREMENTAL_SIZE - 1))? nullptr : &vaimageHeapBase[imageHeap->uiAllocatedHeapElements + i + 1];
+            vaimageHeapElmt->pNextFree        = (i == (growElements - 1))? nullptr : &vaimageHeapBase[imageHeap->uiAllocatedHeapElements + i + 1];
             vaimageHeapElmt->uiVaImageID      = imageHeap->uiAllocatedHeapElements + i;
         }
-        imageHeap->uiAllocatedHeapElements   += DDI_MEDIA_HEAP_INCREMENTAL_SIZE;
-
+        void *firstFree = (void*)(&vaimageHeapBase[imageHeap->uiAllocatedHeapElements]);
+        if (DdiMediaUtil_PublishHeap(imageHeap, vaimageHeapBase, growElements) != VA_STATUS_SUCCESS)
+        {
+            return nullptr;
+        }
+        imageHeap->pFirstFreeHeapElement  = firstFree;
     }
 
     vaimageHeapElmt                           = (PDDI_MEDIA_IMAGE_HEAP_ELEMENT)imageHeap->pFirstFreeHeapElement;
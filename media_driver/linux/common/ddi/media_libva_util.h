@@ -262,6 +262,41 @@ VAStatus DdiMediaUtil_FillPositionToRect(RECT *rect, int16_t offset_x, int16_t o
 //!
 bool     DdiMediaUtil_IsExternalSurface(PDDI_MEDIA_SURFACE surface);
 
+//!
+//! \brief  Get heap element from index without taking the heap mutex
+//! \details Heaps which grow with DdiMediaUtil_AllocPMediaSurfaceFromHeap,
+//!          DdiMediaUtil_AllocPMediaBufferFromHeap or DdiMediaUtil_AllocPVAImageFromHeap
+//!          never free a heap base while the heap is alive, so a reader always sees
+//!          valid memory. The element count is published after the base it belongs to.
+//!
+//! \param  [in] heap
+//!         Pointer to ddi media heap
+//! \param  [in] index
+//!         Element index, which is the VA ID of the element
+//!
+//! \return void*
+//!     Pointer to heap element, nullptr if index is out of range
+//!
+static __inline void *DdiMediaUtil_GetHeapElement(PDDI_MEDIA_HEAP heap, uint32_t index)
+{
+    uint32_t allocated = __atomic_load_n(&heap->uiAllocatedHeapElements, __ATOMIC_ACQUIRE);
+    if (index >= allocated)
+    {
+        return nullptr;
+    }
+
+    uint8_t *heapBase = (uint8_t *)__atomic_load_n(&heap->pHeapBase, __ATOMIC_ACQUIRE);
+    return heapBase + (size_t)index * heap->uiHeapElementSize;
+}
+
+//!
+//! \brief  Free the heap bases retired by heap growth
+//!
+//! \param  [in] heap
+//!         Pointer to ddi media heap
+//!
+void     DdiMediaUtil_FreeRetiredHeapBases(PDDI_MEDIA_HEAP heap);
+
 //!
 //! \brief  Allocate pmedia surface from heap
 //! 
@@ -25,6 +25,8 @@ set(TMP_SOURCES_
     ${CMAKE_CURRENT_LIST_DIR}/media_libva_common.cpp
     ${CMAKE_CURRENT_LIST_DIR}/media_libva_util.cpp
     ${CMAKE_CURRENT_LIST_DIR}/media_libva_apo_decision.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/media_libva_swizzle.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/media_libva_copy_pool.cpp
 )
 
 set(TMP_HEADERS_
@@ -37,6 +39,8 @@ set(TMP_HEADERS_
     ${CMAKE_CURRENT_LIST_DIR}/media_libva_common.h
     ${CMAKE_CURRENT_LIST_DIR}/media_libva_util.h
     ${CMAKE_CURRENT_LIST_DIR}/media_libva_apo_decision.h
+    ${CMAKE_CURRENT_LIST_DIR}/media_libva_swizzle.h
+    ${CMAKE_CURRENT_LIST_DIR}/media_libva_copy_pool.h
 )
 
 if(NOT ${PLATFORM} STREQUAL "android" AND X11_FOUND)
@@ -61,5 +65,9 @@ set(HEADERS_
     ${TMP_HEADERS_}
 )
 
+set(SOURCES_SSE4
+    ${SOURCES_SSE4}
+    ${CMAKE_CURRENT_LIST_DIR}/media_libva_swizzle_sse4.cpp
+)
 
 media_add_curr_to_include_path()
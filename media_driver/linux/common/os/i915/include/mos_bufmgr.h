@@ -220,6 +220,14 @@ int mos_bo_set_softpin(struct mos_linux_bo *bo);
 int mos_bo_add_softpin_target(struct mos_linux_bo *bo, struct mos_linux_bo *target_bo, bool write_flag);
 mos_oca_exec_list_info* mos_bo_get_softpin_targets_info(struct mos_linux_bo *bo, int *count);
 
+struct mos_gem_residency_set;
+struct mos_gem_residency_set *mos_gem_residency_set_create(struct mos_bufmgr *bufmgr);
+void mos_gem_residency_set_destroy(struct mos_gem_residency_set *set);
+void mos_gem_residency_set_begin(struct mos_gem_residency_set *set);
+int mos_gem_residency_set_add(struct mos_gem_residency_set *set, struct mos_linux_bo *bo, bool write_flag);
+void mos_gem_residency_set_end(struct mos_gem_residency_set *set);
+void mos_gem_bo_set_residency_set(struct mos_linux_bo *bo, struct mos_gem_residency_set *set);
+
 int mos_bo_disable_reuse(struct mos_linux_bo *bo);
 int mos_bo_is_reusable(struct mos_linux_bo *bo);
 int mos_bo_references(struct mos_linux_bo *bo, struct mos_linux_bo *target_bo);
@@ -231,7 +239,28 @@ struct mos_linux_bo *mos_bo_gem_create_from_name(struct mos_bufmgr *bufmgr,
                         const char *name,
                         unsigned int handle);
 void mos_bufmgr_gem_enable_reuse(struct mos_bufmgr *bufmgr);
+
+enum mos_bo_cache_region {
+    MOS_BO_CACHE_REGION_SMEM = 0,
+    MOS_BO_CACHE_REGION_LMEM,
+    MOS_BO_CACHE_REGION_COUNT
+};
+
+struct mos_bo_cache_stats {
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t evictions;
+    uint64_t cached_bytes;
+    uint64_t budget_bytes;
+};
+
+int mos_bufmgr_gem_get_bo_cache_stats(struct mos_bufmgr *bufmgr,
+                    enum mos_bo_cache_region region,
+                    struct mos_bo_cache_stats *stats);
 void mos_bufmgr_gem_enable_fenced_relocs(struct mos_bufmgr *bufmgr);
+void mos_bufmgr_gem_enable_async_exec(struct mos_bufmgr *bufmgr);
+bool mos_bufmgr_gem_async_exec_enabled(struct mos_bufmgr *bufmgr);
+int mos_bufmgr_gem_wait_async_exec(struct mos_bufmgr *bufmgr);
 void mos_bufmgr_gem_enable_softpin(struct mos_bufmgr *bufmgr, bool va1m_align);
 void mos_bufmgr_gem_set_vma_cache_size(struct mos_bufmgr *bufmgr,
                          int limit);
@@ -305,6 +334,10 @@ int
 mos_gem_bo_context_exec2(struct mos_linux_bo *bo, int used, struct mos_linux_context *ctx,
                                struct drm_clip_rect *cliprects, int num_cliprects, int DR4,
                                unsigned int flags, int *fence);
+int
+mos_gem_bo_context_exec2_async(struct mos_linux_bo *bo, int used, struct mos_linux_context *ctx,
+                               int DR4, unsigned int flags,
+                               struct mos_linux_bo **clear_bos, int clear_count);
 
 int
 mos_gem_bo_context_exec3(struct mos_linux_bo **bo, int num_bo, struct mos_linux_context *ctx,
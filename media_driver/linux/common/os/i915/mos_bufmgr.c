@@ -116,6 +116,31 @@ struct mos_gem_bo_bucket {
     unsigned long size;
 };
 
+/** Fixed power-of-two-ish size classes set up by init_cache_buckets() */
+#define MOS_BO_CACHE_FIXED_BUCKETS          (14 * 4)
+/** Extra size classes learned from the allocation histogram */
+#define MOS_BO_CACHE_ADAPTIVE_BUCKETS       16
+#define MOS_BO_CACHE_HISTOGRAM_SIZE         64
+/** Number of wasteful allocations of one size before it gets its own class */
+#define MOS_BO_CACHE_ADAPTIVE_THRESHOLD     16
+#define MOS_BO_CACHE_DEFAULT_SMEM_BUDGET_MB 256
+#define MOS_BO_CACHE_DEFAULT_LMEM_BUDGET_MB 512
+
+struct mos_gem_bo_size_histogram_entry {
+    unsigned long size;
+    uint32_t count;
+};
+
+/** BO reuse cache of one memory region */
+struct mos_gem_bo_cache_region {
+    struct mos_gem_bo_bucket cache_bucket[MOS_BO_CACHE_FIXED_BUCKETS + MOS_BO_CACHE_ADAPTIVE_BUCKETS];
+    uint64_t cached_bytes;
+    uint64_t budget_bytes;
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t evictions;
+};
+
 typedef struct mos_bufmgr_gem {
     struct mos_bufmgr bufmgr;
 
@@ -133,15 +158,20 @@ typedef struct mos_bufmgr_gem {
     int exec_size;
     int exec_count;
 
-    /** Array of lists of cached gem objects of power-of-two sizes */
-    struct mos_gem_bo_bucket cache_bucket[14 * 4];
+    /** Per memory region lists of cached gem objects, all regions share the size classes */
+    struct mos_gem_bo_cache_region cache_region[MOS_BO_CACHE_REGION_COUNT];
     int num_buckets;
+    /** Page rounded sizes of allocations which wasted much of their bucket */
+    struct mos_gem_bo_size_histogram_entry size_histogram[MOS_BO_CACHE_HISTOGRAM_SIZE];
     time_t time;
 
     drmMMListHead managers;
 
     drmMMListHead named;
 
+    /** Residency sets of this buffer manager, under lock */
+    drmMMListHead residency_sets;
+
     uint64_t gtt_size;
     int available_fences;
     int pci_device;
@@ -169,9 +199,43 @@ typedef struct mos_bufmgr_gem {
     bool use_softpin;
     bool softpin_va1Malign;
 
+    /** Deferred execbuffer submission, see mos_bufmgr_gem_enable_async_exec() */
+    struct {
+        bool enabled;
+        bool exit;
+        pthread_t thread;
+        pthread_mutex_t lock;
+        /** Signaled when a request is queued or on exit */
+        pthread_cond_t cond;
+        /** Signaled when all queued requests reached the kernel */
+        pthread_cond_t idle_cond;
+        drmMMListHead requests;
+        atomic_t pending;
+        /** Sequence number of the last queued request, under lock */
+        unsigned int queued_seq;
+        /** Sequence number of the last request that reached the kernel */
+        atomic_t submitted_seq;
+        int last_error;
+    } async_exec;
+
     BufmgrPrelim *prelim;
 } mos_bufmgr_gem;
 
+struct mos_gem_exec_request {
+    drmMMListHead link;
+    struct mos_linux_bo *bo;
+    struct mos_linux_context *ctx;
+    int used;
+    int DR4;
+    unsigned int flags;
+    int seq;
+    /** BOs whose relocations and softpin targets are cleared after the exec */
+    struct mos_linux_bo **clear_bos;
+    int clear_count;
+    /** Referenced copy of the residency set of bo, only entries and count are used */
+    struct mos_gem_residency_set *residency;
+};
+
 #define DRM_INTEL_RELOC_FENCE (1<<0)
 
 struct mos_reloc_target {
@@ -184,6 +248,31 @@ struct mos_softpin_target {
     int flags;
 };
 
+#define RESIDENCY_SET_INIT_SIZE 64
+
+/**
+ * Softpin targets kept across submissions of one GPU context, see
+ * mos_gem_residency_set_begin().
+ */
+struct mos_gem_residency_set {
+    struct mos_bufmgr_gem *bufmgr_gem;
+    /** Link in mos_bufmgr_gem::residency_sets */
+    drmMMListHead link;
+    /** Guards the entries against pruning by mos_gem_bo_unreference() */
+    pthread_mutex_t lock;
+    struct mos_softpin_target *entries;
+    /** Frame in which each entry was last added */
+    uint32_t *entry_frames;
+    /** Entries dropped by mos_gem_residency_set_end(), released unlocked */
+    struct mos_linux_bo **dropped;
+    int count;
+    int size;
+    /** Open addressing table of entry index + 1, 0 is an empty slot */
+    int *hash;
+    int hash_size;
+    uint32_t frame;
+};
+
 struct mos_bo_gem {
     struct mos_linux_bo bo;
 
@@ -213,6 +302,12 @@ struct mos_bo_gem {
     unsigned long stride;
 
     time_t free_time;
+    /** Region of the BO reuse cache this BO is parked in */
+    int cache_region;
+    /** Residency set added to the validation list of the next exec of this BO */
+    struct mos_gem_residency_set *residency_set;
+    /** Number of residency sets holding a reference to this BO */
+    atomic_t residency_refs;
 
     /** Array passed to the DRM containing relocation information. */
     struct drm_i915_gem_relocation_entry *relocs;
@@ -277,6 +372,12 @@ struct mos_bo_gem {
      */
     bool idle;
 
+    /**
+     * Sequence number of the last queued async exec referencing this buffer,
+     * see mos_gem_bo_context_exec2_async().
+     */
+    atomic_t async_exec_seq;
+
     /**
      * Boolean of whether this buffer was allocated with userptr
      */
@@ -365,6 +466,48 @@ static int
 mos_gem_bo_check_mem_region_internal(struct mos_linux_bo *bo,
                      int mem_type);
 
+static void
+mos_gem_wait_async_exec(struct mos_bufmgr_gem *bufmgr_gem);
+
+static int
+mos_gem_take_async_exec_error(struct mos_bufmgr_gem *bufmgr_gem);
+
+static int
+mos_gem_residency_set_find(struct mos_gem_residency_set *set, struct mos_linux_bo *bo);
+
+static void
+mos_gem_residency_sets_prune_locked(struct mos_bufmgr_gem *bufmgr_gem,
+                      struct mos_linux_bo *bo, time_t time);
+
+/* True once only residency sets keep bo alive */
+static inline bool
+mos_gem_bo_only_in_residency_sets(struct mos_bo_gem *bo_gem)
+{
+    int residency_refs = atomic_read(&bo_gem->residency_refs);
+
+    return residency_refs != 0 &&
+           atomic_read(&bo_gem->refcount) == residency_refs;
+}
+
+/**
+ * Drop a reference without the lock as long as bo stays referenced by more
+ * than its residency sets. Otherwise the caller frees or prunes it locked.
+ */
+static inline bool
+mos_gem_bo_unreference_unlocked(struct mos_bo_gem *bo_gem)
+{
+    int c = atomic_read(&bo_gem->refcount), old;
+
+    while (c - 1 > atomic_read(&bo_gem->residency_refs)) {
+        old = atomic_cmpxchg(&bo_gem->refcount, c, c - 1);
+        if (old == c)
+            return true;
+        c = old;
+    }
+
+    return false;
+}
+
 static int
 mos_gem_bo_set_tiling_internal(struct mos_linux_bo *bo,
                      uint32_t tiling_mode,
@@ -424,21 +567,102 @@ mos_gem_bo_tile_pitch(struct mos_bufmgr_gem *bufmgr_gem,
     return ROUND_UP_TO(pitch, tile_width);
 }
 
+/* Best fit, adaptive size classes are appended after the sorted fixed ones */
 static struct mos_gem_bo_bucket *
 mos_gem_bo_bucket_for_size(struct mos_bufmgr_gem *bufmgr_gem,
+                 int region,
                  unsigned long size)
 {
+    struct mos_gem_bo_bucket *best = nullptr;
     int i;
 
     for (i = 0; i < bufmgr_gem->num_buckets; i++) {
         struct mos_gem_bo_bucket *bucket =
-            &bufmgr_gem->cache_bucket[i];
-        if (bucket->size >= size) {
-            return bucket;
+            &bufmgr_gem->cache_region[region].cache_bucket[i];
+        if (bucket->size >= size &&
+            (best == nullptr || bucket->size < best->size)) {
+            best = bucket;
         }
     }
 
-    return nullptr;
+    return best;
+}
+
+static void
+add_bucket(struct mos_bufmgr_gem *bufmgr_gem, unsigned long size);
+
+/* Collect sizes which waste more than 1/8 of their bucket and give the
+ * frequent ones a size class of their own. Returns the new bucket if one
+ * was added for this size.
+ */
+static struct mos_gem_bo_bucket *
+mos_gem_bo_cache_record_size(struct mos_bufmgr_gem *bufmgr_gem,
+                 int region,
+                 unsigned long size,
+                 struct mos_gem_bo_bucket *bucket)
+{
+    struct mos_gem_bo_size_histogram_entry *entry = nullptr;
+    int i, pass;
+
+    if (bucket == nullptr || bucket->size - size <= bucket->size / 8)
+        return nullptr;
+    if (bufmgr_gem->num_buckets >= (int)ARRAY_SIZE(bufmgr_gem->cache_region[0].cache_bucket))
+        return nullptr;
+
+    size = ROUND_UP_TO(size, getpagesize());
+    if (size == bucket->size)
+        return nullptr;
+
+    for (pass = 0; pass < 2 && entry == nullptr; pass++) {
+        for (i = 0; i < MOS_BO_CACHE_HISTOGRAM_SIZE; i++) {
+            if (bufmgr_gem->size_histogram[i].size == size) {
+                entry = &bufmgr_gem->size_histogram[i];
+                break;
+            }
+            if (entry == nullptr && bufmgr_gem->size_histogram[i].size == 0)
+                entry = &bufmgr_gem->size_histogram[i];
+        }
+        if (entry == nullptr) {
+            /* Histogram full, age out the rare sizes */
+            for (i = 0; i < MOS_BO_CACHE_HISTOGRAM_SIZE; i++) {
+                bufmgr_gem->size_histogram[i].count >>= 1;
+                if (bufmgr_gem->size_histogram[i].count == 0)
+                    bufmgr_gem->size_histogram[i].size = 0;
+            }
+        }
+    }
+    if (entry == nullptr)
+        return nullptr;
+
+    entry->size = size;
+    if (++entry->count < MOS_BO_CACHE_ADAPTIVE_THRESHOLD)
+        return nullptr;
+
+    entry->size = 0;
+    entry->count = 0;
+    add_bucket(bufmgr_gem, size);
+    MOS_DBG("bo cache: added size class %lu\n", size);
+
+    return &bufmgr_gem->cache_region[region].cache_bucket[bufmgr_gem->num_buckets - 1];
+}
+
+static int
+mos_gem_bo_cache_region_for_bo(struct mos_bufmgr_gem *bufmgr_gem,
+                 struct mos_bo_gem *bo_gem)
+{
+    if (bufmgr_gem->has_lmem &&
+        mos_gem_bo_check_mem_region_internal(&bo_gem->bo, MOS_MEMPOOL_SYSTEMMEMORY))
+        return MOS_BO_CACHE_REGION_LMEM;
+
+    return MOS_BO_CACHE_REGION_SMEM;
+}
+
+static void
+mos_gem_bo_cache_remove(struct mos_bufmgr_gem *bufmgr_gem,
+                 struct mos_bo_gem *bo_gem)
+{
+    DRMLISTDEL(&bo_gem->head);
+    bufmgr_gem->cache_region[bo_gem->cache_region].cached_bytes -= bo_gem->bo.size;
 }
 
 static void
@@ -804,6 +1028,17 @@ mos_gem_bo_busy(struct mos_linux_bo *bo)
     struct drm_i915_gem_busy busy;
     int ret;
 
+    /* A queued exec may still reference this BO. Waiting for it here is not
+     * possible since the cache lookup calls in with bufmgr lock held.
+     */
+    if (bufmgr_gem->async_exec.enabled) {
+        int seq = atomic_read(&bo_gem->async_exec_seq);
+        if (seq != 0 &&
+            (int)((unsigned int)seq -
+                  (unsigned int)atomic_read(&bufmgr_gem->async_exec.submitted_seq)) > 0)
+            return true;
+    }
+
     if (bo_gem->reusable && bo_gem->idle)
         return false;
 
@@ -858,11 +1093,46 @@ mos_gem_bo_cache_purge_bucket(struct mos_bufmgr_gem *bufmgr_gem,
             (bufmgr_gem, bo_gem, I915_MADV_DONTNEED))
             break;
 
-        DRMLISTDEL(&bo_gem->head);
+        mos_gem_bo_cache_remove(bufmgr_gem, bo_gem);
         mos_gem_bo_free(&bo_gem->bo);
     }
 }
 
+/* evict the least recently freed entries until the region fits its budget */
+static void
+mos_gem_bo_cache_enforce_budget(struct mos_bufmgr_gem *bufmgr_gem,
+                      int region)
+{
+    struct mos_gem_bo_cache_region *cache = &bufmgr_gem->cache_region[region];
+
+    while (cache->cached_bytes > cache->budget_bytes) {
+        struct mos_bo_gem *oldest = nullptr;
+        int i;
+
+        for (i = 0; i < bufmgr_gem->num_buckets; i++) {
+            struct mos_gem_bo_bucket *bucket = &cache->cache_bucket[i];
+            struct mos_bo_gem *bo_gem;
+
+            if (DRMLISTEMPTY(&bucket->head))
+                continue;
+
+            bo_gem = DRMLISTENTRY(struct mos_bo_gem,
+                          bucket->head.next, head);
+            if (oldest == nullptr ||
+                bo_gem->free_time < oldest->free_time ||
+                (bo_gem->free_time == oldest->free_time &&
+                 bo_gem->bo.size > oldest->bo.size))
+                oldest = bo_gem;
+        }
+        if (oldest == nullptr)
+            break;
+
+        mos_gem_bo_cache_remove(bufmgr_gem, oldest);
+        cache->evictions++;
+        mos_gem_bo_free(&oldest->bo);
+    }
+}
+
 static int
 mos_gem_query_items(int fd, struct drm_i915_query_item *items, uint32_t n_items)
 {
@@ -1043,15 +1313,28 @@ mos_gem_bo_alloc_internal(struct mos_bufmgr *bufmgr,
     unsigned int page_size = getpagesize();
     int ret;
     struct mos_gem_bo_bucket *bucket;
+    struct mos_gem_bo_bucket *new_bucket;
     bool alloc_from_cache;
     unsigned long bo_size;
     bool for_render = false;
+    int cache_region = MOS_BO_CACHE_REGION_SMEM;
 
     if (flags & BO_ALLOC_FOR_RENDER)
         for_render = true;
 
-    /* Round the allocated size up to a power of two number of pages. */
-    bucket = mos_gem_bo_bucket_for_size(bufmgr_gem, size);
+    if (bufmgr_gem->has_lmem &&
+        (mem_type == MOS_MEMPOOL_VIDEOMEMORY || mem_type == MOS_MEMPOOL_DEVICEMEMORY))
+        cache_region = MOS_BO_CACHE_REGION_LMEM;
+
+    pthread_mutex_lock(&bufmgr_gem->lock);
+
+    /* Round the allocated size up to the best fitting size class. */
+    bucket = mos_gem_bo_bucket_for_size(bufmgr_gem, cache_region, size);
+    if (bufmgr_gem->bo_reuse) {
+        new_bucket = mos_gem_bo_cache_record_size(bufmgr_gem, cache_region, size, bucket);
+        if (new_bucket != nullptr)
+            bucket = new_bucket;
+    }
 
     /* If we don't have caching at this size, don't actually round the
      * allocation up.
@@ -1064,7 +1347,6 @@ mos_gem_bo_alloc_internal(struct mos_bufmgr *bufmgr,
         bo_size = bucket->size;
     }
 
-    pthread_mutex_lock(&bufmgr_gem->lock);
     /* Get a buffer out of the cache if available */
 retry:
     alloc_from_cache = false;
@@ -1076,7 +1358,7 @@ retry:
              */
             bo_gem = DRMLISTENTRY(struct mos_bo_gem,
                           bucket->head.prev, head);
-            DRMLISTDEL(&bo_gem->head);
+            mos_gem_bo_cache_remove(bufmgr_gem, bo_gem);
             alloc_from_cache = true;
             bo_gem->bo.align = alignment;
         } else {
@@ -1092,7 +1374,7 @@ retry:
                           bucket->head.next, head);
             if (!mos_gem_bo_busy(&bo_gem->bo)) {
                 alloc_from_cache = true;
-                DRMLISTDEL(&bo_gem->head);
+                mos_gem_bo_cache_remove(bufmgr_gem, bo_gem);
             }
         }
 
@@ -1117,6 +1399,10 @@ retry:
             }
         }
     }
+    if (alloc_from_cache)
+        bufmgr_gem->cache_region[cache_region].hits++;
+    else
+        bufmgr_gem->cache_region[cache_region].misses++;
     pthread_mutex_unlock(&bufmgr_gem->lock);
 
     if (!alloc_from_cache) {
@@ -1609,26 +1895,28 @@ mos_gem_bo_mark_mmaps_incoherent(struct mos_linux_bo *bo)
 static void
 mos_gem_cleanup_bo_cache(struct mos_bufmgr_gem *bufmgr_gem, time_t time)
 {
-    int i;
+    int i, region;
 
     if (bufmgr_gem->time == time)
         return;
 
-    for (i = 0; i < bufmgr_gem->num_buckets; i++) {
-        struct mos_gem_bo_bucket *bucket =
-            &bufmgr_gem->cache_bucket[i];
+    for (region = 0; region < MOS_BO_CACHE_REGION_COUNT; region++) {
+        for (i = 0; i < bufmgr_gem->num_buckets; i++) {
+            struct mos_gem_bo_bucket *bucket =
+                &bufmgr_gem->cache_region[region].cache_bucket[i];
 
-        while (!DRMLISTEMPTY(&bucket->head)) {
-            struct mos_bo_gem *bo_gem;
+            while (!DRMLISTEMPTY(&bucket->head)) {
+                struct mos_bo_gem *bo_gem;
 
-            bo_gem = DRMLISTENTRY(struct mos_bo_gem,
-                          bucket->head.next, head);
-            if (time - bo_gem->free_time <= 1)
-                break;
+                bo_gem = DRMLISTENTRY(struct mos_bo_gem,
+                              bucket->head.next, head);
+                if (time - bo_gem->free_time <= 1)
+                    break;
 
-            DRMLISTDEL(&bo_gem->head);
+                mos_gem_bo_cache_remove(bufmgr_gem, bo_gem);
 
-            mos_gem_bo_free(&bo_gem->bo);
+                mos_gem_bo_free(&bo_gem->bo);
+            }
         }
     }
 
@@ -1641,6 +1929,7 @@ mos_gem_bo_unreference_final(struct mos_linux_bo *bo, time_t time)
     struct mos_bufmgr_gem *bufmgr_gem = (struct mos_bufmgr_gem *) bo->bufmgr;
     struct mos_bo_gem *bo_gem = (struct mos_bo_gem *) bo;
     struct mos_gem_bo_bucket *bucket;
+    int cache_region;
     int i;
 
     /* Unreference all the target buffers */
@@ -1657,6 +1946,7 @@ mos_gem_bo_unreference_final(struct mos_linux_bo *bo, time_t time)
     bo_gem->reloc_count = 0;
     bo_gem->used_as_reloc_target = false;
     bo_gem->softpin_target_count = 0;
+    bo_gem->residency_set = nullptr;
     bo_gem->exec_async = false;
 
     MOS_DBG("bo_unreference final: %d (%s)\n",
@@ -1687,7 +1977,8 @@ mos_gem_bo_unreference_final(struct mos_linux_bo *bo, time_t time)
 
     DRMLISTDEL(&bo_gem->name_list);
 
-    bucket = mos_gem_bo_bucket_for_size(bufmgr_gem, bo->size);
+    cache_region = mos_gem_bo_cache_region_for_bo(bufmgr_gem, bo_gem);
+    bucket = mos_gem_bo_bucket_for_size(bufmgr_gem, cache_region, bo->size);
     /* Put the buffer into our internal cache for reuse if we can. */
     if (bufmgr_gem->bo_reuse && bo_gem->reusable && bucket != nullptr &&
         mos_gem_bo_madvise_internal(bufmgr_gem, bo_gem,
@@ -1698,6 +1989,9 @@ mos_gem_bo_unreference_final(struct mos_linux_bo *bo, time_t time)
         bo_gem->validate_index = -1;
 
         DRMLISTADDTAIL(&bo_gem->head, &bucket->head);
+        bo_gem->cache_region = cache_region;
+        bufmgr_gem->cache_region[cache_region].cached_bytes += bo->size;
+        mos_gem_bo_cache_enforce_budget(bufmgr_gem, cache_region);
     } else {
         mos_gem_bo_free(bo);
     }
@@ -1711,6 +2005,9 @@ static void mos_gem_bo_unreference_locked_timed(struct mos_linux_bo *bo,
     assert(atomic_read(&bo_gem->refcount) > 0);
     if (atomic_dec_and_test(&bo_gem->refcount))
         mos_gem_bo_unreference_final(bo, time);
+    else if (mos_gem_bo_only_in_residency_sets(bo_gem))
+        mos_gem_residency_sets_prune_locked((struct mos_bufmgr_gem *) bo->bufmgr,
+                              bo, time);
 }
 
 static void mos_gem_bo_unreference(struct mos_linux_bo *bo)
@@ -1719,7 +2016,7 @@ static void mos_gem_bo_unreference(struct mos_linux_bo *bo)
 
     assert(atomic_read(&bo_gem->refcount) > 0);
 
-    if (atomic_add_unless(&bo_gem->refcount, -1, 1)) {
+    if (!mos_gem_bo_unreference_unlocked(bo_gem)) {
         struct mos_bufmgr_gem *bufmgr_gem =
             (struct mos_bufmgr_gem *) bo->bufmgr;
         struct timespec time;
@@ -1731,6 +2028,9 @@ static void mos_gem_bo_unreference(struct mos_linux_bo *bo)
         if (atomic_dec_and_test(&bo_gem->refcount)) {
             mos_gem_bo_unreference_final(bo, time.tv_sec);
             mos_gem_cleanup_bo_cache(bufmgr_gem, time.tv_sec);
+        } else if (mos_gem_bo_only_in_residency_sets(bo_gem)) {
+            mos_gem_residency_sets_prune_locked(bufmgr_gem, bo, time.tv_sec);
+            mos_gem_cleanup_bo_cache(bufmgr_gem, time.tv_sec);
         }
 
         pthread_mutex_unlock(&bufmgr_gem->lock);
@@ -1838,6 +2138,7 @@ mos_gem_bo_map_wc(struct mos_linux_bo *bo) {
     struct drm_i915_gem_wait wait;
     int ret;
 
+    mos_gem_wait_async_exec(bufmgr_gem);
     pthread_mutex_lock(&bufmgr_gem->lock);
 
     ret = map_wc(bo);
@@ -1923,6 +2224,7 @@ drm_export int mos_gem_bo_map(struct mos_linux_bo *bo, int write_enable)
         return 0;
     }
 
+    mos_gem_wait_async_exec(bufmgr_gem);
     pthread_mutex_lock(&bufmgr_gem->lock);
 
     if (bufmgr_gem->has_mmap_offset) {
@@ -2132,6 +2434,7 @@ mos_gem_bo_map_gtt(struct mos_linux_bo *bo)
     struct drm_i915_gem_wait wait;
     int ret;
 
+    mos_gem_wait_async_exec(bufmgr_gem);
     pthread_mutex_lock(&bufmgr_gem->lock);
 
     ret = map_gtt(bo);
@@ -2413,6 +2716,8 @@ mos_gem_bo_wait(struct mos_linux_bo *bo, int64_t timeout_ns)
     struct drm_i915_gem_wait wait;
     int ret;
 
+    mos_gem_wait_async_exec(bufmgr_gem);
+
     if (!bufmgr_gem->has_wait_timeout) {
         MOS_DBG("%s:%d: Timed wait is not supported. Falling back to "
             "infinite wait\n", __FILE__, __LINE__);
@@ -2450,6 +2755,8 @@ mos_gem_bo_start_gtt_access(struct mos_linux_bo *bo, int write_enable)
     struct drm_i915_gem_wait wait;
     int ret;
 
+    mos_gem_wait_async_exec(bufmgr_gem);
+
     if (bufmgr_gem->has_lmem) {
         assert(bufmgr_gem->has_wait_timeout);
         memclear(wait);
@@ -2482,7 +2789,20 @@ mos_bufmgr_gem_destroy(struct mos_bufmgr *bufmgr)
 {
     struct mos_bufmgr_gem *bufmgr_gem = (struct mos_bufmgr_gem *) bufmgr;
     struct drm_gem_close close_bo;
-    int i, ret;
+    int i, ret, region;
+
+    if (bufmgr_gem->async_exec.enabled) {
+        pthread_mutex_lock(&bufmgr_gem->async_exec.lock);
+        bufmgr_gem->async_exec.exit = true;
+        pthread_cond_signal(&bufmgr_gem->async_exec.cond);
+        pthread_mutex_unlock(&bufmgr_gem->async_exec.lock);
+        pthread_join(bufmgr_gem->async_exec.thread, nullptr);
+
+        pthread_cond_destroy(&bufmgr_gem->async_exec.idle_cond);
+        pthread_cond_destroy(&bufmgr_gem->async_exec.cond);
+        pthread_mutex_destroy(&bufmgr_gem->async_exec.lock);
+        bufmgr_gem->async_exec.enabled = false;
+    }
 
     free(bufmgr_gem->exec2_objects);
     free(bufmgr_gem->exec_objects);
@@ -2490,17 +2810,24 @@ mos_bufmgr_gem_destroy(struct mos_bufmgr *bufmgr)
     pthread_mutex_destroy(&bufmgr_gem->lock);
 
     /* Free any cached buffer objects we were going to reuse */
-    for (i = 0; i < bufmgr_gem->num_buckets; i++) {
-        struct mos_gem_bo_bucket *bucket =
-            &bufmgr_gem->cache_bucket[i];
-        struct mos_bo_gem *bo_gem;
+    for (region = 0; region < MOS_BO_CACHE_REGION_COUNT; region++) {
+        MOS_DBG("bo cache region %d: hits %llu misses %llu evictions %llu\n", region,
+            (unsigned long long)bufmgr_gem->cache_region[region].hits,
+            (unsigned long long)bufmgr_gem->cache_region[region].misses,
+            (unsigned long long)bufmgr_gem->cache_region[region].evictions);
+
+        for (i = 0; i < bufmgr_gem->num_buckets; i++) {
+            struct mos_gem_bo_bucket *bucket =
+                &bufmgr_gem->cache_region[region].cache_bucket[i];
+            struct mos_bo_gem *bo_gem;
 
-        while (!DRMLISTEMPTY(&bucket->head)) {
-            bo_gem = DRMLISTENTRY(struct mos_bo_gem,
-                          bucket->head.next, head);
-            DRMLISTDEL(&bo_gem->head);
+            while (!DRMLISTEMPTY(&bucket->head)) {
+                bo_gem = DRMLISTENTRY(struct mos_bo_gem,
+                              bucket->head.next, head);
+                mos_gem_bo_cache_remove(bufmgr_gem, bo_gem);
 
-            mos_gem_bo_free(&bo_gem->bo);
+                mos_gem_bo_free(&bo_gem->bo);
+            }
         }
     }
 
@@ -2735,6 +3062,18 @@ mos_gem_bo_set_exec_object_async(struct mos_linux_bo *bo, struct mos_linux_bo *t
             break;
         }
     }
+
+    if (bo_gem->residency_set != nullptr)
+    {
+        struct mos_gem_residency_set *set = bo_gem->residency_set;
+        pthread_mutex_lock(&set->lock);
+        i = mos_gem_residency_set_find(set, target_bo);
+        if (i >= 0)
+        {
+            set->entries[i].flags |= EXEC_OBJECT_ASYNC;
+        }
+        pthread_mutex_unlock(&set->lock);
+    }
 }
 
 static void
@@ -2802,6 +3141,297 @@ mos_gem_bo_add_softpin_target(struct mos_linux_bo *bo, struct mos_linux_bo *targ
     return 0;
 }
 
+static inline int
+mos_gem_residency_set_slot(struct mos_gem_residency_set *set, struct mos_linux_bo *bo)
+{
+    return (int)((uint32_t)((uintptr_t)bo >> 4) * 2654435761u) & (set->hash_size - 1);
+}
+
+/* Index of the entry of bo, -1 if bo is not in the set */
+static int
+mos_gem_residency_set_find(struct mos_gem_residency_set *set, struct mos_linux_bo *bo)
+{
+    int slot = mos_gem_residency_set_slot(set, bo);
+
+    while (set->hash[slot]) {
+        int index = set->hash[slot] - 1;
+
+        if (set->entries[index].bo == bo)
+            return index;
+        slot = (slot + 1) & (set->hash_size - 1);
+    }
+
+    return -1;
+}
+
+static void
+mos_gem_residency_set_rehash(struct mos_gem_residency_set *set)
+{
+    int i;
+
+    memset(set->hash, 0, set->hash_size * sizeof(*set->hash));
+    for (i = 0; i < set->count; i++) {
+        int slot = mos_gem_residency_set_slot(set, set->entries[i].bo);
+
+        while (set->hash[slot])
+            slot = (slot + 1) & (set->hash_size - 1);
+        set->hash[slot] = i + 1;
+    }
+}
+
+static int
+mos_gem_residency_set_grow(struct mos_gem_residency_set *set)
+{
+    int size = set->size ? set->size * 2 : RESIDENCY_SET_INIT_SIZE;
+    struct mos_softpin_target *entries;
+    uint32_t *entry_frames;
+    struct mos_linux_bo **dropped;
+    int *hash;
+
+    entries = (struct mos_softpin_target *)realloc(set->entries, size * sizeof(*entries));
+    if (!entries)
+        return -ENOMEM;
+    set->entries = entries;
+
+    entry_frames = (uint32_t *)realloc(set->entry_frames, size * sizeof(*entry_frames));
+    if (!entry_frames)
+        return -ENOMEM;
+    set->entry_frames = entry_frames;
+
+    dropped = (struct mos_linux_bo **)realloc(set->dropped, size * sizeof(*dropped));
+    if (!dropped)
+        return -ENOMEM;
+    set->dropped = dropped;
+
+    /* keep the table at most half full */
+    hash = (int *)realloc(set->hash, size * 2 * sizeof(*hash));
+    if (!hash)
+        return -ENOMEM;
+    set->hash = hash;
+    set->hash_size = size * 2;
+    set->size = size;
+
+    mos_gem_residency_set_rehash(set);
+    return 0;
+}
+
+/**
+ * Create a residency set, a softpin target list which lives across
+ * submissions so that steady state frames don't re-reference every BO.
+ */
+struct mos_gem_residency_set *
+mos_gem_residency_set_create(struct mos_bufmgr *bufmgr)
+{
+    struct mos_gem_residency_set *set;
+
+    set = (struct mos_gem_residency_set *)calloc(1, sizeof(*set));
+    if (!set)
+        return nullptr;
+
+    set->bufmgr_gem = (struct mos_bufmgr_gem *) bufmgr;
+    if (mos_gem_residency_set_grow(set)) {
+        free(set->entries);
+        free(set->entry_frames);
+        free(set->dropped);
+        free(set->hash);
+        free(set);
+        return nullptr;
+    }
+
+    pthread_mutex_init(&set->lock, nullptr);
+    pthread_mutex_lock(&set->bufmgr_gem->lock);
+    DRMLISTADDTAIL(&set->link, &set->bufmgr_gem->residency_sets);
+    pthread_mutex_unlock(&set->bufmgr_gem->lock);
+
+    return set;
+}
+
+void
+mos_gem_residency_set_destroy(struct mos_gem_residency_set *set)
+{
+    int i;
+
+    if (!set)
+        return;
+
+    /* Queued execs hold their own references to the entries */
+    pthread_mutex_lock(&set->bufmgr_gem->lock);
+    DRMLISTDEL(&set->link);
+    pthread_mutex_unlock(&set->bufmgr_gem->lock);
+
+    for (i = 0; i < set->count; i++) {
+        struct mos_bo_gem *bo_gem = (struct mos_bo_gem *) set->entries[i].bo;
+
+        atomic_dec(&bo_gem->residency_refs, 1);
+        mos_gem_bo_unreference(set->entries[i].bo);
+    }
+
+    pthread_mutex_destroy(&set->lock);
+    free(set->entries);
+    free(set->entry_frames);
+    free(set->dropped);
+    free(set->hash);
+    free(set);
+}
+
+/**
+ * Start collecting the targets of a new submission. Entries which are not
+ * added again before mos_gem_residency_set_end() are dropped.
+ */
+void
+mos_gem_residency_set_begin(struct mos_gem_residency_set *set)
+{
+    set->frame++;
+}
+
+int
+mos_gem_residency_set_add(struct mos_gem_residency_set *set,
+                struct mos_linux_bo *bo, bool write_flag)
+{
+    struct mos_bo_gem *bo_gem = (struct mos_bo_gem *) bo;
+    int slot, index;
+
+    if (bo_gem->has_error)
+        return -ENOMEM;
+    if (!bo_gem->is_softpin)
+        return -EINVAL;
+
+    int flags = EXEC_OBJECT_PINNED;
+    if (bo_gem->pad_to_size)
+        flags |= EXEC_OBJECT_PAD_TO_SIZE;
+    if (bo_gem->use_48b_address_range)
+        flags |= EXEC_OBJECT_SUPPORTS_48B_ADDRESS;
+    if (bo_gem->exec_async)
+        flags |= EXEC_OBJECT_ASYNC;
+    if (bo_gem->exec_capture)
+        flags |= EXEC_OBJECT_CAPTURE;
+    if (write_flag)
+        flags |= EXEC_OBJECT_WRITE;
+
+    pthread_mutex_lock(&set->lock);
+    slot = mos_gem_residency_set_slot(set, bo);
+    while (set->hash[slot]) {
+        index = set->hash[slot] - 1;
+        if (set->entries[index].bo == bo) {
+            /* first use in this frame drops the flags of the previous one */
+            if (set->entry_frames[index] != set->frame) {
+                set->entries[index].flags = flags;
+                set->entry_frames[index] = set->frame;
+            } else {
+                set->entries[index].flags |= flags;
+            }
+            pthread_mutex_unlock(&set->lock);
+            return 0;
+        }
+        slot = (slot + 1) & (set->hash_size - 1);
+    }
+
+    if (set->count == set->size) {
+        if (mos_gem_residency_set_grow(set)) {
+            pthread_mutex_unlock(&set->lock);
+            return -ENOMEM;
+        }
+        slot = mos_gem_residency_set_slot(set, bo);
+        while (set->hash[slot])
+            slot = (slot + 1) & (set->hash_size - 1);
+    }
+
+    index = set->count++;
+    set->entries[index].bo = bo;
+    set->entries[index].flags = flags;
+    set->entry_frames[index] = set->frame;
+    set->hash[slot] = index + 1;
+    /* reference before counting it so that the BO never looks set-only early */
+    mos_gem_bo_reference(bo);
+    atomic_inc(&bo_gem->residency_refs);
+    pthread_mutex_unlock(&set->lock);
+
+    return 0;
+}
+
+/** Drop the entries not used by the current submission, order is kept. */
+void
+mos_gem_residency_set_end(struct mos_gem_residency_set *set)
+{
+    int i, count = 0, dropped = 0;
+
+    pthread_mutex_lock(&set->lock);
+    for (i = 0; i < set->count; i++) {
+        if (set->entry_frames[i] == set->frame) {
+            set->entries[count] = set->entries[i];
+            set->entry_frames[count] = set->entry_frames[i];
+            count++;
+        } else {
+            struct mos_bo_gem *bo_gem = (struct mos_bo_gem *) set->entries[i].bo;
+
+            atomic_dec(&bo_gem->residency_refs, 1);
+            set->dropped[dropped++] = set->entries[i].bo;
+        }
+    }
+
+    if (count != set->count) {
+        set->count = count;
+        mos_gem_residency_set_rehash(set);
+    }
+    pthread_mutex_unlock(&set->lock);
+
+    /* unreferencing may prune other sets, so not under the set lock */
+    for (i = 0; i < dropped; i++)
+        mos_gem_bo_unreference(set->dropped[i]);
+}
+
+/**
+ * Remove bo from every residency set when nothing else references it, so
+ * that freed BOs are not kept alive until the next submission of the sets.
+ * Called with bufmgr_gem->lock held.
+ */
+static void
+mos_gem_residency_sets_prune_locked(struct mos_bufmgr_gem *bufmgr_gem,
+                      struct mos_linux_bo *bo, time_t time)
+{
+    struct mos_bo_gem *bo_gem = (struct mos_bo_gem *) bo;
+    drmMMListHead *node;
+
+    for (node = bufmgr_gem->residency_sets.next;
+         node != &bufmgr_gem->residency_sets; node = node->next) {
+        struct mos_gem_residency_set *set =
+            DRMLISTENTRY(struct mos_gem_residency_set, node, link);
+        bool last;
+        int index;
+
+        pthread_mutex_lock(&set->lock);
+        index = mos_gem_residency_set_find(set, bo);
+        if (index >= 0) {
+            memmove(&set->entries[index], &set->entries[index + 1],
+                (set->count - index - 1) * sizeof(*set->entries));
+            memmove(&set->entry_frames[index], &set->entry_frames[index + 1],
+                (set->count - index - 1) * sizeof(*set->entry_frames));
+            set->count--;
+            mos_gem_residency_set_rehash(set);
+        }
+        pthread_mutex_unlock(&set->lock);
+
+        if (index < 0)
+            continue;
+
+        /* the last set reference may free bo */
+        last = atomic_dec_and_test(&bo_gem->residency_refs);
+        if (atomic_dec_and_test(&bo_gem->refcount))
+            mos_gem_bo_unreference_final(bo, time);
+        if (last)
+            break;
+    }
+}
+
+/** Add the set to the validation list of the next exec of bo. */
+void
+mos_gem_bo_set_residency_set(struct mos_linux_bo *bo, struct mos_gem_residency_set *set)
+{
+    struct mos_bo_gem *bo_gem = (struct mos_bo_gem *) bo;
+
+    bo_gem->residency_set = set;
+}
+
 mos_oca_exec_list_info*
 mos_bo_get_softpin_targets_info(struct mos_linux_bo *bo, int *count)
 {
@@ -2814,21 +3444,37 @@ mos_bo_get_softpin_targets_info(struct mos_linux_bo *bo, int *count)
     int counter = 0;
     int MAX_COUNT = 50;
     struct mos_bo_gem *bo_gem = (struct mos_bo_gem *)bo;
-    int softpin_target_count = bo_gem->softpin_target_count;
-    if(softpin_target_count == 0 || softpin_target_count > MAX_COUNT)
+    struct mos_gem_residency_set *set = bo_gem->residency_set;
+    /*note: residency set entries are always dumped, the limit is for the per exec targets*/
+    if(bo_gem->softpin_target_count > MAX_COUNT)
     {
         return info;
     }
-    info = (mos_oca_exec_list_info *)malloc((softpin_target_count + 1) * sizeof(mos_oca_exec_list_info));
+    if(set)
+    {
+        pthread_mutex_lock(&set->lock);
+    }
+    int residency_count = set ? set->count : 0;
+    int softpin_target_count = bo_gem->softpin_target_count + residency_count;
+    if(softpin_target_count != 0)
+    {
+        info = (mos_oca_exec_list_info *)malloc((softpin_target_count + 1) * sizeof(mos_oca_exec_list_info));
+    }
     if(info == nullptr)
     {
+        if(set)
+        {
+            pthread_mutex_unlock(&set->lock);
+        }
         return info;
     }
 
     for(int i = 0; i < softpin_target_count; i++)
     {
         /*note: set capture for each bo*/
-        struct mos_softpin_target *target = (struct mos_softpin_target *)&bo_gem->softpin_target[i];
+        struct mos_softpin_target *target = (i < bo_gem->softpin_target_count) ?
+            &bo_gem->softpin_target[i] :
+            &set->entries[i - bo_gem->softpin_target_count];
         struct mos_bo_gem *target_gem = (struct mos_bo_gem *)target->bo;
         if(std::find(bo_added.begin(), bo_added.end(), target->bo->handle) == bo_added.end())
         {
@@ -2843,6 +3489,10 @@ mos_bo_get_softpin_targets_info(struct mos_linux_bo *bo, int *count)
             counter++;
         }
     }
+    if(set)
+    {
+        pthread_mutex_unlock(&set->lock);
+    }
 
     /*note: bo is cmd bo, also need to be added*/
     int bb_flags = 0;
@@ -2973,6 +3623,7 @@ mos_gem_bo_clear_relocs(struct mos_linux_bo *bo, int start)
         mos_gem_bo_unreference_locked_timed(&target_bo_gem->bo, time.tv_sec);
     }
     bo_gem->softpin_target_count = 0;
+    bo_gem->residency_set = nullptr;
 
     pthread_mutex_unlock(&bufmgr_gem->lock);
 
@@ -3014,7 +3665,8 @@ mos_gem_bo_process_reloc2(struct mos_linux_bo *bo)
     struct mos_bo_gem *bo_gem = (struct mos_bo_gem *)bo;
     int i;
 
-    if (bo_gem->relocs == nullptr && bo_gem->softpin_target == nullptr)
+    if (bo_gem->relocs == nullptr && bo_gem->softpin_target == nullptr &&
+        bo_gem->residency_set == nullptr)
         return;
 
     for (i = 0; i < bo_gem->reloc_count; i++) {
@@ -3042,6 +3694,21 @@ mos_gem_bo_process_reloc2(struct mos_linux_bo *bo)
         mos_gem_bo_process_reloc2(target_bo);
         mos_add_softpin_objects(bo_gem->softpin_target[i]);
     }
+
+    if (bo_gem->residency_set != nullptr) {
+        struct mos_gem_residency_set *set = bo_gem->residency_set;
+
+        for (i = 0; i < set->count; i++) {
+            struct mos_linux_bo *target_bo = set->entries[i].bo;
+
+            if (target_bo == bo)
+                continue;
+
+            mos_gem_bo_mark_mmaps_incoherent(bo);
+            mos_gem_bo_process_reloc2(target_bo);
+            mos_add_softpin_objects(set->entries[i]);
+        }
+    }
 }
 
 static void
@@ -3179,8 +3846,8 @@ mos_gem_bo_exec(struct mos_linux_bo *bo, int used,
     return ret;
 }
 
-drm_export int
-do_exec2(struct mos_linux_bo *bo, int used, struct mos_linux_context *ctx,
+static int
+__do_exec2(struct mos_linux_bo *bo, int used, struct mos_linux_context *ctx,
      drm_clip_rect_t *cliprects, int num_cliprects, int DR4,
      unsigned int flags, int *fence
      )
@@ -3223,6 +3890,9 @@ do_exec2(struct mos_linux_bo *bo, int used, struct mos_linux_context *ctx,
      */
     mos_add_validate_buffer2(bo, 0);
 
+    /* The residency set is attached for one exec only */
+    to_bo_gem(bo)->residency_set = nullptr;
+
     memclear(execbuf);
     execbuf.buffers_ptr = (uintptr_t)bufmgr_gem->exec2_objects;
     execbuf.buffer_count = bufmgr_gem->exec_count;
@@ -3295,6 +3965,26 @@ skip_execution:
     return ret;
 }
 
+drm_export int
+do_exec2(struct mos_linux_bo *bo, int used, struct mos_linux_context *ctx,
+     drm_clip_rect_t *cliprects, int num_cliprects, int DR4,
+     unsigned int flags, int *fence
+     )
+{
+    struct mos_bufmgr_gem *bufmgr_gem = (struct mos_bufmgr_gem *)bo->bufmgr;
+    int ret;
+
+    /* Keep submission order with execs still queued for the submit thread */
+    mos_gem_wait_async_exec(bufmgr_gem);
+
+    ret = mos_gem_take_async_exec_error(bufmgr_gem);
+    if (ret != 0)
+        return ret;
+
+    return __do_exec2(bo, used, ctx, cliprects, num_cliprects, DR4,
+            flags, fence);
+}
+
 drm_export int
 do_exec3(struct mos_linux_bo **bo, int _num_bo, struct mos_linux_context *ctx,
      drm_clip_rect_t *cliprects, int num_cliprects, int DR4,
@@ -3313,6 +4003,11 @@ do_exec3(struct mos_linux_bo **bo, int _num_bo, struct mos_linux_context *ctx,
     int                             ret = 0;
     int                             i;
 
+    mos_gem_wait_async_exec(bufmgr_gem);
+    ret = mos_gem_take_async_exec_error(bufmgr_gem);
+    if (ret != 0)
+        return ret;
+
     pthread_mutex_lock(&bufmgr_gem->lock);
 
     struct mos_exec_info exec_info;
@@ -3346,6 +4041,7 @@ do_exec3(struct mos_linux_bo **bo, int _num_bo, struct mos_linux_context *ctx,
          * pointing to it.
          */
         mos_add_validate_buffer2(bo[i], 0);
+        to_bo_gem(bo[i])->residency_set = nullptr;
 
         if((bufmgr_gem->exec_count - 1 + num_bo) > exec_info.obj_remain_size)
         {
@@ -3551,6 +4247,210 @@ mos_gem_bo_context_exec3(struct mos_linux_bo **bo, int num_bo, struct mos_linux_
                         flags, fence);
 }
 
+static void
+mos_gem_exec_request_done(struct mos_gem_exec_request *req)
+{
+    int i;
+
+    for (i = 0; i < req->clear_count; i++) {
+        mos_gem_bo_clear_relocs(req->clear_bos[i], 0);
+        mos_gem_bo_unreference(req->clear_bos[i]);
+    }
+    if (req->residency != nullptr) {
+        for (i = 0; i < req->residency->count; i++)
+            mos_gem_bo_unreference(req->residency->entries[i].bo);
+    }
+    mos_gem_bo_unreference(req->bo);
+    free(req);
+}
+
+/* Submit thread, runs the queued execs in order on behalf of the callers */
+static void *
+mos_gem_async_exec_thread(void *arg)
+{
+    struct mos_bufmgr_gem *bufmgr_gem = (struct mos_bufmgr_gem *) arg;
+
+    pthread_mutex_lock(&bufmgr_gem->async_exec.lock);
+    while (true) {
+        struct mos_gem_exec_request *req;
+        int ret;
+
+        while (DRMLISTEMPTY(&bufmgr_gem->async_exec.requests) &&
+               !bufmgr_gem->async_exec.exit)
+            pthread_cond_wait(&bufmgr_gem->async_exec.cond,
+                      &bufmgr_gem->async_exec.lock);
+
+        if (DRMLISTEMPTY(&bufmgr_gem->async_exec.requests))
+            break;
+
+        req = DRMLISTENTRY(struct mos_gem_exec_request,
+                   bufmgr_gem->async_exec.requests.next, link);
+        DRMLISTDEL(&req->link);
+        pthread_mutex_unlock(&bufmgr_gem->async_exec.lock);
+
+        to_bo_gem(req->bo)->residency_set = req->residency;
+        ret = __do_exec2(req->bo, req->used, req->ctx, nullptr, 0,
+                 req->DR4, req->flags, nullptr);
+        atomic_set(&bufmgr_gem->async_exec.submitted_seq, req->seq);
+        mos_gem_exec_request_done(req);
+
+        pthread_mutex_lock(&bufmgr_gem->async_exec.lock);
+        if (ret != 0) {
+            MOS_DBG("async exec failed (%d)\n", ret);
+            bufmgr_gem->async_exec.last_error = ret;
+        }
+        if (atomic_dec_and_test(&bufmgr_gem->async_exec.pending))
+            pthread_cond_broadcast(&bufmgr_gem->async_exec.idle_cond);
+    }
+    pthread_mutex_unlock(&bufmgr_gem->async_exec.lock);
+
+    return nullptr;
+}
+
+/* Blocks until every queued exec has been handed to the kernel */
+static void
+mos_gem_wait_async_exec(struct mos_bufmgr_gem *bufmgr_gem)
+{
+    if (atomic_read(&bufmgr_gem->async_exec.pending) == 0)
+        return;
+
+    pthread_mutex_lock(&bufmgr_gem->async_exec.lock);
+    while (atomic_read(&bufmgr_gem->async_exec.pending) != 0)
+        pthread_cond_wait(&bufmgr_gem->async_exec.idle_cond,
+                  &bufmgr_gem->async_exec.lock);
+    pthread_mutex_unlock(&bufmgr_gem->async_exec.lock);
+}
+
+/* Returns and clears the error of the last failed async exec, 0 if none */
+static int
+mos_gem_take_async_exec_error(struct mos_bufmgr_gem *bufmgr_gem)
+{
+    int ret;
+
+    if (!bufmgr_gem->async_exec.enabled)
+        return 0;
+
+    pthread_mutex_lock(&bufmgr_gem->async_exec.lock);
+    ret = bufmgr_gem->async_exec.last_error;
+    bufmgr_gem->async_exec.last_error = 0;
+    pthread_mutex_unlock(&bufmgr_gem->async_exec.lock);
+
+    return ret;
+}
+
+/* Tags bo and everything its exec would reference with the request seq */
+static void
+mos_gem_bo_mark_async_exec(struct mos_linux_bo *bo, int seq)
+{
+    struct mos_bo_gem *bo_gem = (struct mos_bo_gem *)bo;
+    int i;
+
+    if (atomic_read(&bo_gem->async_exec_seq) == seq)
+        return;
+    atomic_set(&bo_gem->async_exec_seq, seq);
+
+    for (i = 0; i < bo_gem->reloc_count; i++)
+        mos_gem_bo_mark_async_exec(bo_gem->reloc_target_info[i].bo, seq);
+
+    for (i = 0; i < bo_gem->softpin_target_count; i++)
+        mos_gem_bo_mark_async_exec(bo_gem->softpin_target[i].bo, seq);
+}
+
+/**
+ * Queue a context exec for the submit thread and return right away.
+ *
+ * bo and clear_bos are referenced until the exec reached the kernel, the
+ * relocations and softpin targets of clear_bos are cleared afterwards. The
+ * residency set attached to bo is copied, so it may be reused right away.
+ * Execs are issued in queue order and any synchronous exec, wait or map of
+ * the buffer manager waits for the queue first. BOs referenced by a queued
+ * exec report busy until it reached the kernel. The failure of a queued
+ * exec is returned by the next exec of the buffer manager. Without
+ * mos_bufmgr_gem_enable_async_exec() the exec runs synchronously.
+ */
+int
+mos_gem_bo_context_exec2_async(struct mos_linux_bo *bo, int used, struct mos_linux_context *ctx,
+                    int DR4, unsigned int flags,
+                    struct mos_linux_bo **clear_bos, int clear_count)
+{
+    struct mos_bufmgr_gem *bufmgr_gem = (struct mos_bufmgr_gem *) bo->bufmgr;
+    struct mos_gem_residency_set *set = to_bo_gem(bo)->residency_set;
+    struct mos_gem_exec_request *req = nullptr;
+    int i, ret;
+
+    if (to_bo_gem(bo)->has_error)
+        return -ENOMEM;
+
+    /* Report the failure of an earlier queued exec to the submitter */
+    ret = mos_gem_take_async_exec_error(bufmgr_gem);
+    if (ret != 0)
+        return ret;
+
+    if (bufmgr_gem->async_exec.enabled) {
+        int residency_count;
+
+        if (set != nullptr)
+            pthread_mutex_lock(&set->lock);
+        residency_count = set ? set->count : 0;
+        req = (struct mos_gem_exec_request *)calloc(1, sizeof(*req) +
+                                 clear_count * sizeof(*clear_bos) +
+                                 (residency_count ? sizeof(*set) : 0) +
+                                 residency_count * sizeof(*set->entries));
+        if (req != nullptr && residency_count != 0) {
+            req->residency = (struct mos_gem_residency_set *)
+                ((struct mos_linux_bo **)(req + 1) + clear_count);
+            req->residency->entries = (struct mos_softpin_target *)(req->residency + 1);
+            req->residency->count = residency_count;
+            memcpy(req->residency->entries, set->entries,
+                   residency_count * sizeof(*set->entries));
+            for (i = 0; i < residency_count; i++)
+                mos_gem_bo_reference(set->entries[i].bo);
+        }
+        if (set != nullptr)
+            pthread_mutex_unlock(&set->lock);
+    }
+
+    if (req == nullptr) {
+        ret = do_exec2(bo, used, ctx, nullptr, 0, DR4, flags, nullptr);
+        for (i = 0; i < clear_count; i++)
+            mos_gem_bo_clear_relocs(clear_bos[i], 0);
+        return ret;
+    }
+
+    req->bo = bo;
+    req->ctx = ctx;
+    req->used = used;
+    req->DR4 = DR4;
+    req->flags = flags;
+    req->clear_bos = (struct mos_linux_bo **)(req + 1);
+    req->clear_count = clear_count;
+    mos_gem_bo_reference(bo);
+    for (i = 0; i < clear_count; i++) {
+        req->clear_bos[i] = clear_bos[i];
+        mos_gem_bo_reference(clear_bos[i]);
+    }
+    /* the submit thread execs with the copy */
+    to_bo_gem(bo)->residency_set = nullptr;
+
+    pthread_mutex_lock(&bufmgr_gem->async_exec.lock);
+    req->seq = (int)++bufmgr_gem->async_exec.queued_seq;
+    if (req->seq == 0)
+        req->seq = (int)++bufmgr_gem->async_exec.queued_seq;
+    mos_gem_bo_mark_async_exec(bo, req->seq);
+    for (i = 0; i < clear_count; i++)
+        mos_gem_bo_mark_async_exec(clear_bos[i], req->seq);
+    if (req->residency != nullptr) {
+        for (i = 0; i < req->residency->count; i++)
+            mos_gem_bo_mark_async_exec(req->residency->entries[i].bo, req->seq);
+    }
+    atomic_inc(&bufmgr_gem->async_exec.pending);
+    DRMLISTADDTAIL(&req->link, &bufmgr_gem->async_exec.requests);
+    pthread_cond_signal(&bufmgr_gem->async_exec.cond);
+    pthread_mutex_unlock(&bufmgr_gem->async_exec.lock);
+
+    return 0;
+}
+
 static int
 mos_gem_bo_pin(struct mos_linux_bo *bo, uint32_t alignment)
 {
@@ -3895,6 +4795,96 @@ mos_bufmgr_gem_enable_reuse(struct mos_bufmgr *bufmgr)
     bufmgr_gem->bo_reuse = true;
 }
 
+/**
+ * Enable the submit thread used by mos_gem_bo_context_exec2_async().
+ *
+ * Only softpin buffer managers are supported since relocation presumed
+ * offsets are only known once the exec returned.
+ */
+void
+mos_bufmgr_gem_enable_async_exec(struct mos_bufmgr *bufmgr)
+{
+    struct mos_bufmgr_gem *bufmgr_gem = (struct mos_bufmgr_gem *) bufmgr;
+
+    if (bufmgr_gem->async_exec.enabled || !bufmgr_gem->use_softpin)
+        return;
+
+    DRMINITLISTHEAD(&bufmgr_gem->async_exec.requests);
+    atomic_set(&bufmgr_gem->async_exec.pending, 0);
+    bufmgr_gem->async_exec.queued_seq = 0;
+    atomic_set(&bufmgr_gem->async_exec.submitted_seq, 0);
+    bufmgr_gem->async_exec.exit = false;
+    bufmgr_gem->async_exec.last_error = 0;
+    pthread_mutex_init(&bufmgr_gem->async_exec.lock, nullptr);
+    pthread_cond_init(&bufmgr_gem->async_exec.cond, nullptr);
+    pthread_cond_init(&bufmgr_gem->async_exec.idle_cond, nullptr);
+
+    if (pthread_create(&bufmgr_gem->async_exec.thread, nullptr,
+               mos_gem_async_exec_thread, bufmgr_gem) != 0) {
+        MOS_DBG("failed to create async exec thread\n");
+        pthread_cond_destroy(&bufmgr_gem->async_exec.idle_cond);
+        pthread_cond_destroy(&bufmgr_gem->async_exec.cond);
+        pthread_mutex_destroy(&bufmgr_gem->async_exec.lock);
+        return;
+    }
+
+    bufmgr_gem->async_exec.enabled = true;
+}
+
+bool
+mos_bufmgr_gem_async_exec_enabled(struct mos_bufmgr *bufmgr)
+{
+    struct mos_bufmgr_gem *bufmgr_gem = (struct mos_bufmgr_gem *) bufmgr;
+
+    return bufmgr_gem->async_exec.enabled;
+}
+
+/**
+ * Wait for all queued execs and return the last exec error since the
+ * previous call, 0 if none failed.
+ */
+int
+mos_bufmgr_gem_wait_async_exec(struct mos_bufmgr *bufmgr)
+{
+    struct mos_bufmgr_gem *bufmgr_gem = (struct mos_bufmgr_gem *) bufmgr;
+
+    if (!bufmgr_gem->async_exec.enabled)
+        return 0;
+
+    mos_gem_wait_async_exec(bufmgr_gem);
+
+    return mos_gem_take_async_exec_error(bufmgr_gem);
+}
+
+/**
+ * Get the hit/miss counters and the occupancy of one region of the BO
+ * reuse cache.
+ */
+int
+mos_bufmgr_gem_get_bo_cache_stats(struct mos_bufmgr *bufmgr,
+                    enum mos_bo_cache_region region,
+                    struct mos_bo_cache_stats *stats)
+{
+    struct mos_bufmgr_gem *bufmgr_gem = (struct mos_bufmgr_gem *) bufmgr;
+    struct mos_gem_bo_cache_region *cache;
+
+    if (bufmgr_gem == nullptr || stats == nullptr ||
+        (int)region >= MOS_BO_CACHE_REGION_COUNT)
+        return -EINVAL;
+
+    cache = &bufmgr_gem->cache_region[region];
+
+    pthread_mutex_lock(&bufmgr_gem->lock);
+    stats->hits         = cache->hits;
+    stats->misses       = cache->misses;
+    stats->evictions    = cache->evictions;
+    stats->cached_bytes = cache->cached_bytes;
+    stats->budget_bytes = cache->budget_bytes;
+    pthread_mutex_unlock(&bufmgr_gem->lock);
+
+    return 0;
+}
+
 /**
  * Enable use of fenced reloc type.
  *
@@ -4143,17 +5133,32 @@ mos_gem_bo_references(struct mos_linux_bo *bo, struct mos_linux_bo *target_bo)
 }
 
 static void
-add_bucket(struct mos_bufmgr_gem *bufmgr_gem, int size)
+add_bucket(struct mos_bufmgr_gem *bufmgr_gem, unsigned long size)
 {
     unsigned int i = bufmgr_gem->num_buckets;
+    int region;
 
-    assert(i < ARRAY_SIZE(bufmgr_gem->cache_bucket));
+    assert(i < ARRAY_SIZE(bufmgr_gem->cache_region[0].cache_bucket));
 
-    DRMINITLISTHEAD(&bufmgr_gem->cache_bucket[i].head);
-    bufmgr_gem->cache_bucket[i].size = size;
+    for (region = 0; region < MOS_BO_CACHE_REGION_COUNT; region++) {
+        DRMINITLISTHEAD(&bufmgr_gem->cache_region[region].cache_bucket[i].head);
+        bufmgr_gem->cache_region[region].cache_bucket[i].size = size;
+    }
     bufmgr_gem->num_buckets++;
 }
 
+static uint64_t
+mos_gem_bo_cache_budget(const char *env, uint64_t default_mb)
+{
+    const char *budget = getenv(env);
+    uint64_t mb = default_mb;
+
+    if (budget != nullptr)
+        mb = strtoull(budget, nullptr, 0);
+
+    return mb * 1024 * 1024;
+}
+
 static void
 init_cache_buckets(struct mos_bufmgr_gem *bufmgr_gem)
 {
@@ -4179,6 +5184,13 @@ init_cache_buckets(struct mos_bufmgr_gem *bufmgr_gem)
         add_bucket(bufmgr_gem, size + size * 2 / 4);
         add_bucket(bufmgr_gem, size + size * 3 / 4);
     }
+    assert(bufmgr_gem->num_buckets <= MOS_BO_CACHE_FIXED_BUCKETS);
+
+    /* Separate budgets so LMEM BOs are not evicted because of SMEM pressure */
+    bufmgr_gem->cache_region[MOS_BO_CACHE_REGION_SMEM].budget_bytes =
+        mos_gem_bo_cache_budget("INTEL_BO_CACHE_SMEM_BUDGET_MB", MOS_BO_CACHE_DEFAULT_SMEM_BUDGET_MB);
+    bufmgr_gem->cache_region[MOS_BO_CACHE_REGION_LMEM].budget_bytes =
+        mos_gem_bo_cache_budget("INTEL_BO_CACHE_LMEM_BUDGET_MB", MOS_BO_CACHE_DEFAULT_LMEM_BUDGET_MB);
 }
 
 /**
@@ -4358,6 +5370,8 @@ mos_gem_context_destroy(struct mos_linux_context *ctx)
     memclear(destroy);
 
     bufmgr_gem = (struct mos_bufmgr_gem *)ctx->bufmgr;
+    /* queued execs still reference this context */
+    mos_gem_wait_async_exec(bufmgr_gem);
     destroy.ctx_id = ctx->ctx_id;
     ret = drmIoctl(bufmgr_gem->fd, DRM_IOCTL_I915_GEM_CONTEXT_DESTROY,
                &destroy);
@@ -4868,6 +5882,7 @@ mos_bufmgr_gem_init(int fd, int batch_size)
     bufmgr_gem->bufmgr.bo_references = mos_gem_bo_references;
 
     DRMINITLISTHEAD(&bufmgr_gem->named);
+    DRMINITLISTHEAD(&bufmgr_gem->residency_sets);
     init_cache_buckets(bufmgr_gem);
 
     DRMLISTADD(&bufmgr_gem->managers, &bufmgr_list);
@@ -179,10 +179,15 @@ MOS_STATUS  AuxTableMgr::MapResource(GMM_RESOURCE_INFO *gmmResInfo, MOS_LINUX_BO
         return MOS_STATUS_NULL_POINTER;
     }
 
+    // Called for every allocation on every submission, skip the GMM query once mapped
+    if (bo->aux_mapped)
+    {
+        return MOS_STATUS_SUCCESS;
+    }
+
     GMM_RESOURCE_FLAG flags = gmmResInfo->GetResFlags(); 
     if ((flags.Info.MediaCompressed || flags.Info.RenderCompressed) && 
-        (flags.Gpu.MMC && flags.Gpu.CCS)                            &&
-        (bo->aux_mapped == false))
+        (flags.Gpu.MMC && flags.Gpu.CCS))
     {
         int ret = 0;
 
@@ -1012,6 +1012,7 @@ DdiVp_SetProcPipelineParams(
 
     DDI_CHK_NULL(pMediaSrcSurf, "Null pMediaSrcSurf.", VA_STATUS_ERROR_INVALID_BUFFER);
     DDI_CHK_NULL(pOsInterface, "Null pOsInterface.", VA_STATUS_ERROR_INVALID_BUFFER);
+    DDI_CHK_RET(DdiMedia_WaitPendingDecode(pMediaCtx, pMediaSrcSurf), "Pending decode of source surface failed!");
 
     // increment surface count
     pVpHalRenderParams->uSrcCount++;
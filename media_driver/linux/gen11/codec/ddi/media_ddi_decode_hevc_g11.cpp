@@ -701,6 +701,7 @@ VAStatus DdiDecodeHEVCG11::AllocSliceControlBuffer(
     DDI_CODEC_COM_BUFFER_MGR   *bufMgr;
     uint32_t                    availSize;
     uint32_t                    newSize;
+    uint32_t                    extraSlices;
 
     bufMgr     = &(m_ddiDecodeCtx->BufMgr);
     availSize = m_sliceCtrlBufNum - bufMgr->dwNumSliceControl;
@@ -715,14 +716,17 @@ VAStatus DdiDecodeHEVCG11::AllocSliceControlBuffer(
             if (buf->iSize / buf->uiNumElements != sizeof(VASliceParameterBufferBase))
                 return VA_STATUS_ERROR_ALLOCATION_FAILED;
 
-            newSize   = sizeof(VASliceParameterBufferBase) * (m_sliceCtrlBufNum - availSize + buf->uiNumElements);
+            // in order to avoid that the buffer is reallocated multi-times,
+            // extra 10 slices are added.
+            extraSlices = buf->uiNumElements - availSize + 10;
+            newSize     = sizeof(VASliceParameterBufferBase) * (m_sliceCtrlBufNum + extraSlices);
             bufMgr->Codec_Param.Codec_Param_HEVC.pVASliceParaBufBaseHEVC = (VASliceParameterBufferBase *)realloc(bufMgr->Codec_Param.Codec_Param_HEVC.pVASliceParaBufBaseHEVC, newSize);
             if(bufMgr->Codec_Param.Codec_Param_HEVC.pVASliceParaBufBaseHEVC == nullptr)
             {
                 return VA_STATUS_ERROR_ALLOCATION_FAILED;
             }
-            MOS_ZeroMemory(bufMgr->Codec_Param.Codec_Param_HEVC.pVASliceParaBufBaseHEVC + m_sliceCtrlBufNum, sizeof(VASliceParameterBufferBase) * (buf->uiNumElements - availSize));
-            m_sliceCtrlBufNum = m_sliceCtrlBufNum - availSize + buf->uiNumElements;
+            MOS_ZeroMemory(bufMgr->Codec_Param.Codec_Param_HEVC.pVASliceParaBufBaseHEVC + m_sliceCtrlBufNum, sizeof(VASliceParameterBufferBase) * extraSlices);
+            m_sliceCtrlBufNum += extraSlices;
         }
         buf->pData      = (uint8_t*)bufMgr->Codec_Param.Codec_Param_HEVC.pVASliceParaBufBaseHEVC;
         buf->uiOffset   = bufMgr->dwNumSliceControl * sizeof(VASliceParameterBufferBase);
@@ -736,14 +740,17 @@ VAStatus DdiDecodeHEVCG11::AllocSliceControlBuffer(
                 if (buf->iSize / buf->uiNumElements != sizeof(VASliceParameterBufferHEVC))
                     return VA_STATUS_ERROR_ALLOCATION_FAILED;
 
-                newSize   = sizeof(VASliceParameterBufferHEVC) * (m_sliceCtrlBufNum - availSize + buf->uiNumElements);
+                // in order to avoid that the buffer is reallocated multi-times,
+                // extra 10 slices are added.
+                extraSlices = buf->uiNumElements - availSize + 10;
+                newSize     = sizeof(VASliceParameterBufferHEVC) * (m_sliceCtrlBufNum + extraSlices);
                 bufMgr->Codec_Param.Codec_Param_HEVC.pVASliceParaBufHEVC = (VASliceParameterBufferHEVC *)realloc(bufMgr->Codec_Param.Codec_Param_HEVC.pVASliceParaBufHEVC, newSize);
                 if(bufMgr->Codec_Param.Codec_Param_HEVC.pVASliceParaBufHEVC == nullptr)
                 {
                     return VA_STATUS_ERROR_ALLOCATION_FAILED;
                 }
-                MOS_ZeroMemory(bufMgr->Codec_Param.Codec_Param_HEVC.pVASliceParaBufHEVC + m_sliceCtrlBufNum, sizeof(VASliceParameterBufferHEVC) * (buf->uiNumElements - availSize));
-                m_sliceCtrlBufNum = m_sliceCtrlBufNum - availSize + buf->uiNumElements;
+                MOS_ZeroMemory(bufMgr->Codec_Param.Codec_Param_HEVC.pVASliceParaBufHEVC + m_sliceCtrlBufNum, sizeof(VASliceParameterBufferHEVC) * extraSlices);
+                m_sliceCtrlBufNum += extraSlices;
             }
             buf->pData      = (uint8_t*)bufMgr->Codec_Param.Codec_Param_HEVC.pVASliceParaBufHEVC;
             buf->uiOffset   = bufMgr->dwNumSliceControl * sizeof(VASliceParameterBufferHEVC);
@@ -755,14 +762,17 @@ VAStatus DdiDecodeHEVCG11::AllocSliceControlBuffer(
                 if (buf->iSize / buf->uiNumElements != sizeof(VASliceParameterBufferHEVCExtension))
                     return VA_STATUS_ERROR_ALLOCATION_FAILED;
 
-                newSize   = sizeof(VASliceParameterBufferHEVCExtension) * (m_sliceCtrlBufNum - availSize + buf->uiNumElements);
+                // in order to avoid that the buffer is reallocated multi-times,
+                // extra 10 slices are added.
+                extraSlices = buf->uiNumElements - availSize + 10;
+                newSize     = sizeof(VASliceParameterBufferHEVCExtension) * (m_sliceCtrlBufNum + extraSlices);
                 bufMgr->Codec_Param.Codec_Param_HEVC.pVASliceParaBufHEVCRext= (VASliceParameterBufferHEVCExtension*)realloc(bufMgr->Codec_Param.Codec_Param_HEVC.pVASliceParaBufHEVCRext, newSize);
                 if(bufMgr->Codec_Param.Codec_Param_HEVC.pVASliceParaBufHEVCRext== nullptr)
                 {
                     return VA_STATUS_ERROR_ALLOCATION_FAILED;
                 }
-                MOS_ZeroMemory(bufMgr->Codec_Param.Codec_Param_HEVC.pVASliceParaBufHEVCRext+ m_sliceCtrlBufNum, sizeof(VASliceParameterBufferHEVCExtension) * (buf->uiNumElements - availSize));
-                m_sliceCtrlBufNum = m_sliceCtrlBufNum - availSize + buf->uiNumElements;
+                MOS_ZeroMemory(bufMgr->Codec_Param.Codec_Param_HEVC.pVASliceParaBufHEVCRext+ m_sliceCtrlBufNum, sizeof(VASliceParameterBufferHEVCExtension) * extraSlices);
+                m_sliceCtrlBufNum += extraSlices;
             }
             buf->pData      = (uint8_t*)bufMgr->Codec_Param.Codec_Param_HEVC.pVASliceParaBufHEVCRext;
             buf->uiOffset   = bufMgr->dwNumSliceControl * sizeof(VASliceParameterBufferHEVCExtension);
@@ -2921,6 +2921,54 @@ mos_gem_bo_context_exec2(struct mos_linux_bo *bo, int used, struct mos_linux_con
                         flags,fence);
 }
 
+/* no residency sets in the mock, callers fall back to softpin targets */
+struct mos_gem_residency_set *
+mos_gem_residency_set_create(struct mos_bufmgr *bufmgr)
+{
+    return nullptr;
+}
+
+void
+mos_gem_residency_set_destroy(struct mos_gem_residency_set *set)
+{
+}
+
+void
+mos_gem_residency_set_begin(struct mos_gem_residency_set *set)
+{
+}
+
+int
+mos_gem_residency_set_add(struct mos_gem_residency_set *set,
+                struct mos_linux_bo *bo, bool write_flag)
+{
+    return -EINVAL;
+}
+
+void
+mos_gem_residency_set_end(struct mos_gem_residency_set *set)
+{
+}
+
+void
+mos_gem_bo_set_residency_set(struct mos_linux_bo *bo, struct mos_gem_residency_set *set)
+{
+}
+
+int
+mos_gem_bo_context_exec2_async(struct mos_linux_bo *bo, int used, struct mos_linux_context *ctx,
+                    int DR4, unsigned int flags,
+                    struct mos_linux_bo **clear_bos, int clear_count)
+{
+    int i, ret;
+
+    ret = do_exec2(bo, used, ctx, nullptr, 0, DR4, flags, nullptr);
+    for (i = 0; i < clear_count; i++)
+        mos_gem_bo_clear_relocs(clear_bos[i], 0);
+
+    return ret;
+}
+
 static int
 mos_gem_bo_pin(struct mos_linux_bo *bo, uint32_t alignment)
 {
@@ -3222,6 +3270,24 @@ mos_bufmgr_gem_enable_reuse(struct mos_bufmgr *bufmgr)
     bufmgr_gem->bo_reuse = true;
 }
 
+/* the mock always executes synchronously */
+void
+mos_bufmgr_gem_enable_async_exec(struct mos_bufmgr *bufmgr)
+{
+}
+
+bool
+mos_bufmgr_gem_async_exec_enabled(struct mos_bufmgr *bufmgr)
+{
+    return false;
+}
+
+int
+mos_bufmgr_gem_wait_async_exec(struct mos_bufmgr *bufmgr)
+{
+    return 0;
+}
+
 /**
  * Enable use of fenced reloc type.
  *
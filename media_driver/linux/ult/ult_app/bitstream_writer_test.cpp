@@ -0,0 +1,161 @@
+/*
+* Copyright (c) 2024, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include <vector>
+#include "gtest/gtest.h"
+#include "bitstream_writer.h"
+
+class BitstreamWriterTest: public testing::Test
+{
+public:
+    static const uint32_t BUFFER_SIZE = 256;
+
+    void SetUp() override
+    {
+        memset(m_buffer, 0, sizeof(m_buffer));
+        m_expected.clear();
+    }
+
+    // Reference writer, one bit at a time MSB first
+    void Expect(uint32_t n, uint64_t b)
+    {
+        for (uint32_t i = n; i > 0; --i)
+        {
+            m_expected.push_back((b >> (i - 1)) & 1);
+        }
+    }
+
+    void ExpectGolomb(uint32_t b)
+    {
+        uint64_t code = (uint64_t)b + 1;
+        uint32_t n = 1;
+        while (code >> n)
+        {
+            ++n;
+        }
+        Expect(n - 1, 0);
+        Expect(n, code);
+    }
+
+    void Check(BitstreamWriter &writer, uint32_t bitOffset = 0)
+    {
+        ASSERT_EQ(m_expected.size(), writer.GetOffset());
+        for (uint32_t i = 0; i < m_expected.size(); ++i)
+        {
+            uint32_t pos = i + bitOffset;
+            uint32_t bit = (m_buffer[pos >> 3] >> (7 - (pos & 7))) & 1;
+            ASSERT_EQ(m_expected[i], bit) << "at bit " << i;
+        }
+    }
+
+protected:
+    mfxU8 m_buffer[BUFFER_SIZE];
+    std::vector<uint32_t> m_expected;
+};//=================
+
+TEST_F(BitstreamWriterTest, PutBitsAllWidthsAndOffsets)
+{
+    for (uint32_t bitOffset = 0; bitOffset < 8; ++bitOffset)
+    {
+        SetUp();
+        BitstreamWriter writer(m_buffer, BUFFER_SIZE, (mfxU8)bitOffset);
+        uint32_t value = 0x9E3779B9;
+        for (uint32_t n = 1; n <= 32; ++n)
+        {
+            // Values wider than the field must not leak into neighbouring bits
+            uint32_t field = (n < 32) ? (value & ((1u << n) - 1)) : value;
+            writer.PutBits(n, field);
+            Expect(n, field);
+            value = value * 1664525 + 1013904223;
+        }
+        Check(writer, bitOffset);
+    }
+    return;
+}//========
+
+TEST_F(BitstreamWriterTest, PreservesLeadingBits)
+{
+    m_buffer[0] = 0xA5;
+    BitstreamWriter writer(m_buffer, BUFFER_SIZE, 3);
+    writer.PutBits(32, 0xFFFFFFFF);
+    writer.PutBits(5, 0);
+
+    // Bits before the start offset stay, the rest of the first byte is cleared
+    EXPECT_EQ(0xBF, m_buffer[0]);
+    EXPECT_EQ(0xFF, m_buffer[1]);
+    EXPECT_EQ(0xFF, m_buffer[2]);
+    EXPECT_EQ(0xFF, m_buffer[3]);
+    EXPECT_EQ(0xE0, m_buffer[4]);
+    EXPECT_EQ(37u, writer.GetOffset());
+    return;
+}//========
+
+TEST_F(BitstreamWriterTest, PutBitMixedWithFields)
+{
+    BitstreamWriter writer(m_buffer, BUFFER_SIZE);
+    for (uint32_t i = 0; i < 40; ++i)
+    {
+        writer.PutBit(i & 1);
+        Expect(1, i & 1);
+        writer.PutBits(i % 13 + 1, i * 37);
+        Expect(i % 13 + 1, (i * 37) & ((1u << (i % 13 + 1)) - 1));
+    }
+    Check(writer);
+    return;
+}//========
+
+TEST_F(BitstreamWriterTest, ExpGolomb)
+{
+    BitstreamWriter writer(m_buffer, BUFFER_SIZE, 5);
+    const uint32_t values[] = {0, 1, 2, 3, 7, 254, 0xFFFE, 0xFFFF, 0x10000, 0x12345678};
+    for (uint32_t value : values)
+    {
+        writer.PutUE(value);
+        ExpectGolomb(value);
+    }
+    Check(writer, 5);
+
+    SetUp();
+    writer.Reset(m_buffer, BUFFER_SIZE);
+    const mfxI32 signedValues[] = {0, 1, -1, 2, -2, 1000, -1000};
+    for (mfxI32 value : signedValues)
+    {
+        writer.PutSE(value);
+        ExpectGolomb(value > 0 ? 2 * value - 1 : -2 * value);
+    }
+    Check(writer);
+    return;
+}//========
+
+TEST_F(BitstreamWriterTest, TrailingBits)
+{
+    BitstreamWriter writer(m_buffer, BUFFER_SIZE);
+    writer.PutBits(3, 5);
+    writer.PutTrailingBits();
+    EXPECT_EQ(0xB0, m_buffer[0]);
+    EXPECT_EQ(8u, writer.GetOffset());
+
+    // Already aligned, nothing is written when alignment is checked
+    writer.PutTrailingBits(true);
+    EXPECT_EQ(8u, writer.GetOffset());
+    return;
+}//========
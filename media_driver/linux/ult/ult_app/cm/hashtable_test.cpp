@@ -0,0 +1,171 @@
+/*
+* Copyright (c) 2024, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "gtest/gtest.h"
+#include "cm_hal_hashtable.h"
+
+class HashTableTest: public testing::Test
+{
+public:
+    void SetUp() override
+    {
+        ASSERT_EQ(MOS_STATUS_SUCCESS, m_table.Init());
+    }
+
+    void TearDown() override
+    {
+        m_table.Free();
+    }
+
+    static void* Data(int32_t uniqID, int32_t cacheID)
+    {
+        return reinterpret_cast<void*>(
+            (static_cast<uintptr_t>(uniqID) << 16) | static_cast<uintptr_t>(cacheID + 1));
+    }
+
+    void* Find(int32_t uniqID, int32_t cacheID)
+    {
+        uint16_t search_index = 0;
+        return m_table.Search(uniqID, cacheID, search_index);
+    }
+
+protected:
+    CmHashTable m_table;
+};//=================
+
+TEST_F(HashTableTest, RegisterSearch)
+{
+    for (int32_t i = 0; i < CM_HAL_HASHTABLE_INITIAL * 4; ++i)
+    {
+        EXPECT_EQ(MOS_STATUS_SUCCESS, m_table.Register(i, i & 3, Data(i, i & 3)));
+    }
+    for (int32_t i = 0; i < CM_HAL_HASHTABLE_INITIAL * 4; ++i)
+    {
+        EXPECT_EQ(Data(i, i & 3), Find(i, i & 3));
+        EXPECT_EQ(nullptr, Find(i, (i & 3) + 1));
+    }
+    EXPECT_EQ(nullptr, Find(CM_HAL_HASHTABLE_INITIAL * 4, 0));
+    return;
+}//========
+
+TEST_F(HashTableTest, SearchAnyCacheID)
+{
+    const int32_t cache_count = 5;
+    for (int32_t cache_id = 0; cache_id < cache_count; ++cache_id)
+    {
+        EXPECT_EQ(MOS_STATUS_SUCCESS, m_table.Register(7, cache_id, Data(7, cache_id)));
+        EXPECT_EQ(MOS_STATUS_SUCCESS, m_table.Register(8, cache_id, Data(8, cache_id)));
+    }
+
+    // Negative CacheID matches any CacheID, search index continues the probe run
+    uint32_t found_mask = 0;
+    uint16_t search_index = 0;
+    void *data = nullptr;
+    int32_t found_count = 0;
+    while ((data = m_table.Search(7, -1, search_index)) != nullptr)
+    {
+        for (int32_t cache_id = 0; cache_id < cache_count; ++cache_id)
+        {
+            if (data == Data(7, cache_id))
+            {
+                found_mask |= 1 << cache_id;
+            }
+        }
+        ++found_count;
+        ASSERT_LE(found_count, cache_count);
+    }
+    EXPECT_EQ(cache_count, found_count);
+    EXPECT_EQ((1u << cache_count) - 1, found_mask);
+    EXPECT_EQ(0, search_index);
+    return;
+}//========
+
+TEST_F(HashTableTest, LoadFactorLimit)
+{
+    for (int32_t i = 0; i < CM_HAL_HASHTABLE_MAX; ++i)
+    {
+        ASSERT_EQ(MOS_STATUS_SUCCESS, m_table.Register(i, 0, Data(i, 0)));
+    }
+    EXPECT_NE(MOS_STATUS_SUCCESS, m_table.Register(CM_HAL_HASHTABLE_MAX, 0, Data(CM_HAL_HASHTABLE_MAX, 0)));
+
+    for (int32_t i = 0; i < CM_HAL_HASHTABLE_MAX; ++i)
+    {
+        EXPECT_EQ(Data(i, 0), Find(i, 0));
+    }
+    EXPECT_EQ(nullptr, Find(CM_HAL_HASHTABLE_MAX, 0));
+
+    // A removed entry frees room for one more
+    EXPECT_EQ(Data(0, 0), m_table.Unregister(0, 0));
+    EXPECT_EQ(MOS_STATUS_SUCCESS, m_table.Register(CM_HAL_HASHTABLE_MAX, 0, Data(CM_HAL_HASHTABLE_MAX, 0)));
+    EXPECT_EQ(Data(CM_HAL_HASHTABLE_MAX, 0), Find(CM_HAL_HASHTABLE_MAX, 0));
+    return;
+}//========
+
+TEST_F(HashTableTest, UnregisterFullTable)
+{
+    for (int32_t i = 0; i < CM_HAL_HASHTABLE_MAX; ++i)
+    {
+        ASSERT_EQ(MOS_STATUS_SUCCESS, m_table.Register(i, 0, Data(i, 0)));
+    }
+
+    // Backward shift deletion must keep every remaining entry reachable
+    for (int32_t i = 0; i < CM_HAL_HASHTABLE_MAX; i += 2)
+    {
+        EXPECT_EQ(Data(i, 0), m_table.Unregister(i, 0));
+    }
+    EXPECT_EQ(nullptr, m_table.Unregister(0, 0));
+    for (int32_t i = 0; i < CM_HAL_HASHTABLE_MAX; ++i)
+    {
+        EXPECT_EQ((i & 1) ? Data(i, 0) : nullptr, Find(i, 0));
+    }
+
+    for (int32_t i = 0; i < CM_HAL_HASHTABLE_MAX; i += 2)
+    {
+        EXPECT_EQ(MOS_STATUS_SUCCESS, m_table.Register(i, 0, Data(i, 0)));
+    }
+    for (int32_t i = 0; i < CM_HAL_HASHTABLE_MAX; ++i)
+    {
+        EXPECT_EQ(Data(i, 0), Find(i, 0));
+    }
+    return;
+}//========
+
+TEST_F(HashTableTest, UnregisterWithinProbeRun)
+{
+    // Same UniqID shares one home slot, so these entries form a single probe run
+    const int32_t cache_count = 8;
+    for (int32_t cache_id = 0; cache_id < cache_count; ++cache_id)
+    {
+        EXPECT_EQ(MOS_STATUS_SUCCESS, m_table.Register(3, cache_id, Data(3, cache_id)));
+    }
+
+    EXPECT_EQ(Data(3, 0), m_table.Unregister(3, 0));
+    EXPECT_EQ(Data(3, 4), m_table.Unregister(3, 4));
+    EXPECT_EQ(Data(3, cache_count - 1), m_table.Unregister(3, cache_count - 1));
+
+    for (int32_t cache_id = 0; cache_id < cache_count; ++cache_id)
+    {
+        bool removed = (cache_id == 0 || cache_id == 4 || cache_id == cache_count - 1);
+        EXPECT_EQ(removed ? nullptr : Data(3, cache_id), Find(3, cache_id));
+    }
+    return;
+}//========
@@ -0,0 +1,117 @@
+/*
+* Copyright (c) 2024, Intel Corporation
+*
+* Permission is hereby granted, free of charge, to any person obtaining a
+* copy of this software and associated documentation files (the "Software"),
+* to deal in the Software without restriction, including without limitation
+* the rights to use, copy, modify, merge, publish, distribute, sublicense,
+* and/or sell copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+* OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+* OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "cm_test.h"
+
+using CMRT_UMD::CmBuffer;
+class SurfaceIndexTest: public CmTest
+{
+public:
+    static const uint32_t BUFFER_COUNT = 4;
+    static const uint32_t SIZE = 64;
+
+    SurfaceIndexTest() {}
+
+    ~SurfaceIndexTest() {}
+
+    int32_t CreateBuffer(CmBuffer *&buffer, uint32_t &index)
+    {
+        int32_t result = m_mockDevice->CreateBuffer(SIZE, buffer);
+        if (result != CM_SUCCESS)
+        {
+            return result;
+        }
+        SurfaceIndex *surface_index = nullptr;
+        result = buffer->GetIndex(surface_index);
+        EXPECT_EQ(CM_SUCCESS, result);
+        EXPECT_NE(nullptr, surface_index);
+        index = surface_index->get_data();
+        return result;
+    }//===============================================
+
+    int32_t ReuseInLifoOrder()
+    {
+        CmBuffer *buffers[BUFFER_COUNT] = {nullptr};
+        uint32_t indices[BUFFER_COUNT] = {0};
+        for (uint32_t i = 0; i < BUFFER_COUNT; ++i)
+        {
+            int32_t result = CreateBuffer(buffers[i], indices[i]);
+            EXPECT_EQ(CM_SUCCESS, result);
+        }
+
+        // Released indices are handed out again, most recently released first
+        EXPECT_EQ(CM_SUCCESS, m_mockDevice->DestroySurface(buffers[1]));
+        EXPECT_EQ(CM_SUCCESS, m_mockDevice->DestroySurface(buffers[3]));
+
+        uint32_t index = 0;
+        EXPECT_EQ(CM_SUCCESS, CreateBuffer(buffers[3], index));
+        EXPECT_EQ(indices[3], index);
+        EXPECT_EQ(CM_SUCCESS, CreateBuffer(buffers[1], index));
+        EXPECT_EQ(indices[1], index);
+
+        // Once no released index is left, a new one is used
+        CmBuffer *another_buffer = nullptr;
+        EXPECT_EQ(CM_SUCCESS, CreateBuffer(another_buffer, index));
+        for (uint32_t i = 0; i < BUFFER_COUNT; ++i)
+        {
+            EXPECT_NE(indices[i], index);
+        }
+        EXPECT_EQ(CM_SUCCESS, m_mockDevice->DestroySurface(another_buffer));
+
+        for (uint32_t i = 0; i < BUFFER_COUNT; ++i)
+        {
+            EXPECT_EQ(CM_SUCCESS, m_mockDevice->DestroySurface(buffers[i]));
+        }
+        return CM_SUCCESS;
+    }//===============================================
+
+    int32_t ReuseAfterRepeatedDestroy()
+    {
+        CmBuffer *buffer = nullptr;
+        uint32_t first_index = 0;
+        EXPECT_EQ(CM_SUCCESS, CreateBuffer(buffer, first_index));
+        EXPECT_EQ(CM_SUCCESS, m_mockDevice->DestroySurface(buffer));
+
+        for (uint32_t i = 0; i < 100; ++i)
+        {
+            uint32_t index = 0;
+            EXPECT_EQ(CM_SUCCESS, CreateBuffer(buffer, index));
+            EXPECT_EQ(first_index, index);
+            EXPECT_EQ(CM_SUCCESS, m_mockDevice->DestroySurface(buffer));
+        }
+        return CM_SUCCESS;
+    }//===============================================
+};//=================
+
+TEST_F(SurfaceIndexTest, ReuseInLifoOrder)
+{
+    RunEach<int32_t>(CM_SUCCESS,
+                     [this]() { return ReuseInLifoOrder(); });
+    return;
+}//========
+
+TEST_F(SurfaceIndexTest, ReuseAfterRepeatedDestroy)
+{
+    RunEach<int32_t>(CM_SUCCESS,
+                     [this]() { return ReuseAfterRepeatedDestroy(); });
+    return;
+}//========
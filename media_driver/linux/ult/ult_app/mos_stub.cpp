@@ -19,6 +19,7 @@
 * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
 * OTHER DEALINGS IN THE SOFTWARE.
 */
+#include <cstdlib>
 #include <cstring>
 #include "mos_utilities.h"
 using namespace std;
@@ -31,3 +32,33 @@ void MosUtilities::MosZeroMemory(void *pDestination, size_t stLength)
     }
 }
 
+#if MOS_MESSAGES_ENABLED
+void *MosUtilities::MosAllocMemoryUtils(
+    size_t     size,
+    const char *functionName,
+    const char *filename,
+    int32_t    line)
+{
+    return malloc(size);
+}
+
+void MosUtilities::MosFreeMemoryUtils(
+    void       *ptr,
+    const char *functionName,
+    const char *filename,
+    int32_t    line)
+{
+    free(ptr);
+}
+#else // !MOS_MESSAGES_ENABLED
+void *MosUtilities::MosAllocMemory(size_t size)
+{
+    return malloc(size);
+}
+
+void MosUtilities::MosFreeMemory(void *ptr)
+{
+    free(ptr);
+}
+#endif // MOS_MESSAGES_ENABLED
+
@@ -41,6 +41,9 @@ MOS_STATUS DecodeAvcPipelineAdapterM12::BeginFrame()
 {
     DECODE_FUNC_CALL();
 
+    // Previous picture must be done with the DDI owned parameters
+    DECODE_CHK_STATUS(m_decoder->WaitPipelinedExecution(true));
+
     decode::DecodePipelineParams decodeParams;
     decodeParams.m_pipeMode = decode::decodePipeModeBegin;
     DECODE_CHK_STATUS(m_decoder->Prepare(&decodeParams));
@@ -53,8 +56,7 @@ MOS_STATUS DecodeAvcPipelineAdapterM12::EndFrame()
 
     decode::DecodePipelineParams decodeParams;
     decodeParams.m_pipeMode = decode::decodePipeModeEnd;
-    DECODE_CHK_STATUS(m_decoder->Prepare(&decodeParams));
-    return m_decoder->Execute();
+    return m_decoder->ExecuteFrame(decodeParams);
 }
 
 MOS_STATUS DecodeAvcPipelineAdapterM12::Allocate(CodechalSetting *codecHalSettings)
@@ -74,8 +76,7 @@ MOS_STATUS DecodeAvcPipelineAdapterM12::Execute(void *params)
     decode::DecodePipelineParams decodeParams;
     decodeParams.m_params = (CodechalDecodeParams*)params;
     decodeParams.m_pipeMode = decode::decodePipeModeProcess;
-    DECODE_CHK_STATUS(m_decoder->Prepare(&decodeParams));
-    return m_decoder->Execute();
+    return m_decoder->ExecuteFrame(decodeParams);
 }
 
 MOS_STATUS DecodeAvcPipelineAdapterM12::GetStatusReport(
@@ -84,17 +85,20 @@ MOS_STATUS DecodeAvcPipelineAdapterM12::GetStatusReport(
 {
     DECODE_FUNC_CALL();
 
+    m_decoder->WaitPipelinedExecution();
     return m_decoder->GetStatusReport(status, numStatus);
 }
 
 bool DecodeAvcPipelineAdapterM12::IsIncompletePicture()
 {
+     m_decoder->WaitPipelinedExecution();
      return (!m_decoder->IsCompleteBitstream());
 }
 
 #ifdef _DECODE_PROCESSING_SUPPORTED
 bool DecodeAvcPipelineAdapterM12::IsDownSamplingSupported()
 {
+    m_decoder->WaitPipelinedExecution();
     return m_decoder->IsDownSamplingSupported();
 }
 #endif
@@ -119,6 +123,7 @@ void DecodeAvcPipelineAdapterM12::SetDummyReferenceStatus(CODECHAL_DUMMY_REFEREN
 
 uint32_t DecodeAvcPipelineAdapterM12::GetCompletedReport()
 {
+    m_decoder->WaitPipelinedExecution();
     return m_decoder->GetCompletedReport();
 }
 
@@ -126,6 +131,7 @@ void DecodeAvcPipelineAdapterM12::Destroy()
 {
     DECODE_FUNC_CALL();
 
+    m_decoder->WaitPipelinedExecution();
     m_decoder->Destroy();
 }
 
@@ -136,3 +142,10 @@ MOS_GPU_CONTEXT DecodeAvcPipelineAdapterM12::GetDecodeContext()
     return m_decoder->GetDecodeContext();
 }
 
+MOS_STATUS DecodeAvcPipelineAdapterM12::WaitPendingExecute()
+{
+    DECODE_FUNC_CALL();
+
+    return m_decoder->WaitPipelinedExecution();
+}
+
@@ -162,6 +162,32 @@ MOS_STATUS HevcDecodeSlcPktM12::AddRefIdxState(
     MHW_VDBOX_HEVC_REF_IDX_PARAMS_G12 refIdxParams;
 
     DECODE_CHK_STATUS(SetRefIdxParams(refIdxParams, sliceIdx));
+
+    // Besides picture level parameters, ref idx commands only depend on slice type and
+    // the fixed slice ref lists, replay them if previous slice has the same ones
+    struct
+    {
+        bool          bSlice;
+        bool          dummyReference;
+        uint8_t       numRefForList[2];
+        CODEC_PICTURE refPicList[2][CODEC_MAX_NUM_REF_FRAME_HEVC];
+    } key;
+    MOS_ZeroMemory(&key, sizeof(key));
+    key.bSlice           = m_hcpInterface->IsHevcBSlice(sliceParams->LongSliceFlags.fields.slice_type);
+    key.dummyReference   = refIdxParams.bDummyReference;
+    key.numRefForList[0] = refIdxParams.ucNumRefForList;
+    key.numRefForList[1] = key.bSlice ? (sliceParams->num_ref_idx_l1_active_minus1 + 1) : 0;
+    DECODE_CHK_STATUS(MOS_SecureMemcpy(key.refPicList, sizeof(key.refPicList),
+                                       refIdxParams.RefPicList, sizeof(refIdxParams.RefPicList)));
+
+    bool replayed = false;
+    DECODE_CHK_STATUS(ReplaySliceCmds(cmdBuffer, m_refIdxCmdRecord, &key, sizeof(key), replayed));
+    if (replayed)
+    {
+        return MOS_STATUS_SUCCESS;
+    }
+
+    int32_t startOffset = cmdBuffer.iOffset;
     DECODE_CHK_STATUS(m_hcpInterface->AddHcpRefIdxStateCmd(&cmdBuffer, nullptr, &refIdxParams));
 
     if (m_hcpInterface->IsHevcBSlice(sliceParams->LongSliceFlags.fields.slice_type))
@@ -171,6 +197,8 @@ MOS_STATUS HevcDecodeSlcPktM12::AddRefIdxState(
         DECODE_CHK_STATUS(m_hcpInterface->AddHcpRefIdxStateCmd(&cmdBuffer, nullptr, &refIdxParams));
     }
 
+    DECODE_CHK_STATUS(RecordSliceCmds(cmdBuffer, startOffset, m_refIdxCmdRecord, &key, sizeof(key)));
+
     return MOS_STATUS_SUCCESS;
 }
 
@@ -69,6 +69,51 @@ MOS_STATUS HevcDecodeSlcPktXe_M_Base::Prepare()
     m_hevcRextSliceParams = m_hevcBasicFeature->m_hevcRextSliceParams;
     m_hevcSccPicParams    = m_hevcBasicFeature->m_hevcSccPicParams;
 
+    // Recorded commands depend on picture level parameters, only replay within one picture
+    m_refIdxCmdRecord.key.clear();
+    m_weightOffsetCmdRecord.key.clear();
+
+    return MOS_STATUS_SUCCESS;
+}
+
+MOS_STATUS HevcDecodeSlcPktXe_M_Base::ReplaySliceCmds(
+    MOS_COMMAND_BUFFER   &cmdBuffer,
+    const SliceCmdRecord &record,
+    const void           *key,
+    uint32_t              keySize,
+    bool                 &replayed)
+{
+    DECODE_CHK_NULL(key);
+
+    replayed = false;
+    if (record.cmds.empty() || record.key.size() != keySize ||
+        memcmp(record.key.data(), key, keySize) != 0)
+    {
+        return MOS_STATUS_SUCCESS;
+    }
+
+    DECODE_CHK_STATUS(Mhw_AddCommandCmdOrBB(&cmdBuffer, nullptr, record.cmds.data(), (uint32_t)record.cmds.size()));
+    replayed = true;
+
+    return MOS_STATUS_SUCCESS;
+}
+
+MOS_STATUS HevcDecodeSlcPktXe_M_Base::RecordSliceCmds(
+    MOS_COMMAND_BUFFER &cmdBuffer,
+    int32_t             startOffset,
+    SliceCmdRecord     &record,
+    const void         *key,
+    uint32_t            keySize)
+{
+    DECODE_CHK_NULL(key);
+    DECODE_CHK_NULL(cmdBuffer.pCmdBase);
+    DECODE_CHK_COND(startOffset > cmdBuffer.iOffset, "Invalid start offset of slice commands!");
+
+    const uint8_t *cmds     = (const uint8_t *)cmdBuffer.pCmdBase + startOffset;
+    const uint8_t *keyBytes = (const uint8_t *)key;
+    record.cmds.assign(cmds, cmds + (cmdBuffer.iOffset - startOffset));
+    record.key.assign(keyBytes, keyBytes + keySize);
+
     return MOS_STATUS_SUCCESS;
 }
 
@@ -237,6 +282,26 @@ MOS_STATUS HevcDecodeSlcPktXe_M_Base::AddWeightOffset(
         MOS_ZeroMemory(&weightOffsetParams, sizeof(weightOffsetParams));
 
         DECODE_CHK_STATUS(SetWeightOffsetParams(weightOffsetParams, sliceIdx));
+
+        // Weight offset commands only depend on the weight offset params, replay them
+        // if previous slice has the same weights and offsets
+        struct
+        {
+            MHW_VDBOX_HEVC_WEIGHTOFFSET_PARAMS params;
+            bool                               weightedBiPred;
+        } key;
+        MOS_ZeroMemory(&key, sizeof(key));
+        DECODE_CHK_STATUS(MOS_SecureMemcpy(&key.params, sizeof(key.params), &weightOffsetParams, sizeof(weightOffsetParams)));
+        key.weightedBiPred = weightedBiPred;
+
+        bool replayed = false;
+        DECODE_CHK_STATUS(ReplaySliceCmds(cmdBuffer, m_weightOffsetCmdRecord, &key, sizeof(key), replayed));
+        if (replayed)
+        {
+            return MOS_STATUS_SUCCESS;
+        }
+
+        int32_t startOffset = cmdBuffer.iOffset;
         DECODE_CHK_STATUS(m_hcpInterface->AddHcpWeightOffsetStateCmd(&cmdBuffer, nullptr, &weightOffsetParams));
 
         if (weightedBiPred)
@@ -244,6 +309,8 @@ MOS_STATUS HevcDecodeSlcPktXe_M_Base::AddWeightOffset(
             weightOffsetParams.ucList = 1;
             DECODE_CHK_STATUS(m_hcpInterface->AddHcpWeightOffsetStateCmd(&cmdBuffer, nullptr, &weightOffsetParams));
         }
+
+        DECODE_CHK_STATUS(RecordSliceCmds(cmdBuffer, startOffset, m_weightOffsetCmdRecord, &key, sizeof(key)));
     }
 
     return MOS_STATUS_SUCCESS;
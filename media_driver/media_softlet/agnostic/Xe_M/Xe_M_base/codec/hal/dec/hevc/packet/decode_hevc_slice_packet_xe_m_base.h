@@ -111,6 +111,54 @@ protected:
     //!
     virtual MOS_STATUS CalculateSliceStateCommandSize();
 
+    //!
+    //! \brief  Commands recorded from a previous slice of the current picture
+    //!
+    struct SliceCmdRecord
+    {
+        std::vector<uint8_t> key;   //!< Slice variant inputs which the commands are generated from
+        std::vector<uint8_t> cmds;  //!< Recorded command stream
+    };
+
+    //!
+    //! \brief  Replay recorded slice commands if they were generated from the same inputs
+    //! \details Only for commands without resource, since no patch is applied on replay
+    //!
+    //! \param  [in] cmdBuffer
+    //!         Command buffer
+    //! \param  [in] record
+    //!         Slice command record
+    //! \param  [in] key
+    //!         Slice variant inputs of the commands to add
+    //! \param  [in] keySize
+    //!         Size of key in bytes
+    //! \param  [out] replayed
+    //!         true if the recorded commands are added to command buffer
+    //! \return MOS_STATUS
+    //!         MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    MOS_STATUS ReplaySliceCmds(MOS_COMMAND_BUFFER &cmdBuffer, const SliceCmdRecord &record,
+                               const void *key, uint32_t keySize, bool &replayed);
+
+    //!
+    //! \brief  Record the commands added to command buffer since startOffset
+    //!
+    //! \param  [in] cmdBuffer
+    //!         Command buffer
+    //! \param  [in] startOffset
+    //!         Offset of the first command to record in command buffer
+    //! \param  [in, out] record
+    //!         Slice command record
+    //! \param  [in] key
+    //!         Slice variant inputs of the recorded commands
+    //! \param  [in] keySize
+    //!         Size of key in bytes
+    //! \return MOS_STATUS
+    //!         MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    MOS_STATUS RecordSliceCmds(MOS_COMMAND_BUFFER &cmdBuffer, int32_t startOffset, SliceCmdRecord &record,
+                               const void *key, uint32_t keySize);
+
     HevcPipeline *         m_hevcPipeline     = nullptr;
     MhwVdboxHcpInterface * m_hcpInterface     = nullptr;
     HevcBasicFeature *     m_hevcBasicFeature = nullptr;
@@ -125,6 +173,9 @@ protected:
 
     uint32_t m_sliceStatesSize      = 0;  //!< Slice state command size
     uint32_t m_slicePatchListSize   = 0;  //!< Slice patch list size
+
+    SliceCmdRecord m_refIdxCmdRecord;        //!< Ref idx state commands of previous slice
+    SliceCmdRecord m_weightOffsetCmdRecord;  //!< Weight offset state commands of previous slice
 MEDIA_CLASS_DEFINE_END(decode__HevcDecodeSlcPktXe_M_Base)
 };
 
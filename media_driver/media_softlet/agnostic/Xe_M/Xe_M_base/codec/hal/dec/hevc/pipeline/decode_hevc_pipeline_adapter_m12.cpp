@@ -44,6 +44,9 @@ MOS_STATUS DecodeHevcPipelineAdapterM12::BeginFrame()
 {
     DECODE_FUNC_CALL();
 
+    // Previous picture must be done with the DDI owned parameters
+    DECODE_CHK_STATUS(m_decoder->WaitPipelinedExecution(true));
+
     decode::DecodePipelineParams decodeParams;
     decodeParams.m_pipeMode = decode::decodePipeModeBegin;
     DECODE_CHK_STATUS(m_decoder->Prepare(&decodeParams));
@@ -56,8 +59,7 @@ MOS_STATUS DecodeHevcPipelineAdapterM12::EndFrame()
 
     decode::DecodePipelineParams decodeParams;
     decodeParams.m_pipeMode = decode::decodePipeModeEnd;
-    DECODE_CHK_STATUS(m_decoder->Prepare(&decodeParams));
-    return m_decoder->Execute();
+    return m_decoder->ExecuteFrame(decodeParams);
 }
 
 MOS_STATUS DecodeHevcPipelineAdapterM12::Allocate(CodechalSetting *codecHalSettings)
@@ -77,8 +79,7 @@ MOS_STATUS DecodeHevcPipelineAdapterM12::Execute(void    *params)
     decode::DecodePipelineParams decodeParams;
     decodeParams.m_params = (CodechalDecodeParams*)params;
     decodeParams.m_pipeMode = decode::decodePipeModeProcess;
-    DECODE_CHK_STATUS(m_decoder->Prepare(&decodeParams));
-    return m_decoder->Execute();
+    return m_decoder->ExecuteFrame(decodeParams);
 }
 
 MOS_STATUS DecodeHevcPipelineAdapterM12::GetStatusReport(
@@ -87,17 +88,20 @@ MOS_STATUS DecodeHevcPipelineAdapterM12::GetStatusReport(
 {
     DECODE_FUNC_CALL();
 
+    m_decoder->WaitPipelinedExecution();
     return m_decoder->GetStatusReport(status, numStatus);
 }
 
 bool DecodeHevcPipelineAdapterM12::IsIncompletePicture()
 {
+     m_decoder->WaitPipelinedExecution();
      return (!m_decoder->IsCompleteBitstream());
 }
 
 #ifdef _DECODE_PROCESSING_SUPPORTED
 bool DecodeHevcPipelineAdapterM12::IsDownSamplingSupported()
 {
+    m_decoder->WaitPipelinedExecution();
     return m_decoder->IsDownSamplingSupported();
 }
 #endif
@@ -122,6 +126,7 @@ void DecodeHevcPipelineAdapterM12::SetDummyReferenceStatus(CODECHAL_DUMMY_REFERE
 
 uint32_t DecodeHevcPipelineAdapterM12::GetCompletedReport()
 {
+    m_decoder->WaitPipelinedExecution();
     return m_decoder->GetCompletedReport();
 }
 
@@ -129,6 +134,7 @@ void DecodeHevcPipelineAdapterM12::Destroy()
 {
     DECODE_FUNC_CALL();
 
+    m_decoder->WaitPipelinedExecution();
     m_decoder->Destroy();
 }
 
@@ -139,4 +145,11 @@ MOS_GPU_CONTEXT DecodeHevcPipelineAdapterM12::GetDecodeContext()
     return m_decoder->GetDecodeContext();
 }
 
+MOS_STATUS DecodeHevcPipelineAdapterM12::WaitPendingExecute()
+{
+    DECODE_FUNC_CALL();
+
+    return m_decoder->WaitPipelinedExecution();
+}
+
 
@@ -69,6 +69,8 @@ public:
 
     virtual MOS_GPU_CONTEXT GetDecodeContext() override;
 
+    virtual MOS_STATUS WaitPendingExecute() override;
+
 protected:
     std::shared_ptr<decode::HevcPipelineM12> m_decoder;
 MEDIA_CLASS_DEFINE_END(DecodeHevcPipelineAdapterM12)
@@ -91,6 +91,7 @@ MOS_STATUS HevcPipelineM12::InitScalabOption(HevcBasicFeature &basicFeature)
     MOS_ZeroMemory(&scalPars, sizeof(scalPars));
     DECODE_CHK_STATUS(InitContexOption(scalPars));
     scalPars.isSCC         = (basicFeature.m_hevcSccPicParams != nullptr);
+    scalPars.isNonIrapPic  = !picParams->IrapPicFlag;
 #ifdef _DECODE_PROCESSING_SUPPORTED
     DecodeDownSamplingFeature* downSamplingFeature = dynamic_cast<DecodeDownSamplingFeature*>(
         m_featureManager->GetFeature(DecodeFeatureIDs::decodeDownSampling));
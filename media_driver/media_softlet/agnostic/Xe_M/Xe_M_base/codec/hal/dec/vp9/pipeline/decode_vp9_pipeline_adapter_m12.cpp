@@ -40,6 +40,10 @@ DecodeVp9PipelineAdapterG12::DecodeVp9PipelineAdapterG12(
 MOS_STATUS DecodeVp9PipelineAdapterG12::BeginFrame()
 {
     DECODE_FUNC_CALL();
+
+    // Previous picture must be done with the DDI owned parameters
+    DECODE_CHK_STATUS(m_decoder->WaitPipelinedExecution(true));
+
     decode::DecodePipelineParams decodeParams;
     decodeParams.m_pipeMode = decode::decodePipeModeBegin;
     DECODE_CHK_STATUS(m_decoder->Prepare(&decodeParams));
@@ -51,8 +55,7 @@ MOS_STATUS DecodeVp9PipelineAdapterG12::EndFrame()
     DECODE_FUNC_CALL();
     decode::DecodePipelineParams decodeParams;
     decodeParams.m_pipeMode = decode::decodePipeModeEnd;
-    DECODE_CHK_STATUS(m_decoder->Prepare(&decodeParams));
-    return m_decoder->Execute();
+    return m_decoder->ExecuteFrame(decodeParams);
 }
 
 MOS_STATUS DecodeVp9PipelineAdapterG12::Allocate(CodechalSetting *codecHalSettings)
@@ -69,8 +72,7 @@ MOS_STATUS DecodeVp9PipelineAdapterG12::Execute(void *params)
     decode::DecodePipelineParams decodeParams;
     decodeParams.m_params = (CodechalDecodeParams*)params;
     decodeParams.m_pipeMode = decode::decodePipeModeProcess;
-    DECODE_CHK_STATUS(m_decoder->Prepare(&decodeParams));
-    return m_decoder->Execute();
+    return m_decoder->ExecuteFrame(decodeParams);
 }
 
 MOS_STATUS DecodeVp9PipelineAdapterG12::GetStatusReport(
@@ -78,11 +80,13 @@ MOS_STATUS DecodeVp9PipelineAdapterG12::GetStatusReport(
     uint16_t            numStatus)
 {
     DECODE_FUNC_CALL();
+    m_decoder->WaitPipelinedExecution();
     return m_decoder->GetStatusReport(status, numStatus);
 }
 
 bool DecodeVp9PipelineAdapterG12::IsIncompletePicture()
 {
+     m_decoder->WaitPipelinedExecution();
      return (!m_decoder->IsCompleteBitstream());
 }
 
@@ -107,6 +111,7 @@ void DecodeVp9PipelineAdapterG12::SetDummyReferenceStatus(CODECHAL_DUMMY_REFEREN
 uint32_t DecodeVp9PipelineAdapterG12::GetCompletedReport()
 {
     DECODE_FUNC_CALL();
+    m_decoder->WaitPipelinedExecution();
     return m_decoder->GetCompletedReport();
 }
 
@@ -114,6 +119,7 @@ void DecodeVp9PipelineAdapterG12::Destroy()
 {
     DECODE_FUNC_CALL();
 
+    m_decoder->WaitPipelinedExecution();
     m_decoder->Destroy();
 }
 
@@ -124,9 +130,17 @@ MOS_GPU_CONTEXT DecodeVp9PipelineAdapterG12::GetDecodeContext()
     return m_decoder->GetDecodeContext();
 }
 
+MOS_STATUS DecodeVp9PipelineAdapterG12::WaitPendingExecute()
+{
+    DECODE_FUNC_CALL();
+
+    return m_decoder->WaitPipelinedExecution();
+}
+
 #ifdef _DECODE_PROCESSING_SUPPORTED
 bool DecodeVp9PipelineAdapterG12::IsDownSamplingSupported()
 {
+    m_decoder->WaitPipelinedExecution();
     return m_decoder->IsDownSamplingSupported();
 }
 #endif
@@ -69,6 +69,8 @@ public:
 
     virtual MOS_GPU_CONTEXT GetDecodeContext() override;
 
+    virtual MOS_STATUS WaitPendingExecute() override;
+
 #ifdef _DECODE_PROCESSING_SUPPORTED
     virtual bool IsDownSamplingSupported() override;
 #endif
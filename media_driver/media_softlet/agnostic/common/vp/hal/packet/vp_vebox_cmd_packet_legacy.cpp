@@ -3377,6 +3377,7 @@ MOS_STATUS VpVeboxCmdPacketLegacy::UpdateVeboxStates()
     uint32_t           dwQuery = 0;
     MOS_LOCK_PARAMS    LockFlags;
     VpVeboxRenderData *renderData = GetLastExecRenderData();
+    VP_SURFACE        *statisticsSurface = nullptr;
 
     VP_PUBLIC_CHK_NULL_RETURN(renderData);
     VP_PUBLIC_CHK_NULL_RETURN(m_veboxPacketSurface.pStatisticsOutput);
@@ -3391,13 +3392,20 @@ MOS_STATUS VpVeboxCmdPacketLegacy::UpdateVeboxStates()
         return MOS_STATUS_SUCCESS;
     }
 
+    // Statistics of earlier frame is used if provided, so that locking it does not wait for last vebox.
+    statisticsSurface = GetSurface(SurfaceTypeStatisticsPast);
+    if (nullptr == statisticsSurface || nullptr == statisticsSurface->osSurface)
+    {
+        statisticsSurface = m_veboxPacketSurface.pStatisticsOutput;
+    }
+
     // Update DN State in CPU
     MOS_ZeroMemory(&LockFlags, sizeof(MOS_LOCK_PARAMS));
     LockFlags.ReadOnly = 1;
 
     // Get Statistic surface
     pStat = (uint8_t *)m_allocator->Lock(
-        &m_veboxPacketSurface.pStatisticsOutput->osSurface->OsResource,
+        &statisticsSurface->osSurface->OsResource,
         &LockFlags);
 
     VP_PUBLIC_CHK_NULL_RETURN(pStat);
@@ -3422,7 +3430,7 @@ MOS_STATUS VpVeboxCmdPacketLegacy::UpdateVeboxStates()
 
     // unlock the statistic surface
     VP_RENDER_CHK_STATUS_RETURN(m_allocator->UnLock(
-        &m_veboxPacketSurface.pStatisticsOutput->osSurface->OsResource));
+        &statisticsSurface->osSurface->OsResource));
 
     return MOS_STATUS_SUCCESS;
 }
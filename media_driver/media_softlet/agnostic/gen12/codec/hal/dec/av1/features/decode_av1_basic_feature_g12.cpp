@@ -89,7 +89,8 @@ namespace decode
         }
 
         DECODE_CHK_STATUS(m_refFrames.Init(this, *m_allocator));
-        DECODE_CHK_STATUS(m_tempBuffers.Init(*m_hwInterface, *m_allocator, *this, CODEC_NUM_REF_AV1_TEMP_BUFFERS));
+        // Temporal buffers are allocated on demand with the actual frame size when a picture becomes active
+        DECODE_CHK_STATUS(m_tempBuffers.Init(*m_hwInterface, *m_allocator, *this, 0));
         DECODE_CHK_STATUS(m_tileCoding.Init(this, codecSettings));
         DECODE_CHK_STATUS(m_internalTarget.Init(*m_allocator));
 
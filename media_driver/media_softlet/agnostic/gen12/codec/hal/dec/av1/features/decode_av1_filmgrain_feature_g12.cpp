@@ -927,6 +927,31 @@ MOS_STATUS Av1DecodeFilmGrainG12::Init(void *settings)
     return MOS_STATUS_SUCCESS;
 }
 
+// Compare the grain params field by field, the structure has a padding byte which is not initialized.
+static bool IsSameFilmGrainParams(const CodecAv1FilmGrainParams &a, const CodecAv1FilmGrainParams &b)
+{
+    return a.m_filmGrainInfoFlags.m_value == b.m_filmGrainInfoFlags.m_value &&
+           a.m_randomSeed == b.m_randomSeed &&
+           a.m_numYPoints == b.m_numYPoints &&
+           !memcmp(a.m_pointYValue, b.m_pointYValue, sizeof(a.m_pointYValue)) &&
+           !memcmp(a.m_pointYScaling, b.m_pointYScaling, sizeof(a.m_pointYScaling)) &&
+           a.m_numCbPoints == b.m_numCbPoints &&
+           !memcmp(a.m_pointCbValue, b.m_pointCbValue, sizeof(a.m_pointCbValue)) &&
+           !memcmp(a.m_pointCbScaling, b.m_pointCbScaling, sizeof(a.m_pointCbScaling)) &&
+           a.m_numCrPoints == b.m_numCrPoints &&
+           !memcmp(a.m_pointCrValue, b.m_pointCrValue, sizeof(a.m_pointCrValue)) &&
+           !memcmp(a.m_pointCrScaling, b.m_pointCrScaling, sizeof(a.m_pointCrScaling)) &&
+           !memcmp(a.m_arCoeffsY, b.m_arCoeffsY, sizeof(a.m_arCoeffsY)) &&
+           !memcmp(a.m_arCoeffsCb, b.m_arCoeffsCb, sizeof(a.m_arCoeffsCb)) &&
+           !memcmp(a.m_arCoeffsCr, b.m_arCoeffsCr, sizeof(a.m_arCoeffsCr)) &&
+           a.m_cbMult == b.m_cbMult &&
+           a.m_cbLumaMult == b.m_cbLumaMult &&
+           a.m_cbOffset == b.m_cbOffset &&
+           a.m_crMult == b.m_crMult &&
+           a.m_crLumaMult == b.m_crLumaMult &&
+           a.m_crOffset == b.m_crOffset;
+}
+
 MOS_STATUS Av1DecodeFilmGrainG12::Update(void *params)
 {
     DECODE_FUNC_CALL();
@@ -952,6 +977,17 @@ MOS_STATUS Av1DecodeFilmGrainG12::Update(void *params)
     bool applyCr = (m_picParams->m_filmGrainParams.m_numCrPoints > 0 || m_picParams->m_filmGrainParams.m_filmGrainInfoFlags.m_fields.m_chromaScalingFromLuma) ? 1 : 0;
     m_filmGrainEnabled = m_picParams->m_filmGrainParams.m_filmGrainInfoFlags.m_fields.m_applyGrain && (applyY | applyCb | applyCr);
 
+    // Noise and coordinate surfaces only depend on grain params (including the seed), frame size and bit depth,
+    // so the generate noise kernels are skipped when none of them changed since the noise was generated.
+    uint32_t frameWidth  = m_picParams->m_superResUpscaledWidthMinus1 + 1;
+    uint32_t frameHeight = m_picParams->m_superResUpscaledHeightMinus1 + 1;
+    m_reuseGrainTemplate = m_filmGrainEnabled &&
+                           m_grainTemplateValid &&
+                           frameWidth == m_prevFrameWidth &&
+                           frameHeight == m_prevFrameHeight &&
+                           m_bitDepthIndicator == m_prevBitDepthIndicator &&
+                           IsSameFilmGrainParams(m_prevFilmGrainParams, m_picParams->m_filmGrainParams);
+
     if (m_picParams->m_filmGrainParams.m_filmGrainInfoFlags.m_fields.m_applyGrain)
     {
         m_av1TileParams = static_cast<CodecAv1TileParams*>(decodeParams->m_sliceParams);
@@ -960,8 +996,20 @@ MOS_STATUS Av1DecodeFilmGrainG12::Update(void *params)
         m_segmentParams = &m_picParams->m_av1SegData;
         DECODE_CHK_NULL(m_segmentParams);
 
-        DECODE_CHK_STATUS(SetFrameStates(m_picParams));
-        DECODE_CHK_STATUS(AllocateVariableSizeSurfaces());
+        if (!m_reuseGrainTemplate)
+        {
+            DECODE_CHK_STATUS(SetFrameStates(m_picParams));
+            DECODE_CHK_STATUS(AllocateVariableSizeSurfaces());
+        }
+    }
+
+    m_grainTemplateValid = m_filmGrainEnabled;
+    if (m_filmGrainEnabled && !m_reuseGrainTemplate)
+    {
+        m_prevFilmGrainParams   = m_picParams->m_filmGrainParams;
+        m_prevFrameWidth        = frameWidth;
+        m_prevFrameHeight       = frameHeight;
+        m_prevBitDepthIndicator = m_bitDepthIndicator;
     }
 
 #if (_DEBUG || _RELEASE_INTERNAL)
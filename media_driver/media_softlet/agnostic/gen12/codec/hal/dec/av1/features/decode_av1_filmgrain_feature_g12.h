@@ -222,6 +222,7 @@ public:
     CodecAv1SegmentsParams *m_segmentParams         = nullptr;          //!< Pointer to AV1 segments parameter
     CodecAv1TileParams *    m_av1TileParams         = nullptr;          //!< Pointer to AV1 tiles parameter
     bool                    m_filmGrainEnabled      = false;            //!< Per-frame film grain enable flag    
+    bool                    m_reuseGrainTemplate    = false;            //!< Noise generated for previous frame is reused, only apply noise runs
 
     static const int32_t    m_filmGrainBindingTableCount[kernelNum];    //!< Binding table count for each kernel
     static const int32_t    m_filmGrainCurbeSize[kernelNum];            //!< Curbe size for each kernel
@@ -292,6 +293,11 @@ public:
     int16_t                         m_scalingLutCr[256]          = {0};                                 //!< Scaling LUT V
     uint32_t                        m_coordinateSurfaceSize      = 0;                                   //!< Record the existing coordinates random values surface size
     uint16_t                        m_prevRandomSeed             = 0;                                   //!< Previous random seed
+    CodecAv1FilmGrainParams         m_prevFilmGrainParams        = {};                                  //!< Film grain params the current noise surfaces are generated with
+    uint32_t                        m_prevFrameWidth             = 0;                                   //!< Upscaled frame width the current noise surfaces are generated with
+    uint32_t                        m_prevFrameHeight            = 0;                                   //!< Upscaled frame height the current noise surfaces are generated with
+    uint8_t                         m_prevBitDepthIndicator      = 0;                                   //!< Bit depth the current noise surfaces are generated with
+    bool                            m_grainTemplateValid         = false;                               //!< Whether the current noise surfaces may be reused
 
     // Surfaces for GetRandomValues
     MOS_BUFFER *                     m_gaussianSequenceSurface          = nullptr;                      //!< Gaussian Sequence surface, 1D buffer, size = 2048 * sizeof(short)
@@ -100,7 +100,7 @@ MOS_STATUS FilmGrainPreSubPipeline::Begin()
 
 MOS_STATUS FilmGrainPreSubPipeline::DoFilmGrainGenerateNoise(const CodechalDecodeParams &decodeParams)
 {
-    if (m_filmGrainFeature->m_filmGrainEnabled)
+    if (m_filmGrainFeature->m_filmGrainEnabled && !m_filmGrainFeature->m_reuseGrainTemplate)
     {
         //Step1: Get Random Values
         DECODE_CHK_STATUS(GetRandomValuesKernel(decodeParams));
@@ -78,7 +78,9 @@ MOS_STATUS FilmGrainSurfaceInit::Prepare(DecodePipelineParams &params)
     else if (params.m_pipeMode == decodePipeModeProcess)
     {
         /*DON't use m_filmGrainFeature->m_filmGrainEnabled*/
-        if (m_filmGrainFeature->m_picParams->m_filmGrainParams.m_filmGrainInfoFlags.m_fields.m_applyGrain)
+        // Coordinate surface still holds the random values of the reused noise
+        if (m_filmGrainFeature->m_picParams->m_filmGrainParams.m_filmGrainInfoFlags.m_fields.m_applyGrain &&
+            !m_filmGrainFeature->m_reuseGrainTemplate)
         {
             InitCoordinateSurface();
         }
@@ -133,6 +133,7 @@ set_source_files_properties(${CP_SOURCES_} PROPERTIES LANGUAGE "CXX")
 
 set_source_files_properties(${SOURCES_SSE2} PROPERTIES LANGUAGE "CXX")
 set_source_files_properties(${SOURCES_SSE4} PROPERTIES LANGUAGE "CXX")
+set_source_files_properties(${SOURCES_AVX2} PROPERTIES LANGUAGE "CXX")
 
 set (CP_SOURCES_
     ${CP_SOURCES_}
@@ -187,6 +188,11 @@ add_library(${LIB_NAME}_SSE4 OBJECT ${SOURCES_SSE4})
 target_compile_options(${LIB_NAME}_SSE4 PRIVATE -msse4.1)
 target_include_directories(${LIB_NAME}_SSE4 BEFORE PRIVATE ${MOS_PREPEND_INCLUDE_DIRS_} ${MOS_PUBLIC_INCLUDE_DIRS_} ${SOFTLET_MOS_PUBLIC_INCLUDE_DIRS_} ${COMMON_PRIVATE_INCLUDE_DIRS_})
 
+# AVX2 sources enable the ISA per function (CM_AVX2_TARGET) rather than with -mavx2,
+# so header inlines emitted in these objects stay safe for the non-AVX2 callers.
+add_library(${LIB_NAME}_AVX2 OBJECT ${SOURCES_AVX2})
+target_include_directories(${LIB_NAME}_AVX2 BEFORE PRIVATE ${MOS_PREPEND_INCLUDE_DIRS_} ${MOS_PUBLIC_INCLUDE_DIRS_} ${SOFTLET_MOS_PUBLIC_INCLUDE_DIRS_} ${COMMON_PRIVATE_INCLUDE_DIRS_})
+
 add_library(${LIB_NAME}_COMMON OBJECT ${COMMON_SOURCES_})
 set_property(TARGET ${LIB_NAME}_COMMON PROPERTY POSITION_INDEPENDENT_CODE 1)
 MediaAddCommonTargetDefines(${LIB_NAME}_COMMON)
@@ -239,7 +245,8 @@ add_library(${LIB_NAME} SHARED
     $<TARGET_OBJECTS:${LIB_NAME}_VP>
     $<TARGET_OBJECTS:${LIB_NAME}_CP>
     $<TARGET_OBJECTS:${LIB_NAME}_SSE2>
-    $<TARGET_OBJECTS:${LIB_NAME}_SSE4>)
+    $<TARGET_OBJECTS:${LIB_NAME}_SSE4>
+    $<TARGET_OBJECTS:${LIB_NAME}_AVX2>)
 
 add_library(${LIB_NAME_STATIC} STATIC
     $<TARGET_OBJECTS:${LIB_NAME}_mos>
@@ -248,7 +255,8 @@ add_library(${LIB_NAME_STATIC} STATIC
     $<TARGET_OBJECTS:${LIB_NAME}_VP>
     $<TARGET_OBJECTS:${LIB_NAME}_CP>
     $<TARGET_OBJECTS:${LIB_NAME}_SSE2>
-    $<TARGET_OBJECTS:${LIB_NAME}_SSE4>)
+    $<TARGET_OBJECTS:${LIB_NAME}_SSE4>
+    $<TARGET_OBJECTS:${LIB_NAME}_AVX2>)
 
 set_target_properties(${LIB_NAME_STATIC} PROPERTIES OUTPUT_NAME ${LIB_NAME})
 
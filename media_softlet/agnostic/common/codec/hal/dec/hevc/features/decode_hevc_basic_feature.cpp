@@ -43,8 +43,8 @@ MOS_STATUS HevcBasicFeature::Init(void *setting)
     DECODE_CHK_STATUS(DecodeBasicFeature::Init(setting));
 
     DECODE_CHK_STATUS(m_refFrames.Init(this, *m_allocator));
-    DECODE_CHK_STATUS(m_mvBuffers.Init(*m_hwInterface, *m_allocator, *this,
-                                       CODEC_NUM_HEVC_INITIAL_MV_BUFFERS));
+    // MV buffers are allocated on demand with the actual frame size when a picture becomes active
+    DECODE_CHK_STATUS(m_mvBuffers.Init(*m_hwInterface, *m_allocator, *this, 0));
     DECODE_CHK_STATUS(m_tileCoding.Init(this, (CodechalSetting*)setting));
 
     return MOS_STATUS_SUCCESS;
@@ -34,6 +34,7 @@ namespace decode
 struct HevcScalabilityPars : public DecodeScalabilityPars
 {
     bool    isSCC = false;
+    bool    isNonIrapPic = false;   //!< Current picture is not an IRAP picture, mode switch can be deferred
 };
 
 }
@@ -41,6 +41,11 @@ DecodeHevcScalabilityOption::DecodeHevcScalabilityOption(const DecodeHevcScalabi
 MOS_STATUS DecodeHevcScalabilityOption::SetScalabilityOption(ScalabilityPars *params)
 {
     SCALABILITY_CHK_NULL_RETURN(params);
+
+    ScalabilityMode prevMode             = m_mode;
+    uint8_t         prevNumPipe          = m_numPipe;
+    bool            prevFESeparateSubmit = m_FESeparateSubmission;
+
     SCALABILITY_CHK_STATUS_RETURN(DecodeScalabilityOption::SetScalabilityOption(params));
 
     HevcScalabilityPars *hevcPars = (HevcScalabilityPars *)params;
@@ -52,6 +57,17 @@ MOS_STATUS DecodeHevcScalabilityOption::SetScalabilityOption(ScalabilityPars *pa
         m_mode = scalabilitySingleMode;
     }
 
+    // Tile layout may change with each PPS, toggling between real tile and virtual tile costs a
+    // context switch per picture. Keep virtual tile until next IRAP picture since it can decode
+    // any tile layout.
+    if (hevcPars->isNonIrapPic && !hevcPars->disableVirtualTile &&
+        prevMode == scalabilityVirtualTileMode && m_mode == scalabilityRealTileMode)
+    {
+        m_numPipe              = prevNumPipe;
+        m_FESeparateSubmission = prevFESeparateSubmit;
+        m_mode                 = scalabilityVirtualTileMode;
+    }
+
     SCALABILITY_VERBOSEMESSAGE(
         "Tile Column = %d, System VDBOX Num = %d, Decided Pipe Num = %d, "
         "Using SFC = %d, Using Slim Vdbox = %d, Scalability Mode = %d, , FE separate submission = %d.",
@@ -94,6 +94,8 @@ MOS_STATUS DecodeInputBitstream::Begin()
     DECODE_CHK_STATUS(DecodeSubPipeline::Reset());
 
     m_segmentsTotalSize = 0;
+    m_catenated         = false;
+    m_segments.clear();
     return MOS_STATUS_SUCCESS;
 }
 
@@ -117,20 +119,28 @@ MOS_STATUS DecodeInputBitstream::AllocateCatenatedBuffer()
 
 MOS_STATUS DecodeInputBitstream::Append(const CodechalDecodeParams &decodeParams)
 {
+    DECODE_CHK_NULL(decodeParams.m_dataBuffer);
     uint32_t segmentSize = decodeParams.m_dataSize;
 
     bool firstExecuteCall = (decodeParams.m_executeCallIndex == 0);
     if (firstExecuteCall)
     {
         m_requiredSize = m_basicFeature->m_dataSize;
+        m_catenated    = false;
+        m_segments.clear();
+
         bool isIncompleteBitstream = (segmentSize < m_requiredSize);
         if (isIncompleteBitstream)
         {
-            DECODE_CHK_STATUS(AllocateCatenatedBuffer());
-            m_basicFeature->m_resDataBuffer = *m_catenatedBuffer;
-            m_basicFeature->m_dataOffset = 0;
-            DECODE_CHK_STATUS(ActivatePacket(DecodePacketId(m_pipeline, hucCopyPacketId), true, 0, 0));
-            AddNewSegment(*(decodeParams.m_dataBuffer), decodeParams.m_dataOffset, decodeParams.m_dataSize);
+            // Decode from application buffer directly as long as the following
+            // segments continue this one in place, catenate only when not.
+            Segment segment;
+            segment.resource = *(decodeParams.m_dataBuffer);
+            segment.offset   = decodeParams.m_dataOffset;
+            segment.size     = segmentSize;
+            m_segments.push_back(segment);
+            m_segmentsTotalSize += segmentSize;
+            return MOS_STATUS_SUCCESS;
         }
     }
     else
@@ -140,6 +150,18 @@ MOS_STATUS DecodeInputBitstream::Append(const CodechalDecodeParams &decodeParams
             DECODE_ASSERTMESSAGE("Bitstream size exceeds allocated buffer size!");
             return MOS_STATUS_INVALID_PARAMETER;
         }
+
+        if (!m_catenated && IsContiguousSegment(*(decodeParams.m_dataBuffer), decodeParams.m_dataOffset))
+        {
+            m_segments.back().size += segmentSize;
+            m_segmentsTotalSize    += segmentSize;
+            return MOS_STATUS_SUCCESS;
+        }
+
+        if (!m_catenated)
+        {
+            DECODE_CHK_STATUS(StartCatenation());
+        }
         DECODE_CHK_STATUS(ActivatePacket(DecodePacketId(m_pipeline, hucCopyPacketId), true, 0, 0));
         AddNewSegment(*(decodeParams.m_dataBuffer), decodeParams.m_dataOffset, decodeParams.m_dataSize);
     }
@@ -149,6 +171,39 @@ MOS_STATUS DecodeInputBitstream::Append(const CodechalDecodeParams &decodeParams
     return MOS_STATUS_SUCCESS;
 }
 
+bool DecodeInputBitstream::IsContiguousSegment(const MOS_RESOURCE &resource, uint32_t offset)
+{
+    if (m_segments.empty())
+    {
+        return false;
+    }
+
+    // Indirect bitstream object can only address one linear range of one resource
+    const Segment &lastSegment = m_segments.back();
+    return (resource.pGmmResInfo != nullptr &&
+            resource.pGmmResInfo == lastSegment.resource.pGmmResInfo &&
+            offset == lastSegment.offset + lastSegment.size);
+}
+
+MOS_STATUS DecodeInputBitstream::StartCatenation()
+{
+    DECODE_CHK_STATUS(AllocateCatenatedBuffer());
+    m_basicFeature->m_resDataBuffer = *m_catenatedBuffer;
+    m_basicFeature->m_dataOffset    = 0;
+
+    // Copy the segments which were expected to be decoded in place
+    m_segmentsTotalSize = 0;
+    for (auto &segment : m_segments)
+    {
+        AddNewSegment(segment.resource, segment.offset, segment.size);
+        m_segmentsTotalSize += MOS_ALIGN_CEIL(segment.size, MHW_CACHELINE_SIZE);
+    }
+    m_segments.clear();
+
+    m_catenated = true;
+    return MOS_STATUS_SUCCESS;
+}
+
 void DecodeInputBitstream::AddNewSegment(MOS_RESOURCE& resource, uint32_t offset, uint32_t size)
 {
     HucCopyPktItf::HucCopyParams copyParams;
@@ -125,6 +125,26 @@ protected:
     //!
     void AddNewSegment(MOS_RESOURCE& resource, uint32_t offset, uint32_t size);
 
+    //!
+    //! \brief  Check if new segment continues the last segment in place
+    //! \param  [in] resource
+    //!         Resource of new segment
+    //! \param  [in] offset
+    //!         Offset of new segment
+    //! \return bool
+    //!         True if HW can read both segments as one linear range
+    //!
+    bool IsContiguousSegment(const MOS_RESOURCE &resource, uint32_t offset);
+
+    //!
+    //! \brief  Switch current frame from in place decode to catenated buffer
+    //! \details Allocate catenated buffer and add copies for the segments
+    //!          received so far
+    //! \return MOS_STATUS
+    //!         MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    MOS_STATUS StartCatenation();
+
     //!
     //! \brief  Initialize scalability parameters
     //!
@@ -145,6 +165,8 @@ protected:
     PMOS_BUFFER     m_catenatedBuffer   = nullptr;   //!< Catenated bitstream for decode
     uint32_t        m_requiredSize      = 0;         //!< Size of bitstream in bytes of current frame
     uint32_t        m_segmentsTotalSize = 0;         //!< Total size of segments in m_segments
+    std::vector<Segment> m_segments;                 //!< Segments of current frame decoded in place
+    bool            m_catenated         = false;     //!< Indicates whether current frame uses catenated buffer
 
 MEDIA_CLASS_DEFINE_END(decode__DecodeInputBitstream)
 };
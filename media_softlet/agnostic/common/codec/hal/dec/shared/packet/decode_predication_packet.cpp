@@ -91,20 +91,6 @@ MOS_STATUS DecodePredicationPkt::Execute(MOS_COMMAND_BUFFER& cmdBuffer)
             &cmdBuffer,
             &loadRegisterImmParams));
 
-        // load 0 to general purpose register4
-        MOS_ZeroMemory(&loadRegisterImmParams, sizeof(loadRegisterImmParams));
-        loadRegisterImmParams.dwData = 0;
-        loadRegisterImmParams.dwRegister = mmioRegistersMfx->generalPurposeRegister4LoOffset;
-        DECODE_CHK_STATUS(m_miInterface->AddMiLoadRegisterImmCmd(
-            &cmdBuffer,
-            &loadRegisterImmParams));
-        MOS_ZeroMemory(&loadRegisterImmParams, sizeof(loadRegisterImmParams));
-        loadRegisterImmParams.dwData = 0;
-        loadRegisterImmParams.dwRegister = mmioRegistersMfx->generalPurposeRegister4HiOffset;
-        DECODE_CHK_STATUS(m_miInterface->AddMiLoadRegisterImmCmd(
-            &cmdBuffer,
-            &loadRegisterImmParams));
-
         //perform the add operation
         MHW_MI_MATH_PARAMS  miMathParams;
         MHW_MI_ALU_PARAMS   miAluParams[4];
@@ -114,10 +100,9 @@ MOS_STATUS DecodePredicationPkt::Execute(MOS_COMMAND_BUFFER& cmdBuffer)
         miAluParams[0].AluOpcode = MHW_MI_ALU_LOAD;
         miAluParams[0].Operand1 = MHW_MI_ALU_SRCA;
         miAluParams[0].Operand2 = MHW_MI_ALU_GPREG0;
-        // load     srcB, reg4
-        miAluParams[1].AluOpcode = MHW_MI_ALU_LOAD;
+        // load0    srcB, zero operand is loaded by ALU directly instead of through GPR4
+        miAluParams[1].AluOpcode = MHW_MI_ALU_LOAD0;
         miAluParams[1].Operand1 = MHW_MI_ALU_SRCB;
-        miAluParams[1].Operand2 = MHW_MI_ALU_GPREG4;
         // add      srcA, srcB
         miAluParams[2].AluOpcode = MHW_MI_ALU_ADD;
         miAluParams[2].Operand1 = MHW_MI_ALU_SRCB;
@@ -56,6 +56,9 @@ DecodePipeline::DecodePipeline(
     m_singleTaskPhaseSupported =
         ReadUserFeature(m_userSettingPtr, "Decode Single Task Phase Enable", MediaUserSetting::Group::Sequence).Get<bool>();
 
+    m_pipelinedExecution =
+        ReadUserFeature(m_userSettingPtr, "Decode Pipelined Execution", MediaUserSetting::Group::Sequence).Get<bool>();
+
     m_pCodechalOcaDumper = MOS_New(CodechalOcaDumper);
     if (!m_pCodechalOcaDumper)
     {
@@ -193,6 +196,8 @@ MOS_STATUS DecodePipeline::Uninitialize()
 {
     DECODE_FUNC_CALL();
 
+    StopPipelinedExecution();
+
     // Wait all cmd completion before delete resource.
     m_osInterface->pfnWaitAllCmdCompletion(m_osInterface);
 
@@ -303,6 +308,125 @@ MOS_STATUS DecodePipeline::ExecuteActivePackets()
     return MOS_STATUS_SUCCESS;
 }
 
+MOS_STATUS DecodePipeline::ExecuteFrame(const DecodePipelineParams &pipelineParams)
+{
+    DECODE_FUNC_CALL();
+
+    if (!m_pipelinedExecution)
+    {
+        DecodePipelineParams params = pipelineParams;
+        DECODE_CHK_STATUS(Prepare(&params));
+        return Execute();
+    }
+
+    // Decode params are owned by DDI and get updated once the call returns,
+    // keep a copy for worker. The buffers they point to stay untouched until
+    // next BeginFrame, which waits for the worker.
+    PipelinedExecuteJob job;
+    job.m_pipelineParams = pipelineParams;
+    if (pipelineParams.m_params != nullptr)
+    {
+        job.m_decodeParams    = *pipelineParams.m_params;
+        job.m_hasDecodeParams = true;
+    }
+
+    std::lock_guard<std::mutex> lock(m_pipelinedMutex);
+    if (!m_pipelinedWorker.joinable())
+    {
+        m_pipelinedExit   = false;
+        m_pipelinedWorker = std::thread(&DecodePipeline::PipelinedExecuteThread, this);
+    }
+    m_pipelinedJobs.push_back(job);
+    m_pipelinedCond.notify_one();
+
+    return MOS_STATUS_SUCCESS;
+}
+
+MOS_STATUS DecodePipeline::WaitPipelinedExecution(bool clearStatus)
+{
+    DECODE_FUNC_CALL();
+
+    if (!m_pipelinedExecution)
+    {
+        return MOS_STATUS_SUCCESS;
+    }
+
+    std::unique_lock<std::mutex> lock(m_pipelinedMutex);
+    m_pipelinedIdleCond.wait(lock, [this] { return m_pipelinedJobs.empty() && !m_pipelinedBusy; });
+
+    MOS_STATUS status = m_pipelinedStatus;
+    if (clearStatus)
+    {
+        m_pipelinedStatus = MOS_STATUS_SUCCESS;
+    }
+    return status;
+}
+
+void DecodePipeline::PipelinedExecuteThread()
+{
+    std::unique_lock<std::mutex> lock(m_pipelinedMutex);
+
+    while (true)
+    {
+        m_pipelinedCond.wait(lock, [this] { return m_pipelinedExit || !m_pipelinedJobs.empty(); });
+        if (m_pipelinedJobs.empty())
+        {
+            break;
+        }
+
+        PipelinedExecuteJob job = m_pipelinedJobs.front();
+        m_pipelinedJobs.pop_front();
+
+        // Once one pipe mode failed, drop the rest of queued ones the same way
+        // as DDI stops calling into pipeline after a failure in sync mode
+        if (m_pipelinedStatus == MOS_STATUS_SUCCESS)
+        {
+            m_pipelinedBusy = true;
+            lock.unlock();
+
+            job.m_pipelineParams.m_params = job.m_hasDecodeParams ? &job.m_decodeParams : nullptr;
+            MOS_STATUS status = Prepare(&job.m_pipelineParams);
+            if (status == MOS_STATUS_SUCCESS)
+            {
+                status = Execute();
+            }
+            if (status != MOS_STATUS_SUCCESS)
+            {
+                DECODE_ASSERTMESSAGE("Pipelined execution of pipe mode %d failed.", job.m_pipelineParams.m_pipeMode);
+            }
+
+            lock.lock();
+            m_pipelinedBusy = false;
+            if (status != MOS_STATUS_SUCCESS)
+            {
+                m_pipelinedStatus = status;
+            }
+        }
+
+        if (m_pipelinedJobs.empty())
+        {
+            m_pipelinedIdleCond.notify_all();
+        }
+    }
+}
+
+void DecodePipeline::StopPipelinedExecution()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_pipelinedMutex);
+        if (!m_pipelinedWorker.joinable())
+        {
+            return;
+        }
+        m_pipelinedExit = true;
+        m_pipelinedCond.notify_one();
+    }
+
+    m_pipelinedWorker.join();
+    m_pipelinedJobs.clear();
+    m_pipelinedStatus = MOS_STATUS_SUCCESS;
+}
+
 bool DecodePipeline::IsCompleteBitstream()
 {
     return (m_bitstream == nullptr) ? false : m_bitstream->IsComplete();
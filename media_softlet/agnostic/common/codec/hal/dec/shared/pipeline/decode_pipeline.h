@@ -28,6 +28,10 @@
 #ifndef __DECODE_PIPELINE_H__
 #define __DECODE_PIPELINE_H__
 
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
 #include "media_pipeline.h"
 
 #include "codechal_hw.h"
@@ -95,6 +99,7 @@ public:
 
     virtual ~DecodePipeline()
     {
+        StopPipelinedExecution();
         MOS_Delete(m_pCodechalOcaDumper);
     };
 
@@ -107,6 +112,30 @@ public:
     //!
     virtual MOS_STATUS Prepare(void *params) override;
 
+    //!
+    //! \brief  Prepare and execute one pipe mode of current frame
+    //! \details When pipelined execution is enabled, the call only snapshots
+    //!          the parameters and queues them to the worker thread, so that
+    //!          the caller can go on preparing the next picture while command
+    //!          buffers of this one are built and submitted.
+    //! \param  [in] pipelineParams
+    //!         Pipeline parameters of current pipe mode
+    //! \return MOS_STATUS
+    //!         MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    MOS_STATUS ExecuteFrame(const DecodePipelineParams &pipelineParams);
+
+    //!
+    //! \brief  Wait until all pipe modes queued by ExecuteFrame are executed
+    //! \details Must be called before any access to the per frame pipeline
+    //!          state, the first failure of queued execution is returned here.
+    //! \param  [in] clearStatus
+    //!         Reset the failure status after it is returned
+    //! \return MOS_STATUS
+    //!         MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    MOS_STATUS WaitPipelinedExecution(bool clearStatus = false);
+
     //!
     //! \brief  Indicates whether input bitstream is complete for current frame
     //! \return bool
@@ -465,6 +494,26 @@ protected:
 #endif
 
 private:
+    //!
+    //! \brief  Pipe mode queued for pipelined execution
+    //!
+    struct PipelinedExecuteJob
+    {
+        DecodePipelineParams m_pipelineParams;
+        CodechalDecodeParams m_decodeParams;
+        bool                 m_hasDecodeParams = false;
+    };
+
+    //!
+    //! \brief  Worker thread routine of pipelined execution
+    //!
+    void PipelinedExecuteThread();
+
+    //!
+    //! \brief  Drain queued pipe modes and stop the pipelined execution worker
+    //!
+    void StopPipelinedExecution();
+
     //!
     //! \brief  Create sub pipeline manager
     //! \param  [in] codecSettings
@@ -515,6 +564,16 @@ protected:
 
     PMOS_SURFACE            m_tempOutputSurf = nullptr;
 
+    bool                    m_pipelinedExecution = false;  //!< Indicates whether pipe modes execute on worker thread
+    std::thread             m_pipelinedWorker;             //!< Worker thread of pipelined execution
+    std::mutex              m_pipelinedMutex;              //!< Mutex for pipelined execution queue
+    std::condition_variable m_pipelinedCond;               //!< Signaled when job queued or worker to exit
+    std::condition_variable m_pipelinedIdleCond;           //!< Signaled when all queued jobs are executed
+    std::deque<PipelinedExecuteJob> m_pipelinedJobs;       //!< Queued pipe modes in submission order
+    bool                    m_pipelinedBusy   = false;     //!< Indicates whether worker is executing a job
+    bool                    m_pipelinedExit   = false;     //!< Indicates whether worker should exit
+    MOS_STATUS              m_pipelinedStatus = MOS_STATUS_SUCCESS;  //!< First failure of queued jobs
+
 MEDIA_CLASS_DEFINE_END(decode__DecodePipeline)
 };
 
@@ -65,6 +65,14 @@ public:
     virtual uint32_t GetCompletedReport() = 0;
     virtual MOS_GPU_CONTEXT GetDecodeContext() = 0;
 
+    //!
+    //! \brief  Wait for pending pipelined execution of submitted pictures
+    //! \details Called by DDI before other contexts consume the decode output
+    //! \return MOS_STATUS
+    //!         MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    virtual MOS_STATUS WaitPendingExecute() { return MOS_STATUS_SUCCESS; }
+
 MEDIA_CLASS_DEFINE_END(DecodePipelineAdapter)
 };
 #endif // !__DECODE_PIPELINE_ADAPTER_H__
@@ -63,15 +63,43 @@ MOS_STATUS DecodeSfcHistogramSubPipeline::Init(CodechalSetting &settings)
     m_downsampFeature = dynamic_cast<DecodeDownSamplingFeature*>(featureManger->GetFeature(
         DecodeFeatureIDs::decodeDownSampling));
 
-    //Create Packets
+    // Copy packet is created on the first histogram copy, most contexts never output histogram
+    return MOS_STATUS_SUCCESS;
+}
+
+MOS_STATUS DecodeSfcHistogramSubPipeline::CreateCopyPacket()
+{
+    DECODE_FUNC_CALL();
+
     HucPacketCreatorBase *hucPktCreator = dynamic_cast<HucPacketCreatorBase *>(m_pipeline);
     DECODE_CHK_NULL(hucPktCreator);
-    m_copyPkt = hucPktCreator->CreateHucCopyPkt(m_pipeline, m_task, hwInterface);
+    m_copyPkt = hucPktCreator->CreateHucCopyPkt(m_pipeline, m_task, m_pipeline->GetHwInterface());
     DECODE_CHK_NULL(m_copyPkt);
     MediaPacket *packet = dynamic_cast<MediaPacket *>(m_copyPkt);
-    DECODE_CHK_NULL(packet);
-    DECODE_CHK_STATUS(RegisterPacket(DecodePacketId(m_pipeline, hucCopyPacketId), *packet));
-    DECODE_CHK_STATUS(packet->Init());
+    if (packet == nullptr)
+    {
+        MOS_Delete(m_copyPkt);
+        DECODE_CHK_NULL(packet);
+    }
+
+    // Drop a half created packet, so that next histogram copy creates it again
+    uint32_t   packetId = DecodePacketId(m_pipeline, hucCopyPacketId);
+    MOS_STATUS status   = RegisterPacket(packetId, *packet);
+    if (status == MOS_STATUS_SUCCESS)
+    {
+        status = packet->Init();
+    }
+    if (status != MOS_STATUS_SUCCESS)
+    {
+        auto iter = m_packetList.find(packetId);
+        if (iter != m_packetList.end() && iter->second == packet)
+        {
+            m_packetList.erase(iter);
+        }
+        MOS_Delete(packet);
+        m_copyPkt = nullptr;
+        DECODE_CHK_STATUS(status);
+    }
 
     return MOS_STATUS_SUCCESS;
 }
@@ -135,6 +163,11 @@ MOS_STATUS DecodeSfcHistogramSubPipeline::CopyHistogramToDestBuf(MOS_RESOURCE* s
     DECODE_CHK_NULL(src);
     DECODE_CHK_NULL(dest);
 
+    if (m_copyPkt == nullptr)
+    {
+        DECODE_CHK_STATUS(CreateCopyPacket());
+    }
+
     DECODE_CHK_STATUS(ActivatePacket(DecodePacketId(m_pipeline, hucCopyPacketId), true, 0, 0));
 
     HucCopyPktItf::HucCopyParams copyParams;
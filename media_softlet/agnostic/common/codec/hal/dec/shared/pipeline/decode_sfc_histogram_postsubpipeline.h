@@ -100,6 +100,13 @@ protected:
 
     MOS_STATUS CopyHistogramToDestBuf(MOS_RESOURCE* src, MOS_RESOURCE* dest, uint32_t destOffset);
 
+    //!
+    //! \brief  Create and register the HuC copy packet on first use
+    //! \return MOS_STATUS
+    //!         MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    MOS_STATUS CreateCopyPacket();
+
 private:
     DecodeBasicFeature*             m_basicFeature      = nullptr; //!< Decode basic feature
     DecodeAllocator*                m_allocator         = nullptr; //!< Resource allocator
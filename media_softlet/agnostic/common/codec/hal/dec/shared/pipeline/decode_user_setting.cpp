@@ -146,6 +146,12 @@ MOS_STATUS DecodePipeline::InitUserSetting(MediaUserSettingSharedPtr userSetting
         MediaUserSetting::Group::Sequence,
         int32_t(1),
         false);
+    DeclareUserSettingKey(
+        userSettingPtr,
+        "Decode Pipelined Execution",
+        MediaUserSetting::Group::Sequence,
+        int32_t(0),
+        false);
 #if (_DEBUG || _RELEASE_INTERNAL)
     DeclareUserSettingKeyForDebug(
         userSettingPtr,
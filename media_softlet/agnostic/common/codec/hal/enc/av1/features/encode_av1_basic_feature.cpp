@@ -106,6 +106,9 @@ static MOS_STATUS CheckLrParams(const CODEC_AV1_ENCODE_PICTURE_PARAMS &m_av1PicP
 MOS_STATUS Av1BasicFeature::Update(void *params)
 {
     ENCODE_FUNC_CALL();
+
+    PERF_UTILITY_AUTO(__FUNCTION__, PERF_ENCODE, PERF_LEVEL_HAL);
+
     ENCODE_CHK_NULL_RETURN(params);
 
     EncodeBasicFeature::Update(params);
@@ -275,6 +275,8 @@ namespace encode{
     {
         ENCODE_FUNC_CALL();
 
+        PERF_UTILITY_AUTO(__FUNCTION__, PERF_ENCODE, PERF_LEVEL_HAL);
+
         Av1Pipeline *pipeline = dynamic_cast<Av1Pipeline *>(m_pipeline);
         ENCODE_CHK_NULL_RETURN(pipeline);
 
@@ -1174,7 +1176,7 @@ namespace encode{
         currRefList.RefPic         = statusReportData->currOriginalPic;
 
         debugInterface->m_currPic            = statusReportData->currOriginalPic;
-        debugInterface->m_bufferDumpFrameNum = m_statusReport->GetReportedCount();
+        debugInterface->m_bufferDumpFrameNum = m_statusReport->GetParsingIndex();
         debugInterface->m_frameType          = encodeStatusMfx->pictureCodingType;
 
         if (m_resVDEncPakObjCmdStreamOutBuffer != nullptr)
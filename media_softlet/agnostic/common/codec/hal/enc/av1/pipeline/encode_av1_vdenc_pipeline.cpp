@@ -76,6 +76,8 @@ MOS_STATUS Av1VdencPipeline::UserFeatureReport()
 
 MOS_STATUS Av1VdencPipeline::Prepare(void *params)
 {
+    PERF_UTILITY_AUTO(__FUNCTION__, PERF_ENCODE, PERF_LEVEL_HAL);
+
     EncoderParams *encodeParams = (EncoderParams *)params;
 
     ENCODE_CHK_NULL_RETURN(encodeParams);
@@ -117,6 +117,9 @@ MOS_STATUS HevcBasicFeature::Init(void *setting)
 MOS_STATUS HevcBasicFeature::Update(void *params)
 {
     ENCODE_FUNC_CALL();
+
+    PERF_UTILITY_AUTO(__FUNCTION__, PERF_ENCODE, PERF_LEVEL_HAL);
+
     ENCODE_CHK_NULL_RETURN(params);
 
     ENCODE_CHK_STATUS_RETURN(EncodeBasicFeature::Update(params));
@@ -152,6 +152,15 @@ void HevcHeaderPacker::PackSSH(
     if (!slice.dependent_slice_segment_flag)
         PackSSHPartIndependent(bs, nalu, sps, pps, slice);
 
+    PackSSHPartEnd(bs, pps, slice, dyn_slice_size);
+}
+
+void HevcHeaderPacker::PackSSHPartEnd(
+    BitstreamWriter &bs,
+    PPS const &      pps,
+    Slice const &    slice,
+    bool             dyn_slice_size)
+{
     if (pps.tiles_enabled_flag || pps.entropy_coding_sync_enabled_flag)
     {
         ENCODE_ASSERT(slice.num_entry_point_offsets == 0);
@@ -165,6 +174,63 @@ void HevcHeaderPacker::PackSSH(
         bs.PutTrailingBits();
 }
 
+bool HevcHeaderPacker::IsSSHTemplateReusable(HevcSlice const &slice)
+{
+    // Everything else packed by PackSSHPartIndependentPrefix is either per frame
+    // (POC LSB, RPS, weights) or constant, and the template lives for one frame.
+    HevcSlice const &t = m_sshTemplateSlice;
+
+    return m_sshTemplateValid &&
+           t.type                             == slice.type &&
+           t.temporal_mvp_enabled_flag        == slice.temporal_mvp_enabled_flag &&
+           t.sao_luma_flag                    == slice.sao_luma_flag &&
+           t.sao_chroma_flag                  == slice.sao_chroma_flag &&
+           t.num_ref_idx_active_override_flag == slice.num_ref_idx_active_override_flag &&
+           t.num_ref_idx_l0_active_minus1     == slice.num_ref_idx_l0_active_minus1 &&
+           t.num_ref_idx_l1_active_minus1     == slice.num_ref_idx_l1_active_minus1 &&
+           t.mvd_l1_zero_flag                 == slice.mvd_l1_zero_flag &&
+           t.cabac_init_flag                  == slice.cabac_init_flag &&
+           t.collocated_from_l0_flag          == slice.collocated_from_l0_flag &&
+           t.five_minus_max_num_merge_cand    == slice.five_minus_max_num_merge_cand;
+}
+
+void HevcHeaderPacker::PackSSHFromTemplate(BitstreamWriter &bs)
+{
+    // Same bitstream as PackSSH(bs, m_naluParams, m_spsParams, m_ppsParams, m_sliceParams, m_bDssEnabled),
+    // but the invariant middle of the independent part is packed once per frame and copied after that.
+    PackNALU(bs, m_naluParams);
+
+    if (!m_bDssEnabled)
+        PackSSHPartIdAddr(bs, m_naluParams, m_spsParams, m_ppsParams, m_sliceParams);
+
+    if (!m_sliceParams.dependent_slice_segment_flag)
+    {
+        if (IsSSHTemplateReusable(m_sliceParams))
+        {
+            bs.PutBitsBuffer(m_sshTemplateBitLen, m_sshTemplate.data(), m_sshTemplateBitOffset);
+        }
+        else
+        {
+            mfxU32 start = bs.GetOffset();
+
+            PackSSHPartIndependentPrefix(bs, m_naluParams, m_spsParams, m_ppsParams, m_sliceParams);
+
+            mfxU32 end = bs.GetOffset();
+            mfxU8 *pStart = bs.GetStart();
+
+            m_sshTemplate.assign(pStart + (start >> 3), pStart + CeilDiv(end, 8u));
+            m_sshTemplateBitOffset = (start & 7);
+            m_sshTemplateBitLen    = end - start;
+            m_sshTemplateSlice     = m_sliceParams;
+            m_sshTemplateValid     = true;
+        }
+
+        PackSSHPartQpDeblocking(bs, m_ppsParams, m_sliceParams);
+    }
+
+    PackSSHPartEnd(bs, m_ppsParams, m_sliceParams, m_bDssEnabled);
+}
+
 void HevcHeaderPacker::PackNALU(BitstreamWriter &bs, NALU const &h)
 {
     bool bLong_SC =
@@ -215,6 +281,17 @@ void HevcHeaderPacker::PackSSHPartIndependent(
     SPS const &      sps,
     PPS const &      pps,
     Slice const &    slice)
+{
+    PackSSHPartIndependentPrefix(bs, nalu, sps, pps, slice);
+    PackSSHPartQpDeblocking(bs, pps, slice);
+}
+
+void HevcHeaderPacker::PackSSHPartIndependentPrefix(
+    BitstreamWriter &bs,
+    NALU const &     nalu,
+    SPS const &      sps,
+    PPS const &      pps,
+    Slice const &    slice)
 {
     const mfxU8 I   = 2;
     mfxU32      nSE = 0;
@@ -240,6 +317,16 @@ void HevcHeaderPacker::PackSSHPartIndependent(
     if (slice.type != I)
         PackSSHPartPB(bs, sps, pps, slice);
 
+    ENCODE_ASSERT(nSE >= 1);
+}
+
+void HevcHeaderPacker::PackSSHPartQpDeblocking(
+    BitstreamWriter &bs,
+    PPS const &      pps,
+    Slice const &    slice)
+{
+    mfxU32 nSE = 0;
+
     bs.AddInfo(PACK_QPDOffset, bs.GetOffset());
 
     nSE += PutSE(bs, slice.slice_qp_delta);
@@ -257,7 +344,7 @@ void HevcHeaderPacker::PackSSHPartIndependent(
 
     nSE += bPackSliceLF && PutBit(bs, slice.loop_filter_across_slices_enabled_flag);
 
-    ENCODE_ASSERT(nSE >= 2);
+    ENCODE_ASSERT(nSE >= 1);
 }
 
 void HevcHeaderPacker::PackSSHPartNonIDR(
@@ -538,6 +625,7 @@ MOS_STATUS HevcHeaderPacker::SliceHeaderPacker(EncoderParams *encodeParams)
     ENCODE_CHK_STATUS_RETURN(GetSPSParams(static_cast<PCODEC_HEVC_ENCODE_SEQUENCE_PARAMS>(encodeParams->pSeqParams)));
     ENCODE_CHK_STATUS_RETURN(GetPPSParams(static_cast<PCODEC_HEVC_ENCODE_PICTURE_PARAMS>(encodeParams->pPicParams)));
     ENCODE_CHK_STATUS_RETURN(GetNaluParams(nalType, 0, 0, pBSBuffer->pCurrent == pBSBuffer->pBase));
+    m_sshTemplateValid = false;
 
     //uint8_t *pCurrent = pBSBuffer->pCurrent;
     //uint32_t
@@ -549,7 +637,7 @@ MOS_STATUS HevcHeaderPacker::SliceHeaderPacker(EncoderParams *encodeParams)
         
         rbsp.Reset(pBegin, mfxU32(pEnd - pBegin));
         m_naluParams.long_start_code = 0/*pBSBuffer->pCurrent + (BitLenRecorded + 7) / 8 == pBSBuffer->pBase*/;
-        PackSSH(rbsp, m_naluParams, m_spsParams, m_ppsParams, m_sliceParams, m_bDssEnabled);
+        PackSSHFromTemplate(rbsp);
         BitLen = rbsp.GetOffset();
         pBegin += CeilDiv(BitLen, 8u);
         pSlcData[slcCount].SliceOffset            = (uint32_t)(pBSBuffer->pCurrent + (BitLenRecorded + 7) / 8 - pBSBuffer->pBase);
@@ -32,6 +32,7 @@
 #include "codec_def_encode_hevc.h"
 #include <exception>
 #include <array>
+#include <vector>
 #include <numeric>
 #include <algorithm>
 
@@ -491,6 +492,14 @@ public:
     std::array<mfxU8, 1024> m_rbsp          = {};
     bool                    m_bDssEnabled   = false;
 
+    //! \brief  Slice header bits from slice_type up to slice_qp_delta, shared by
+    //!         the slices of one frame that only differ in address and QP
+    std::vector<mfxU8>      m_sshTemplate           = {};
+    mfxU32                  m_sshTemplateBitOffset  = 0;
+    mfxU32                  m_sshTemplateBitLen     = 0;
+    bool                    m_sshTemplateValid      = false;
+    HevcSlice               m_sshTemplateSlice      = {};
+
 public:
     HevcHeaderPacker();
     MOS_STATUS SliceHeaderPacker(EncoderParams *encodeParams);
@@ -506,6 +515,8 @@ public:
               HevcPPS const &  pps,
               HevcSlice const &slice,
               bool             dyn_slice_size);
+    void       PackSSHFromTemplate(BitstreamWriter &bs);
+    bool       IsSSHTemplateReusable(HevcSlice const &slice);
     void PackNALU(BitstreamWriter &bs, NALU const &h);
     void PackSSHPartIdAddr(
         BitstreamWriter &bs,
@@ -537,6 +548,24 @@ public:
         PPS const &      pps,
         Slice const &    slice);
 
+    void PackSSHPartIndependentPrefix(
+        BitstreamWriter &bs,
+        NALU const &     nalu,
+        SPS const &      sps,
+        PPS const &      pps,
+        Slice const &    slice);
+
+    void PackSSHPartQpDeblocking(
+        BitstreamWriter &bs,
+        PPS const &      pps,
+        Slice const &    slice);
+
+    void PackSSHPartEnd(
+        BitstreamWriter &bs,
+        PPS const &      pps,
+        Slice const &    slice,
+        bool             dyn_slice_size);
+
     void PackSSHPartNonIDR(
         BitstreamWriter &bs,
         SPS const &      sps,
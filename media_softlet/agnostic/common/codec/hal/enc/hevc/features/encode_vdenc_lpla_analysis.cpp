@@ -455,6 +455,12 @@ namespace encode
 
         m_numValidLaRecords++;
 
+        m_laUpdateQueue.clear();
+        m_laUpdateIdx              = 0;
+        m_laFlushNum               = 0;
+        m_currLaUpdate             = nullptr;
+        m_laRecordConsumedByUpdate = false;
+
         return eStatus;
     }
 
@@ -558,8 +564,12 @@ namespace encode
         ENCODE_CHK_NULL_RETURN(debugInterface);
         int32_t currentPass = pipeline->GetCurrentPass();
 
+        // Chained flush updates each program their own DMEM buffer
+        PMOS_RESOURCE dmemBuffer = GetLaUpdateDmemBuffer(pipeline->m_currRecycledBufIdx, (uint16_t)currentPass);
+        ENCODE_CHK_NULL_RETURN(dmemBuffer);
+
         ENCODE_CHK_STATUS_RETURN(debugInterface->DumpHucDmem(
-            m_vdencLaUpdateDmemBuffer[pipeline->m_currRecycledBufIdx][currentPass],
+            dmemBuffer,
             sizeof(VdencHevcHucLaDmem),
             currentPass,
             hucRegionDumpLAUpdate));
@@ -825,9 +835,9 @@ namespace encode
             return eStatus;
         }
 
-        ENCODE_CHK_STATUS_RETURN(SetLaUpdateDmemBuffer(currRecycledBufIdx, m_currLaDataIdx, m_numValidLaRecords, curPass, numPasses));
+        ENCODE_CHK_STATUS_RETURN(SetLaUpdateDmemBuffer(currRecycledBufIdx, m_currLaDataIdx, GetLaUpdateRecords(), curPass, numPasses));
 
-        dmemParams.presHucDataSource = m_vdencLaUpdateDmemBuffer[currRecycledBufIdx][curPass];
+        dmemParams.presHucDataSource = GetLaUpdateDmemBuffer(currRecycledBufIdx, curPass);
         dmemParams.dwDataLength = MOS_ALIGN_CEIL(m_vdencLaUpdateDmemBufferSize, CODECHAL_CACHELINE_SIZE);
         dmemParams.dwDmemOffset = HUC_DMEM_OFFSET_RTOS_GEMS;
 
@@ -844,9 +854,9 @@ namespace encode
             return eStatus;
         }
 
-        ENCODE_CHK_STATUS_RETURN(SetLaUpdateDmemBuffer(currRecycledBufIdx, m_currLaDataIdx, m_numValidLaRecords, curPass, numPasses));
+        ENCODE_CHK_STATUS_RETURN(SetLaUpdateDmemBuffer(currRecycledBufIdx, m_currLaDataIdx, GetLaUpdateRecords(), curPass, numPasses));
 
-        params.hucDataSource = m_vdencLaUpdateDmemBuffer[currRecycledBufIdx][curPass];
+        params.hucDataSource = GetLaUpdateDmemBuffer(currRecycledBufIdx, curPass);
         params.dataLength = MOS_ALIGN_CEIL(m_vdencLaUpdateDmemBufferSize, CODECHAL_CACHELINE_SIZE);
         params.dmemOffset = HUC_DMEM_OFFSET_RTOS_GEMS;
 
@@ -926,7 +936,9 @@ namespace encode
         MOS_STATUS eStatus = MOS_STATUS_SUCCESS;
 
         // Setup LAUpdate DMEM
-        auto hucVdencLaUpdateDmem = (VdencHevcHucLaDmem *)m_allocator->LockResourceForWrite(m_vdencLaUpdateDmemBuffer[currRecycledBufIdx][curPass]);
+        PMOS_RESOURCE dmemBuffer = GetLaUpdateDmemBuffer(currRecycledBufIdx, curPass);
+        ENCODE_CHK_NULL_RETURN(dmemBuffer);
+        auto hucVdencLaUpdateDmem = (VdencHevcHucLaDmem *)m_allocator->LockResourceForWrite(dmemBuffer);
         ENCODE_CHK_NULL_RETURN(hucVdencLaUpdateDmem);
         MOS_ZeroMemory(hucVdencLaUpdateDmem, sizeof(hucVdencLaUpdateDmem));
 
@@ -936,11 +948,79 @@ namespace encode
         hucVdencLaUpdateDmem->cqmQpThreshold = m_cqmQpThreshold;
         hucVdencLaUpdateDmem->currentPass = (uint8_t)curPass;
 
-        m_allocator->UnLock(m_vdencLaUpdateDmemBuffer[currRecycledBufIdx][curPass]);
+        m_allocator->UnLock(dmemBuffer);
 
         return eStatus;
     }
 
+    PMOS_RESOURCE VdencLplaAnalysis::GetLaUpdateDmemBuffer(uint8_t currRecycledBufIdx, uint16_t curPass)
+    {
+        ENCODE_FUNC_CALL();
+
+        if (currRecycledBufIdx >= CODECHAL_ENCODE_RECYCLED_BUFFER_NUM || curPass >= CODECHAL_LPLA_NUM_OF_PASSES)
+        {
+            return nullptr;
+        }
+
+        if (m_currLaUpdate == nullptr || !m_currLaUpdate->isFlush)
+        {
+            return m_vdencLaUpdateDmemBuffer[currRecycledBufIdx][curPass];
+        }
+
+        std::vector<PMOS_RESOURCE> &flushBuffers = m_vdencLaFlushDmemBuffer[currRecycledBufIdx];
+        while (flushBuffers.size() <= m_currLaUpdate->flushIdx)
+        {
+            MOS_ALLOC_GFXRES_PARAMS allocParamsForBufferLinear;
+            MOS_ZeroMemory(&allocParamsForBufferLinear, sizeof(MOS_ALLOC_GFXRES_PARAMS));
+            allocParamsForBufferLinear.Type     = MOS_GFXRES_BUFFER;
+            allocParamsForBufferLinear.TileType = MOS_TILE_LINEAR;
+            allocParamsForBufferLinear.Format   = Format_Buffer;
+            allocParamsForBufferLinear.dwBytes  = MOS_ALIGN_CEIL(m_vdencLaUpdateDmemBufferSize, CODECHAL_CACHELINE_SIZE);
+            allocParamsForBufferLinear.pBufName = "VDENC Lookahead flush Dmem Buffer";
+
+            PMOS_RESOURCE buffer = m_allocator->AllocateResource(allocParamsForBufferLinear, true);
+            if (buffer == nullptr)
+            {
+                return nullptr;
+            }
+            flushBuffers.push_back(buffer);
+        }
+
+        return flushBuffers[m_currLaUpdate->flushIdx];
+    }
+
+    uint32_t VdencLplaAnalysis::GetLaUpdateRecords() const
+    {
+        return m_currLaUpdate ? m_currLaUpdate->numValidLaRecords : m_numValidLaRecords;
+    }
+
+    MOS_STATUS VdencLplaAnalysis::QueueLaUpdate(bool blastPass)
+    {
+        ENCODE_FUNC_CALL();
+
+        LaUpdateRecord record;
+        record.numValidLaRecords = m_numValidLaRecords;
+        m_laUpdateQueue.push_back(record);
+
+        // Same rule as CalculateLaRecords, which runs after this update is submitted
+        m_laRecordConsumedByUpdate = blastPass && m_numValidLaRecords >= m_lookaheadDepth;
+
+        return MOS_STATUS_SUCCESS;
+    }
+
+    MOS_STATUS VdencLplaAnalysis::BeginLaUpdate()
+    {
+        ENCODE_FUNC_CALL();
+
+        m_currLaUpdate = nullptr;
+        if (m_laUpdateIdx < m_laUpdateQueue.size())
+        {
+            m_currLaUpdate = &m_laUpdateQueue[m_laUpdateIdx++];
+        }
+
+        return MOS_STATUS_SUCCESS;
+    }
+
     MOS_STATUS VdencLplaAnalysis::SetVdencPipeModeSelectParams(MHW_VDBOX_PIPE_MODE_SELECT_PARAMS_G12 &pipeModeSelectParams)
     {
         ENCODE_FUNC_CALL();
@@ -980,10 +1060,23 @@ namespace encode
 
     bool VdencLplaAnalysis::IsLaRecordsEmpty()
     {
+        // The regular update of the last pass drops one record after it is executed
+        if (m_laFlushNum == 0 && m_laRecordConsumedByUpdate && m_numValidLaRecords)
+        {
+            m_numValidLaRecords--;
+        }
+
         if (!m_numValidLaRecords)
         {
             return true; 
         }
+
+        LaUpdateRecord record;
+        record.numValidLaRecords = m_numValidLaRecords;
+        record.flushIdx          = m_laFlushNum++;
+        record.isFlush           = true;
+        m_laUpdateQueue.push_back(record);
+
         m_numValidLaRecords--;
         return false;
     }
@@ -406,6 +406,26 @@ namespace encode
         MOS_STATUS SetLaUpdateDmemBuffer(uint8_t currRecycledBufIdx, uint8_t currLaDataIdx,
             uint32_t numValidLaRecords, uint16_t curPass, uint16_t numPasses);
 
+        //!
+        //! \brief  Get look ahead update dmem buffer of current update
+        //! \details Chained flush updates in one submission each use their own dmem
+        //!          buffer, since all of them are written before the GPU runs.
+        //! \param  [in] currRecycledBufIdx
+        //!         Current recycled buffer index
+        //! \param  [in] curPass
+        //!         Current pass
+        //! \return PMOS_RESOURCE
+        //!         dmem buffer, nullptr if fail
+        //!
+        PMOS_RESOURCE GetLaUpdateDmemBuffer(uint8_t currRecycledBufIdx, uint16_t curPass);
+
+        //!
+        //! \brief  Get valid look ahead records number of current update
+        //! \return uint32_t
+        //!         Valid Lookahead records number
+        //!
+        uint32_t GetLaUpdateRecords() const;
+
         //!
         //! \brief  Get look ahead status report
         //! \param  [in] encodeStatusMfx
@@ -433,6 +453,26 @@ namespace encode
         //!
         MOS_STATUS CalculateLaRecords(bool blastPass);
 
+        //!
+        //! \brief  Queue the look ahead update of current pass
+        //! \details Called when the HuC LA update packet is activated, the number of
+        //!          valid records is captured here since all the packets of the frame
+        //!          are activated before any of them is submitted.
+        //! \param  [in] blastPass
+        //!         true if it is the last pass
+        //! \return MOS_STATUS
+        //!         MOS_STATUS_SUCCESS if success, else fail reason
+        //!
+        MOS_STATUS QueueLaUpdate(bool blastPass);
+
+        //!
+        //! \brief  Start the next queued look ahead update
+        //! \details Called once per HuC LA update packet submission, in activation order.
+        //! \return MOS_STATUS
+        //!         MOS_STATUS_SUCCESS if success, else fail reason
+        //!
+        MOS_STATUS BeginLaUpdate();
+
         //!
         //! \brief  Check if look ahead pass is required
         //! \return MOS_STATUS
@@ -442,6 +482,8 @@ namespace encode
 
         //!
         //! \brief  Check if look ahead record is empty
+        //! \details If not empty, one record is consumed and a chained flush
+        //!          update is queued for it.
         //! \return bool
         //!         true if record is empty
         //!
@@ -557,6 +599,19 @@ namespace encode
         bool                       m_forceIntraSteamInSetupDone  = false;
         PMOS_RESOURCE              m_forceIntraStreamInBuf       = nullptr;
         PMOS_RESOURCE              m_vdencLaUpdateDmemBuffer[CODECHAL_ENCODE_RECYCLED_BUFFER_NUM][CODECHAL_LPLA_NUM_OF_PASSES] = {};  //!< VDEnc Lookahead Update DMEM buffer
+        std::vector<PMOS_RESOURCE> m_vdencLaFlushDmemBuffer[CODECHAL_ENCODE_RECYCLED_BUFFER_NUM];  //!< VDEnc Lookahead Update DMEM buffer for chained flush updates
+
+        struct LaUpdateRecord
+        {
+            uint32_t numValidLaRecords = 0;      //!< Valid records captured when the update is queued
+            uint32_t flushIdx          = 0;      //!< Index of chained flush update in current frame
+            bool     isFlush           = false;  //!< Flush update for the last picture in stream
+        };
+        std::vector<LaUpdateRecord> m_laUpdateQueue;             //!< LA updates of current frame, in activation order
+        uint32_t                   m_laUpdateIdx          = 0;  //!< Index of next LA update to submit
+        uint32_t                   m_laFlushNum           = 0;  //!< Number of chained flush updates in current frame
+        const LaUpdateRecord      *m_currLaUpdate         = nullptr;
+        bool                       m_laRecordConsumedByUpdate = false;  //!< Last queued regular update consumes one record
         uint32_t                   m_statsBuffer[600][4]                                                                       = {};
         bool                       m_useDSData = false;
 
@@ -51,14 +51,22 @@ HevcVdencRoi::HevcVdencRoi(
 }
 MOS_STATUS HevcVdencRoi::ClearStreaminBuffer(uint32_t lucNumber)
 {
-    // Clear streamin
+    // Clear streamin, the whole CPU copy is written to m_streamIn in WriteStreaminData
     ENCODE_CHK_NULL_RETURN(m_streamInTemp);
 
+    MOS_ZeroMemory(m_streamInTemp, MOS_MIN(lucNumber * 64, m_streamInSize));
+
+    return MOS_STATUS_SUCCESS;
+}
+
+MOS_STATUS HevcVdencRoi::ClearGpuStreaminBuffer()
+{
+    ENCODE_CHK_NULL_RETURN(m_streamIn);
+
     uint8_t *data = (uint8_t *)m_allocator->LockResourceForWrite(m_streamIn);
     ENCODE_CHK_NULL_RETURN(data);
 
-    MOS_ZeroMemory(m_streamInTemp, lucNumber * 64);
-    MOS_SecureMemcpy(data, m_streamInSize, m_streamInTemp, m_streamInSize);
+    MOS_ZeroMemory(data, m_streamInSize);
 
     ENCODE_CHK_STATUS_RETURN(m_allocator->UnLock(m_streamIn));
 
@@ -158,7 +166,10 @@ MOS_STATUS HevcVdencRoi::Update(void *params)
 
     if (!m_isArbRoi || (hevcPicParams->CodingType == I_TYPE && !IFrameIsSet) || ((hevcPicParams->CodingType == P_TYPE || hevcPicParams->CodingType == B_TYPE) && !PBFrameIsSet))
     {
-        m_streamInTemp = (uint8_t *)MOS_AllocMemory(m_streamInSize);
+        if (m_streamInTemp == nullptr)
+        {
+            m_streamInTemp = (uint8_t *)MOS_AllocMemory(m_streamInSize);
+        }
         ENCODE_CHK_NULL_RETURN(m_streamInTemp);
 
         uint32_t lcuNumber = GetLCUNumber();
@@ -167,25 +178,34 @@ MOS_STATUS HevcVdencRoi::Update(void *params)
 
         m_roiOverlap.Update(lcuNumber);
 
-        ENCODE_CHK_STATUS_RETURN(ExecuteDirtyRoi(hevcSeqParams, hevcPicParams, hevcSlcParams));
-
         MEDIA_WA_TABLE *waTable = m_basicFeature->GetWaTable();
         ENCODE_CHK_NULL_RETURN(waTable);
 
-        if (MEDIA_IS_WA(waTable, WaHEVCVDEncForceDeltaQpRoiNotSupported) || m_isArbRoi || m_mbQpDataEnabled)
+        MOS_STATUS eStatus = ExecuteDirtyRoi(hevcSeqParams, hevcPicParams, hevcSlcParams);
+        if (eStatus == MOS_STATUS_SUCCESS)
         {
-            m_roiMode = false;
-            ENCODE_CHK_STATUS_RETURN(ExecuteRoi(hevcSeqParams, hevcPicParams, hevcSlcParams));
+            if (MEDIA_IS_WA(waTable, WaHEVCVDEncForceDeltaQpRoiNotSupported) || m_isArbRoi || m_mbQpDataEnabled)
+            {
+                m_roiMode = false;
+                eStatus   = ExecuteRoi(hevcSeqParams, hevcPicParams, hevcSlcParams);
+            }
+            else
+            {
+                m_roiMode = true;
+                eStatus   = ExecuteRoiExt(hevcSeqParams, hevcPicParams, hevcSlcParams);
+            }
         }
-        else
+        if (eStatus == MOS_STATUS_SUCCESS)
         {
-            m_roiMode = true;
-            ENCODE_CHK_STATUS_RETURN(ExecuteRoiExt(hevcSeqParams, hevcPicParams, hevcSlcParams));
+            eStatus = WriteStreaminData();
+        }
+        if (eStatus != MOS_STATUS_SUCCESS)
+        {
+            // m_streamIn is recycled, do not leave the stream in of an earlier frame to HW
+            ClearGpuStreaminBuffer();
+            ENCODE_ASSERTMESSAGE("Failed to build ROI stream in data.");
+            return eStatus;
         }
-
-        ENCODE_CHK_STATUS_RETURN(WriteStreaminData());
-
-        MOS_SafeFreeMemory(m_streamInTemp);
 
 #if (_DEBUG || _RELEASE_INTERNAL)
         ENCODE_CHK_NULL_RETURN(m_hwInterface);
@@ -60,7 +60,11 @@ public:
         CodechalHwInterface *hwInterface,
         void *constSettings);
 
-    virtual ~HevcVdencRoi() {}
+    virtual ~HevcVdencRoi()
+    {
+        MOS_SafeFreeMemory(m_streamInTemp);
+        m_streamInTemp = nullptr;
+    }
 
     //!
     //! \brief  Init encode parameter
@@ -211,6 +215,13 @@ protected:
     //!
     MOS_STATUS ClearStreaminBuffer(uint32_t lucNumber);
 
+    //!
+    //! \brief    Zero the GPU stream in buffer, used when building the stream in data failed
+    //! \return   MOS_STATUS
+    //!           MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    MOS_STATUS ClearGpuStreaminBuffer();
+
     //!
     //! \brief    Get strategy for setting command parameters
     //!
@@ -244,7 +255,7 @@ protected:
     bool m_isArbRoiSupported = true;     //!< Whether is Adaptive Region Boost ROI Supported
 
     PMOS_RESOURCE      m_streamIn = nullptr; //!< Stream in buffer
-    uint8_t *          m_streamInTemp = nullptr;
+    uint8_t *          m_streamInTemp = nullptr;  //!< CPU copy of stream in, kept across frames
     uint32_t           m_streamInSize = 0;
     RoiStrategyFactory m_strategyFactory;    //!< Factory of strategy
     RoiOverlap         m_roiOverlap;         //!< ROI and dirty ROI overlap
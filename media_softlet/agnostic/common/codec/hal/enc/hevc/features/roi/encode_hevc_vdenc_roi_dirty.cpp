@@ -204,10 +204,10 @@ MOS_STATUS DirtyROI::WriteStreaminData(
     switch (marker)
     {
     case RoiOverlap::mkDirtyRoi:
-        SetStreaminParamByTU(true, streaminDataParams);
+        streaminDataParams = GetStreaminParamByTU(true);
         break;
     case RoiOverlap::mkDirtyRoiNone64Align:
-        SetStreaminParamByTU(false, streaminDataParams);
+        streaminDataParams = GetStreaminParamByTU(false);
         break;
     case RoiOverlap::mkDirtyRoiBk:
         SetStreaminBackgroundData(true, streaminDataParams);
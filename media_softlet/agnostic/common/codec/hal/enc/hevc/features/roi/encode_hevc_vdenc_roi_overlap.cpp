@@ -110,6 +110,25 @@ MOS_STATUS RoiOverlap::WriteStreaminData(
     ENCODE_CHK_NULL_RETURN(streaminBuffer);
     ENCODE_CHK_NULL_RETURN(m_overlapMap);
 
+    if (roi != nullptr)
+    {
+        ENCODE_CHK_STATUS_RETURN(roi->PrepareStreaminData());
+    }
+    if (dirtyRoi != nullptr && dirtyRoi != roi)
+    {
+        MOS_STATUS status = dirtyRoi->PrepareStreaminData();
+        if (status != MOS_STATUS_SUCCESS)
+        {
+            if (roi != nullptr)
+            {
+                roi->CompleteStreaminData();
+            }
+            return status;
+        }
+    }
+
+    MOS_STATUS eStatus = MOS_STATUS_SUCCESS;
+
     for (uint32_t i = 0; i < m_lcuNumber; i++)
     {
         OverlapMarker marker = GetMarker(m_overlapMap[i]);
@@ -117,7 +136,11 @@ MOS_STATUS RoiOverlap::WriteStreaminData(
 
         if (IsRoiMarker(marker))
         {
-            ENCODE_CHK_NULL_RETURN(roi);
+            if (roi == nullptr)
+            {
+                eStatus = MOS_STATUS_NULL_POINTER;
+                break;
+            }
 
             roi->WriteStreaminData(
                 i, marker, roiRegionIndex, streaminBuffer);
@@ -125,11 +148,27 @@ MOS_STATUS RoiOverlap::WriteStreaminData(
         }
         else if (IsDirtyRoiMarker(marker))
         {
-            ENCODE_CHK_NULL_RETURN(dirtyRoi);
+            if (dirtyRoi == nullptr)
+            {
+                eStatus = MOS_STATUS_NULL_POINTER;
+                break;
+            }
             dirtyRoi->WriteStreaminData(
                 i, marker, roiRegionIndex, streaminBuffer);
         }
     }
+
+    // Release the per frame resources even if the writing is interrupted
+    if (roi != nullptr)
+    {
+        roi->CompleteStreaminData();
+    }
+    if (dirtyRoi != nullptr && dirtyRoi != roi)
+    {
+        dirtyRoi->CompleteStreaminData();
+    }
+
+    ENCODE_CHK_STATUS_RETURN(eStatus);
     return MOS_STATUS_SUCCESS;
 }
 
@@ -90,7 +90,7 @@ namespace encode
 
         StreamInParams streaminDataParams;
         MOS_ZeroMemory(&streaminDataParams, sizeof(streaminDataParams));
-        uint8_t *QpData = (uint8_t *)m_allocator->LockResourceForRead(&(m_basicFeature->m_mbQpDataSurface.OsResource));
+        uint8_t *QpData = m_qpData;
         ENCODE_CHK_NULL_RETURN(QpData);
 
         uint32_t w_in16 = m_basicFeature->m_mbQpDataSurface.dwWidth;
@@ -100,7 +100,6 @@ namespace encode
         SetRoiCtrlMode(lcuIndex, streaminDataParams, w_in16, h_in16, Pitch, QpData);
         SetQpRoiCtrlPerLcu(&streaminDataParams, (HevcVdencStreamInState *)(rawStreamIn + (lcuIndex * 64)));
 
-        m_allocator->UnLock(&(m_basicFeature->m_mbQpDataSurface.OsResource));
         HevcVdencStreamInState *data = (HevcVdencStreamInState *)(rawStreamIn + (lcuIndex * 64));
 
         if (lcuIndex % 4 == 3)
@@ -111,14 +110,40 @@ namespace encode
             {
                 cu64Align = true;
             }
+            streaminDataParams = GetStreaminParamByTU(cu64Align);
             for (int i = 0; i < 4; i++)
             {
-                MOS_ZeroMemory(&streaminDataParams, sizeof(streaminDataParams));
-                SetStreaminParamByTU(cu64Align, streaminDataParams);
                 SetStreaminDataPerLcu(&streaminDataParams, rawStreamIn + (lcuIndex-i) * 64);
             }
         }
         return MOS_STATUS_SUCCESS;
     }
 
+    MOS_STATUS QPMapROI::PrepareStreaminData()
+    {
+        ENCODE_CHK_STATUS_RETURN(RoiStrategy::PrepareStreaminData());
+        ENCODE_CHK_NULL_RETURN(m_allocator);
+        ENCODE_CHK_NULL_RETURN(m_basicFeature);
+
+        // Lock once per frame instead of once per LCU
+        m_qpData = (uint8_t *)m_allocator->LockResourceForRead(&(m_basicFeature->m_mbQpDataSurface.OsResource));
+        ENCODE_CHK_NULL_RETURN(m_qpData);
+
+        return MOS_STATUS_SUCCESS;
+    }
+
+    MOS_STATUS QPMapROI::CompleteStreaminData()
+    {
+        if (m_qpData == nullptr)
+        {
+            return MOS_STATUS_SUCCESS;
+        }
+
+        ENCODE_CHK_NULL_RETURN(m_allocator);
+        ENCODE_CHK_NULL_RETURN(m_basicFeature);
+
+        m_qpData = nullptr;
+        return m_allocator->UnLock(&(m_basicFeature->m_mbQpDataSurface.OsResource));
+    }
+
 }  // namespace encode
@@ -104,7 +104,22 @@ namespace encode
             uint32_t                  roiRegionIndex,
             uint8_t *                 rawStreamIn) override;
 
+        //!
+        //! \brief    Lock the MB QP data surface once for current frame
+        //! \return   MOS_STATUS
+        //!           MOS_STATUS_SUCCESS if success, else fail reason
+        //!
+        virtual MOS_STATUS PrepareStreaminData() override;
+
+        //!
+        //! \brief    Unlock the MB QP data surface
+        //! \return   MOS_STATUS
+        //!           MOS_STATUS_SUCCESS if success, else fail reason
+        //!
+        virtual MOS_STATUS CompleteStreaminData() override;
+
     private:
+        uint8_t *m_qpData = nullptr;  //!< Locked MB QP data, valid between Prepare/CompleteStreaminData
 
 
     MEDIA_CLASS_DEFINE_END(encode__QPMapROI)
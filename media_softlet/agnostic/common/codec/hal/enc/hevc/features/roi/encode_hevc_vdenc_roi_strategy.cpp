@@ -74,26 +74,10 @@ void RoiStrategy::StreaminZigZagToLinearMap(
     uint32_t *offset,
     uint32_t *xyOffset)
 {
-    ENCODE_FUNC_CALL();
-
-    *offset          = streamInWidth * y;
-    uint32_t yOffset = 0;
-    uint32_t xOffset = 2 * x;
-
     //Calculate X Y Offset for the zig zag scan with in each 64x64 LCU
-    //dwOffset gives the 64 LCU row
-    if (y % 2)
-    {
-        *offset = streamInWidth * (y - 1);
-        yOffset = 2;
-    }
-
-    if (x % 2)
-    {
-        xOffset = (2 * x) - 1;
-    }
-
-    *xyOffset = xOffset + yOffset;
+    //offset gives the 64 LCU row, each 64 LCU holds 4 32x32 CUs in z order
+    *offset   = streamInWidth * (y & ~1u);
+    *xyOffset = 2 * x - (x & 1) + 2 * (y & 1);
 }
 
 void RoiStrategy::ZigZagToRaster(
@@ -250,13 +234,25 @@ MOS_STATUS RoiStrategy::WriteStreaminData(
     SetRoiCtrlMode(lcuIndex, roiRegionIndex, streaminDataParams);
     SetQpRoiCtrlPerLcu(&streaminDataParams, (HevcVdencStreamInState *)(rawStreamIn + (lcuIndex * 64)));
 
-    MOS_ZeroMemory(&streaminDataParams, sizeof(streaminDataParams));
-    SetStreaminParamByTU(cu64Align, streaminDataParams);
+    streaminDataParams = GetStreaminParamByTU(cu64Align);
     SetStreaminDataPerLcu(&streaminDataParams, rawStreamIn + (lcuIndex * 64));
 
     return MOS_STATUS_SUCCESS;
 }
 
+const StreamInParams &RoiStrategy::GetStreaminParamByTU(bool cu64Align)
+{
+    uint32_t idx = cu64Align ? 1 : 0;
+
+    if (!m_tuStreaminParamsValid[idx])
+    {
+        SetStreaminParamByTU(cu64Align, m_tuStreaminParams[idx]);
+        m_tuStreaminParamsValid[idx] = true;
+    }
+
+    return m_tuStreaminParams[idx];
+}
+
 void RoiStrategy::SetStreaminParamByTU(
     bool cu64Align,
     StreamInParams &streaminDataParams)
@@ -347,15 +343,21 @@ void RoiStrategy::GetLCUsInRoiRegion(
         return;
     }
 
+    if (bottom <= top || right <= left)
+    {
+        return;
+    }
+
+    lcuVector.reserve(lcuVector.size() + (bottom - top) * (right - left));
+
     for (auto y = top; y < bottom; y++)
     {
+        //Calculate X Y for the zig zag scan, the row part is shared by the whole row
+        uint32_t rowOffset = streamInWidth * (y & ~1u) + 2 * (y & 1);
+
         for (auto x = left; x < right; x++)
         {
-            //Calculate X Y for the zig zag scan
-            uint32_t offset = 0, xyOffset = 0;
-            StreaminZigZagToLinearMap(streamInWidth, x, y, &offset, &xyOffset);
-
-            lcuVector.push_back(offset + xyOffset);
+            lcuVector.push_back(rowOffset + 2 * x - (x & 1));
         }
     }
 }
@@ -316,6 +316,42 @@ public:
 
     void SetFeatureSetting(HevcVdencFeatureSettings *settings) { m_FeatureSettings = settings; }
 
+    //!
+    //! \brief    Prepare for writing the Streamin data of current frame
+    //!
+    //! \details  Called once before WriteStreaminData is called for LCUs,
+    //!           resources needed by all LCUs should be locked here.
+    //!
+    //! \return   MOS_STATUS
+    //!           MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    virtual MOS_STATUS PrepareStreaminData()
+    {
+        ResetStreaminParamCache();
+        return MOS_STATUS_SUCCESS;
+    }
+
+    //!
+    //! \brief    Complete writing the Streamin data of current frame
+    //!
+    //! \details  Called once after WriteStreaminData is called for LCUs.
+    //!
+    //! \return   MOS_STATUS
+    //!           MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    virtual MOS_STATUS CompleteStreaminData() { return MOS_STATUS_SUCCESS; }
+
+    //!
+    //! \brief    Invalidate the streamin parameters cached for current frame
+    //!
+    //! \return   void
+    //!
+    void ResetStreaminParamCache()
+    {
+        m_tuStreaminParamsValid[0] = false;
+        m_tuStreaminParamsValid[1] = false;
+    }
+
 protected:
     //!
     //! \brief    Calculate X/Y offsets for zigzag scan within 64 LCU
@@ -457,6 +493,20 @@ protected:
         bool cu64Align,
         StreamInParams &streaminDataParams);
 
+    //!
+    //! \brief    Get streamin parameter according to the TU
+    //!
+    //! \details  The parameter only depends on cu64Align within one frame,
+    //!           so it is generated once and reused for all LCUs.
+    //!
+    //! \param    [in] cu64Align
+    //!           Whether CU is 64 aligned
+    //!
+    //! \return   const StreamInParams &
+    //!           Streamin data parameters
+    //!
+    const StreamInParams &GetStreaminParamByTU(bool cu64Align);
+
     //!
     //! \brief    Set the ROI ctrol mode(Native/ForceQP)
     //!
@@ -513,6 +563,9 @@ protected:
     HevcVdencFeatureSettings *m_FeatureSettings = nullptr;
     PMOS_INTERFACE m_osInterface = nullptr;
 
+    StreamInParams m_tuStreaminParams[2]      = {};              //!< Streamin params by TU, indexed by cu64Align
+    bool           m_tuStreaminParamsValid[2] = {false, false};
+
 MEDIA_CLASS_DEFINE_END(encode__RoiStrategy)
 };
 
@@ -169,6 +169,8 @@ namespace encode
     {
         ENCODE_FUNC_CALL();
 
+        PERF_UTILITY_AUTO(__FUNCTION__, PERF_ENCODE, PERF_LEVEL_HAL);
+
         m_pictureStatesSize    = m_defaultPictureStatesSize;
         m_picturePatchListSize = m_defaultPicturePatchListSize;
         m_sliceStatesSize      = m_defaultSliceStatesSize;
@@ -309,6 +311,8 @@ namespace encode
     {
         ENCODE_FUNC_CALL();
 
+        PERF_UTILITY_AUTO(__FUNCTION__, PERF_ENCODE, PERF_LEVEL_HAL);
+
         if (m_submitState == submitFrameByDefault)
         {
             ENCODE_CHK_STATUS_RETURN(SubmitPictureLevel(commandBuffer, packetPhase));
@@ -368,6 +372,8 @@ namespace encode
     {
         ENCODE_FUNC_CALL();
 
+        PERF_UTILITY_AUTO(__FUNCTION__, PERF_ENCODE, PERF_LEVEL_HAL);
+
         ENCODE_CHK_STATUS_RETURN(m_miItf->SetWatchdogTimerThreshold(m_basicFeature->m_frameWidth, m_basicFeature->m_frameHeight, true));
 
         uint16_t perfTag = m_pipeline->IsFirstPass() ? CODECHAL_ENCODE_PERFTAG_CALL_PAK_ENGINE : CODECHAL_ENCODE_PERFTAG_CALL_PAK_ENGINE_SECOND_PASS;
@@ -424,6 +430,8 @@ namespace encode
     {
         ENCODE_FUNC_CALL();
 
+        PERF_UTILITY_AUTO(__FUNCTION__, PERF_ENCODE, PERF_LEVEL_HAL);
+
         if (m_hevcPicParams->tiles_enabled_flag)
         {
             return MOS_STATUS_SUCCESS;
@@ -514,16 +514,53 @@ namespace encode
         ENCODE_FUNC_CALL();
         MOS_STATUS eStatus = MOS_STATUS_SUCCESS;
 
+        uint32_t recycledBufIdx = m_pipeline->m_currRecycledBufIdx;
+        uint8_t  currentPass    = m_pipeline->GetCurrentPass();
+        ENCODE_CHK_COND_RETURN(recycledBufIdx >= CODECHAL_ENCODE_RECYCLED_BUFFER_NUM || currentPass >= VDENC_BRC_NUM_OF_PASSES,
+            "Invalid BRC update DMEM buffer index");
+
+        // Build update DMEM on CPU side first, most fields are unchanged between frames
+        VdencHevcHucBrcUpdateDmem hucVdencBrcUpdateDmem;
+        MOS_ZeroMemory(&hucVdencBrcUpdateDmem, sizeof(VdencHevcHucBrcUpdateDmem));
+
+        const_cast<HucBrcUpdatePkt* const>(this)->SetCommonDmemBuffer(&hucVdencBrcUpdateDmem);
+        SetExtDmemBuffer(&hucVdencBrcUpdateDmem);
+
+        VdencHevcHucBrcUpdateDmem &shadow = m_vdencBrcUpdateDmemShadow[recycledBufIdx][currentPass];
+        bool shadowValid = m_vdencBrcUpdateDmemShadowValid[recycledBufIdx][currentPass];
+        if (shadowValid && memcmp(&shadow, &hucVdencBrcUpdateDmem, sizeof(VdencHevcHucBrcUpdateDmem)) == 0)
+        {
+            // Buffer already holds this content, skip the lock
+            return MOS_STATUS_SUCCESS;
+        }
+
         // Program update DMEM
-        auto hucVdencBrcUpdateDmem =
-            (VdencHevcHucBrcUpdateDmem *)m_allocator->LockResourceForWrite(const_cast<MOS_RESOURCE*>(&m_vdencBrcUpdateDmemBuffer[m_pipeline->m_currRecycledBufIdx][m_pipeline->GetCurrentPass()]));
-        ENCODE_CHK_NULL_RETURN(hucVdencBrcUpdateDmem);
-        MOS_ZeroMemory(hucVdencBrcUpdateDmem, sizeof(VdencHevcHucBrcUpdateDmem));
+        uint8_t *data = (uint8_t *)m_allocator->LockResourceForWrite(const_cast<MOS_RESOURCE*>(&m_vdencBrcUpdateDmemBuffer[recycledBufIdx][currentPass]));
+        ENCODE_CHK_NULL_RETURN(data);
+
+        if (shadowValid)
+        {
+            // Only rewrite the cache lines which differ from the last programmed content
+            const uint8_t *src  = (const uint8_t *)&hucVdencBrcUpdateDmem;
+            const uint8_t *prev = (const uint8_t *)&shadow;
+            for (uint32_t offset = 0; offset < sizeof(VdencHevcHucBrcUpdateDmem); offset += CODECHAL_CACHELINE_SIZE)
+            {
+                uint32_t size = MOS_MIN((uint32_t)CODECHAL_CACHELINE_SIZE, (uint32_t)sizeof(VdencHevcHucBrcUpdateDmem) - offset);
+                if (memcmp(prev + offset, src + offset, size) != 0)
+                {
+                    MOS_SecureMemcpy(data + offset, size, src + offset, size);
+                }
+            }
+        }
+        else
+        {
+            MOS_SecureMemcpy(data, sizeof(VdencHevcHucBrcUpdateDmem), &hucVdencBrcUpdateDmem, sizeof(VdencHevcHucBrcUpdateDmem));
+        }
 
-        const_cast<HucBrcUpdatePkt* const>(this)->SetCommonDmemBuffer(hucVdencBrcUpdateDmem);
-        SetExtDmemBuffer(hucVdencBrcUpdateDmem);
+        m_allocator->UnLock(const_cast<MOS_RESOURCE*>(&m_vdencBrcUpdateDmemBuffer[recycledBufIdx][currentPass]));
 
-        m_allocator->UnLock(const_cast<MOS_RESOURCE*>(&m_vdencBrcUpdateDmemBuffer[m_pipeline->m_currRecycledBufIdx][m_pipeline->GetCurrentPass()]));
+        MOS_SecureMemcpy(&shadow, sizeof(VdencHevcHucBrcUpdateDmem), &hucVdencBrcUpdateDmem, sizeof(VdencHevcHucBrcUpdateDmem));
+        m_vdencBrcUpdateDmemShadowValid[recycledBufIdx][currentPass] = true;
 
         return MOS_STATUS_SUCCESS;
     }
@@ -61,6 +61,9 @@ namespace encode
         bool requestProlog    = false;
         bool isLaAnalysisRequired = true;
 
+        // Pick up the LA update queued when this packet was activated
+        RUN_FEATURE_INTERFACE_RETURN(VdencLplaAnalysis, HevcFeatureIDs::vdencLplaAnalysisFeature, BeginLaUpdate);
+
 #if _SW_BRC
         if (!m_pipeline->IsFirstPass())
         {
@@ -70,6 +70,8 @@ MOS_STATUS HevcVdencPipeline::UserFeatureReport()
 
 MOS_STATUS HevcVdencPipeline::Prepare(void *params)
 {
+    PERF_UTILITY_AUTO(__FUNCTION__, PERF_ENCODE, PERF_LEVEL_HAL);
+
     EncoderParams *encodeParams = (EncoderParams *)params;
 
     ENCODE_CHK_NULL_RETURN(encodeParams);
@@ -119,6 +121,7 @@ MOS_STATUS HevcVdencPipeline::ActivateVdencVideoPackets()
             {
                 ENCODE_CHK_STATUS_RETURN(ActivatePacket(HucLaInit, immediateSubmit, 0, 0));
             }
+            ENCODE_CHK_STATUS_RETURN(laAnalysisFeature->QueueLaUpdate(curPass == GetPassNum() - 1));
             ENCODE_CHK_STATUS_RETURN(ActivatePacket(HucLaUpdate, immediateSubmit, curPass, 0));
 
             if (laAnalysisFeature->IsLastPicInStream())
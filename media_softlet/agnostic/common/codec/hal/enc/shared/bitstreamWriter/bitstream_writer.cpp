@@ -65,41 +65,55 @@ void BitstreamWriter::Reset(mfxU8 *bs, mfxU32 size, mfxU8 bitOffset)
 }
 
 void BitstreamWriter::PutBitsBuffer(mfxU32 n, void *bb, mfxU32 o)
-{}
-
-void BitstreamWriter::PutBits(mfxU32 n, mfxU32 b)
 {
-    assert(n <= sizeof(b) * 8);
-    while (n > 24)
+    mfxU8 *b     = (mfxU8 *)bb + (o >> 3);
+    mfxU32 shift = (o & 7);
+
+    if (!shift && !m_bitOffset)
     {
-        n -= 16;
-        PutBits(16, (b >> n));
+        // both sides byte aligned, plain copy
+        for (; n >= 8; n -= 8)
+        {
+            *m_bs++ = *b++;
+        }
     }
 
-    b <<= (32 - n);
-
-    if (!m_bitOffset)
+    for (; n >= 8; n -= 8, b++)
     {
-        m_bs[0] = (mfxU8)(b >> 24);
-        m_bs[1] = (mfxU8)(b >> 16);
+        PutBits(8, shift ? (mfxU8)((b[0] << shift) | (b[1] >> (8 - shift))) : b[0]);
     }
-    else
+
+    if (n)
     {
-        b >>= m_bitOffset;
-        n += m_bitOffset;
+        mfxU32 last = (mfxU8)(b[0] << shift);
+
+        if (shift + n > 8)
+            last |= (b[1] >> (8 - shift));
 
-        m_bs[0] |= (mfxU8)(b >> 24);
-        m_bs[1] = (mfxU8)(b >> 16);
+        PutBits(n, last >> (8 - n));
     }
+}
+
+void BitstreamWriter::PutBits(mfxU32 n, mfxU32 b)
+{
+    assert(n > 0 && n <= sizeof(b) * 8);
+
+    // Up to 32 + 7 bits land in one 64-bit window, so the field is placed with
+    // one shift and stored byte by byte without splitting it.
+    mfxU64 acc   = ((mfxU64)b << (64 - n)) >> m_bitOffset;
+    mfxU32 bits  = n + m_bitOffset;
+    mfxU32 bytes = (bits + 7) >> 3;
 
-    if (n > 16)
+    if (m_bitOffset)
+        acc |= (mfxU64)m_bs[0] << 56;
+
+    for (mfxU32 i = 0; i < bytes; i++)
     {
-        m_bs[2] = (mfxU8)(b >> 8);
-        m_bs[3] = (mfxU8)b;
+        m_bs[i] = (mfxU8)(acc >> (56 - 8 * i));
     }
 
-    m_bs += (n >> 3);
-    m_bitOffset = (n & 7);
+    m_bs += (bits >> 3);
+    m_bitOffset = (bits & 7);
 }
 
 void BitstreamWriter::PutBit(mfxU32 b)
@@ -138,8 +152,16 @@ void BitstreamWriter::PutGolomb(mfxU32 b)
         while (b >> n)
             n++;
 
-        PutBits(n - 1, 0);
-        PutBits(n, b);
+        // the n - 1 leading zeros are implied by the field width
+        if (n <= 16)
+        {
+            PutBits(2 * n - 1, b);
+        }
+        else
+        {
+            PutBits(n - 1, 0);
+            PutBits(n, b);
+        }
     }
 }
 
@@ -164,8 +186,10 @@ void BitstreamWriter::PutBitC(mfxU32 B)
 
     while (m_bitsOutstanding > 0)
     {
-        PutBit(1 - B);
-        m_bitsOutstanding--;
+        mfxU32 n = (m_bitsOutstanding > 32) ? 32 : m_bitsOutstanding;
+
+        PutBits(n, B ? 0 : 0xFFFFFFFF);
+        m_bitsOutstanding -= n;
     }
 }
 void BitstreamWriter::RenormE()
@@ -40,7 +40,7 @@ typedef unsigned long mfxUL32;
 typedef long          mfxL32;
 typedef float  mfxF32;
 typedef double mfxF64;
-//typedef __UINT64            mfxU64;
+typedef unsigned long long mfxU64;
 //typedef __INT64             mfxI64;
 typedef void * mfxHDL;
 typedef mfxHDL mfxMemId;
@@ -34,6 +34,7 @@
 
 namespace encode {
 constexpr MapBufferResourceType TrackedBuffer::m_mapBufferResourceType[];
+constexpr uint64_t TrackedBuffer::m_retiredQueueBudget;
 TrackedBuffer::TrackedBuffer(EncodeAllocator *allocator, uint8_t maxRefCnt, uint8_t maxNonRefCnt)
     : m_maxRefSlotCnt(maxRefCnt),
       m_maxNonRefSlotCnt(maxNonRefCnt),
@@ -199,46 +200,50 @@ MOS_STATUS TrackedBuffer::Release(CODEC_REF_LIST* refList)
         m_condition.Signal();
     }
 
-    if (!m_oldQueue.empty())
-    {
-        for (auto iter = m_oldQueue.begin(); iter != m_oldQueue.end();)
-        {
-            if (iter->second->SafeToDestory())
-            {
-                iter = m_oldQueue.erase(iter);
-            }
-            else
-            {
-                iter++;
-            }
-        }
-    }
+    TrimRetiredQueues();
 
     return MOS_STATUS_SUCCESS;
 }
 
 MOS_STATUS TrackedBuffer::OnSizeChange()
 {
-    for (auto iter = m_bufferQueue.begin(); iter != m_bufferQueue.end();)
+    AutoLock lock(m_mutex);
+
+    // keep the queues instead of destroying them, buffers whose size does not
+    // depend on the resolution and switches back to a recent resolution reuse them
+    m_oldQueue.insert(m_oldQueue.end(),
+        std::make_move_iterator(m_bufferQueue.begin()),
+        std::make_move_iterator(m_bufferQueue.end()));
+    m_bufferQueue.clear();
+
+    TrimRetiredQueues();
+
+    return MOS_STATUS_SUCCESS;
+}
+
+void TrackedBuffer::TrimRetiredQueues()
+{
+    uint64_t idleSize = 0;
+    for (auto &queue : m_oldQueue)
+    {
+        if (queue.second->SafeToDestory())
+        {
+            idleSize += queue.second->GetAllocatedSize();
+        }
+    }
+
+    for (auto iter = m_oldQueue.begin(); iter != m_oldQueue.end() && idleSize > m_retiredQueueBudget;)
     {
         if (iter->second->SafeToDestory())
         {
-            iter = m_bufferQueue.erase(iter);
+            idleSize -= iter->second->GetAllocatedSize();
+            iter = m_oldQueue.erase(iter);
         }
         else
         {
             iter++;
         }
     }
-
-    if (!m_bufferQueue.empty())
-    {
-        m_oldQueue.insert(std::make_move_iterator(m_bufferQueue.begin()),
-            std::make_move_iterator(m_bufferQueue.end()));
-        m_bufferQueue.clear();
-    }
-
-    return MOS_STATUS_SUCCESS;
 }
 
 MOS_SURFACE *TrackedBuffer::GetSurface(BufferType type, uint32_t index)
@@ -266,6 +271,9 @@ MOS_RESOURCE *TrackedBuffer::GetBuffer(BufferType type, uint32_t index)
 
 std::shared_ptr<BufferQueue> TrackedBuffer::GetBufferQueue(BufferType type)
 {
+    // OnSizeChange moves the queues away concurrently, look up under the lock
+    AutoLock lock(m_mutex);
+
     auto iter = m_bufferQueue.find(type);
     if (iter == m_bufferQueue.end())
     {
@@ -275,6 +283,18 @@ std::shared_ptr<BufferQueue> TrackedBuffer::GetBufferQueue(BufferType type)
             return nullptr;
         }
 
+        // revive the most recently retired queue which still fits
+        for (auto old = m_oldQueue.rbegin(); old != m_oldQueue.rend(); old++)
+        {
+            if (old->first == type && old->second->IsCompatible(param->second))
+            {
+                auto alloc = old->second;
+                m_oldQueue.erase(std::next(old).base());
+                m_bufferQueue.insert(std::make_pair(type, alloc));
+                return alloc;
+            }
+        }
+
         ResourceType resType = GetResourceType(type);
 
         auto alloc = std::make_shared<BufferQueue>(m_allocator, param->second, m_maxSlotCnt);
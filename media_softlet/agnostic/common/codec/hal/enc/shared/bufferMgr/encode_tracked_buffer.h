@@ -142,8 +142,9 @@ public:
     MOS_STATUS Release(CODEC_REF_LIST *refList);
 
     //!
-    //! \brief  It must be invoked when resolution changes, it will release
-    //!         internal buffers on demand
+    //! \brief  It must be invoked when resolution changes, it will retire
+    //!         the current buffer queues, the retired queues are revived when
+    //!         a later allocate parameter is compatible with them
     //! \return MOS_STATUS
     //!         MOS_STATUS_SUCCESS if success, else fail reason
     //!
@@ -209,6 +210,11 @@ protected:
     //!         shared_ptr<BufferQueue> if success, else nullptr
     std::shared_ptr<BufferQueue> GetBufferQueue(BufferType type);
 
+    //!
+    //! \brief  Destroy the oldest idle retired queues until the idle ones fit in the budget
+    //!
+    void TrimRetiredQueues();
+
     static constexpr MapBufferResourceType m_mapBufferResourceType[] =
     {
         {BufferType::mbCodedBuffer,             ResourceType::bufferResource},
@@ -247,7 +253,9 @@ protected:
 
     std::map<BufferType, MOS_ALLOC_GFXRES_PARAMS>       m_allocParams = {};  //!< allocate parameters
     std::map<BufferType, std::shared_ptr<BufferQueue> > m_bufferQueue = {};  //!< buffer queues
-    std::map<BufferType, std::shared_ptr<BufferQueue> > m_oldQueue = {};     //!< old queues for resolution change
+    std::vector<std::pair<BufferType, std::shared_ptr<BufferQueue> > > m_oldQueue = {};  //!< retired queues for resolution change, oldest first
+
+    static constexpr uint64_t m_retiredQueueBudget = 64 * 1024 * 1024;  //!< max bytes kept by idle retired queues
 
 MEDIA_CLASS_DEFINE_END(encode__TrackedBuffer)
 };
@@ -110,6 +110,53 @@ bool BufferQueue::SafeToDestory()
     return m_resourcePool.size() == m_resources.size();
 }
 
+bool BufferQueue::IsCompatible(const MOS_ALLOC_GFXRES_PARAMS &param)
+{
+    if (m_allocParam.Type != param.Type ||
+        m_allocParam.Format != param.Format ||
+        m_allocParam.TileType != param.TileType ||
+        m_allocParam.Flags.bNotLockable != param.Flags.bNotLockable ||
+        m_allocParam.bIsCompressible != param.bIsCompressible ||
+        m_allocParam.CompressionMode != param.CompressionMode ||
+        m_allocParam.ResUsageType != param.ResUsageType)
+    {
+        return false;
+    }
+
+    if (m_resourceType == ResourceType::bufferResource)
+    {
+        // a larger linear buffer can always hold the smaller payload
+        return m_allocParam.dwBytes >= param.dwBytes;
+    }
+
+    // surface dimensions are programmed from the surface itself, so they must match
+    return m_allocParam.dwWidth == param.dwWidth &&
+           m_allocParam.dwHeight == param.dwHeight &&
+           m_allocParam.dwDepth == param.dwDepth &&
+           m_allocParam.dwArraySize == param.dwArraySize;
+}
+
+uint64_t BufferQueue::GetAllocatedSize()
+{
+    AutoLock lock(m_mutex);
+
+    uint64_t size = 0;
+    for (auto resource : m_resources)
+    {
+        if (m_resourceType == ResourceType::surfaceResource)
+        {
+            MOS_SURFACE *surface = (MOS_SURFACE *)resource;
+            size += (uint64_t)surface->dwPitch * surface->dwHeight;
+        }
+        else
+        {
+            size += m_allocParam.dwBytes;
+        }
+    }
+
+    return size;
+}
+
 
 void *BufferQueue::AllocateResource()
 {
@@ -87,6 +87,22 @@ public:
     //!
     bool SafeToDestory();
 
+    //!
+    //! \brief  Check whether the resources of this queue can serve the given allocate parameter
+    //! \param  [in] param
+    //!         reference to MOS_ALLOC_GFXRES_PARAMS
+    //! \return bool
+    //!         true if linear buffers are large enough or surfaces have the same layout
+    //!
+    bool IsCompatible(const MOS_ALLOC_GFXRES_PARAMS &param);
+
+    //!
+    //! \brief  Get the approximate memory size held by the queue
+    //! \return uint64_t
+    //!         bytes of all allocated resources
+    //!
+    uint64_t GetAllocatedSize();
+
     void SetResourceType(ResourceType resType) { m_resourceType = resType; }
 
 protected:
@@ -211,6 +211,8 @@ MOS_STATUS EncodePipeline::Prepare(void *params)
 {
     ENCODE_FUNC_CALL();
 
+    PERF_UTILITY_AUTO(__FUNCTION__, PERF_ENCODE, PERF_LEVEL_HAL);
+
     ENCODE_CHK_NULL_RETURN(params);
     ENCODE_CHK_NULL_RETURN(m_hwInterface);
 
@@ -310,6 +312,9 @@ MOS_STATUS EncodePipeline::WaitForBatchBufferComplete()
 MOS_STATUS EncodePipeline::ExecuteActivePackets()
 {
     ENCODE_FUNC_CALL();
+
+    PERF_UTILITY_AUTO(__FUNCTION__, PERF_ENCODE, PERF_LEVEL_HAL);
+
     MOS_TraceEventExt(EVENT_PIPE_EXE, EVENT_TYPE_START, nullptr, 0, nullptr, 0);
 
     for (auto prop : m_activePacketList)
@@ -63,6 +63,7 @@ MOS_STATUS HeapManager::AcquireSpace(
     }
 
     spaceNeeded = 0;
+    ++m_statistics.m_acquireCount;
     MOS_STATUS acquireSpaceResult = m_blockManager.AcquireSpace(params, blocks, spaceNeeded);
     if (acquireSpaceResult == MOS_STATUS_CLIENT_AR_NO_SPACE)
     {
@@ -196,6 +197,10 @@ MOS_STATUS HeapManager::AllocateHeap(uint32_t size)
         return MOS_STATUS_INVALID_PARAMETER;
     }
 
+    if (!m_heapIds.empty())
+    {
+        ++m_statistics.m_extendCount;
+    }
     ++m_currHeapId;
     m_heapIds.push_back(m_currHeapId);
 
@@ -217,6 +222,7 @@ MOS_STATUS HeapManager::Wait()
     HEAP_FUNCTION_ENTER_VERBOSE;
 
     bool blocksUpdated = false;
+    ++m_statistics.m_waitCount;
 
     for (auto waitMs = m_waitTimeout; waitMs > 0; waitMs -= m_waitIncrement)
     {
@@ -84,7 +84,20 @@ MOS_STATUS MemoryBlockManager::AcquireSpace(
         (*sortedIterator).m_blockSize = MOS_ALIGN_CEIL(*requestIterator, alignment);
         ++sortedIterator;
     }
-    if (m_sortedSizes.size() > 1)
+    // Requests are commonly made largest first already; skip the sort then
+    auto isSorted = [this]() {
+        for (auto curr = m_sortedSizes.begin(), next = std::next(curr);
+            next != m_sortedSizes.end();
+            curr = next++)
+        {
+            if ((*curr).m_blockSize < (*next).m_blockSize)
+            {
+                return false;
+            }
+        }
+        return true;
+    };
+    if (m_sortedSizes.size() > 1 && !isSorted())
     {
         m_sortedSizes.sort([](SortedSizePair &a, SortedSizePair &b) { return a.m_blockSize > b.m_blockSize; });
     }
@@ -100,6 +113,9 @@ MOS_STATUS MemoryBlockManager::AcquireSpace(
     if (spaceNeeded == 0)
     {
         HEAP_CHK_STATUS(AllocateSpace(params, blocks));
+        m_peakUsedSize = MOS_MAX(m_peakUsedSize,
+            m_sortedBlockListSizes[MemoryBlockInternal::State::allocated] +
+            m_sortedBlockListSizes[MemoryBlockInternal::State::submitted]);
         return MOS_STATUS_SUCCESS;
     }
 
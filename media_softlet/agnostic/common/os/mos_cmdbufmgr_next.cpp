@@ -30,7 +30,11 @@ CmdBufMgrNext::CmdBufMgrNext()
 {
     MOS_OS_FUNCTION_ENTER;
 
-    m_availableCmdBufPool.clear();
+    for (auto &pool : m_availableCmdBufPool)
+    {
+        pool.clear();
+    }
+    m_availableCmdBufNum = 0;
     m_inUseCmdBufPool.clear();
     m_initialized = false;
 }
@@ -82,7 +86,7 @@ MOS_STATUS CmdBufMgrNext::Initialize(OsContextNext *osContext, uint32_t cmdBufSi
             }
 
             MosUtilities::MosLockMutex(m_availablePoolMutex);
-            m_availableCmdBufPool.push_back(cmdBuf);
+            UpperInsert(cmdBuf);
             MosUtilities::MosUnlockMutex(m_availablePoolMutex);
 
             m_cmdBufTotalNum++;
@@ -98,7 +102,6 @@ MOS_STATUS CmdBufMgrNext::Reset()
 {
     MOS_OS_FUNCTION_ENTER;
 
-    CommandBufferNext *cmdBuf = nullptr;
     auto gpuContextMgr      = m_osContext->GetGpuContextMgr();
     MOS_OS_CHK_NULL_RETURN(gpuContextMgr);
 
@@ -106,46 +109,50 @@ MOS_STATUS CmdBufMgrNext::Reset()
 
     MosUtilities::MosLockMutex(m_inUsePoolMutex);
 
-    if (!m_inUseCmdBufPool.empty())
+    for (auto& cmdBuf : m_inUseCmdBufPool)
     {
-        for (auto& cmdBuf : m_inUseCmdBufPool)
-        {
-            UpperInsert(cmdBuf);
-        }
+        UpperInsert(cmdBuf);
     }
 
     // clear in-use command buffer pool
     m_inUseCmdBufPool.clear();
     MosUtilities::MosUnlockMutex(m_inUsePoolMutex);
 
-    for (auto& cmdBuf : m_availableCmdBufPool)
+    for (auto &pool : m_availableCmdBufPool)
     {
-        if (cmdBuf != nullptr)
+        for (auto &cmdBuf : pool)
         {
-            auto nativeGpuContext         = cmdBuf->GetLastNativeGpuContext();
-            auto nativeGpuContextHandle   = cmdBuf->GetLastNativeGpuContextHandle();
-            if (nativeGpuContext != nullptr && nativeGpuContext == gpuContextMgr->GetGpuContext(nativeGpuContextHandle))
+            if (cmdBuf != nullptr)
             {
-                cmdBuf->UnBindToGpuContext(true);
-                nativeGpuContext->ResetCmdBuffer();
-            }
-            cmdBuf->ResetLastNativeGpuContext();
+                auto nativeGpuContext         = cmdBuf->GetLastNativeGpuContext();
+                auto nativeGpuContextHandle   = cmdBuf->GetLastNativeGpuContextHandle();
+                if (nativeGpuContext != nullptr && nativeGpuContext == gpuContextMgr->GetGpuContext(nativeGpuContextHandle))
+                {
+                    cmdBuf->UnBindToGpuContext(true);
+                    nativeGpuContext->ResetCmdBuffer();
+                }
+                cmdBuf->ResetLastNativeGpuContext();
 
-            auto gpuContext         = cmdBuf->GetGpuContext();
-            auto gpuContextHandle   = cmdBuf->GetGpuContextHandle();
-            if (gpuContext != nullptr && gpuContext == gpuContextMgr->GetGpuContext(gpuContextHandle))
+                auto gpuContext         = cmdBuf->GetGpuContext();
+                auto gpuContextHandle   = cmdBuf->GetGpuContextHandle();
+                if (gpuContext != nullptr && gpuContext == gpuContextMgr->GetGpuContext(gpuContextHandle))
+                {
+                    cmdBuf->UnBindToGpuContext(false);
+                    gpuContext->ResetCmdBuffer();
+                }
+                cmdBuf->ResetGpuContext();
+            }
+            else
             {
-                cmdBuf->UnBindToGpuContext(false);
-                gpuContext->ResetCmdBuffer();
+                MOS_OS_ASSERTMESSAGE("Unexpected, found null command buffer!");
             }
-            cmdBuf->ResetGpuContext();
-        }
-        else
-        {
-            MOS_OS_ASSERTMESSAGE("Unexpected, found null command buffer!");
         }
     }
-    m_cmdBufTotalNum = m_availableCmdBufPool.size();
+
+    // high-water marks belong to the previous contexts
+    MosUtilities::MosZeroMemory(m_highWaterSize, sizeof(m_highWaterSize));
+
+    m_cmdBufTotalNum = m_availableCmdBufNum;
     MosUtilities::MosUnlockMutex(m_availablePoolMutex);
     return MOS_STATUS_SUCCESS;
 }
@@ -154,43 +161,43 @@ void CmdBufMgrNext::CleanUp()
 {
     MOS_OS_FUNCTION_ENTER;
 
-    CommandBufferNext *cmdBuf = nullptr;
     MosUtilities::MosLockMutex(m_availablePoolMutex);
 
-    for (auto& cmdBuf : m_availableCmdBufPool)
+    for (auto &pool : m_availableCmdBufPool)
     {
-        if (cmdBuf != nullptr)
+        for (auto &cmdBuf : pool)
         {
-            auto gpuContext         = cmdBuf->GetLastNativeGpuContext();
-            auto gpuContextHandle   = cmdBuf->GetLastNativeGpuContextHandle();
-            auto gpuContextMgr      = m_osContext->GetGpuContextMgr();
-            if (gpuContext != nullptr && gpuContextMgr && gpuContext == gpuContextMgr->GetGpuContext(gpuContextHandle))
+            if (cmdBuf != nullptr)
+            {
+                auto gpuContext         = cmdBuf->GetLastNativeGpuContext();
+                auto gpuContextHandle   = cmdBuf->GetLastNativeGpuContextHandle();
+                auto gpuContextMgr      = m_osContext->GetGpuContextMgr();
+                if (gpuContext != nullptr && gpuContextMgr && gpuContext == gpuContextMgr->GetGpuContext(gpuContextHandle))
+                {
+                    cmdBuf->UnBindToGpuContext(true);
+                }
+                cmdBuf->Free();
+                MOS_Delete(cmdBuf);
+            }
+            else
             {
-                cmdBuf->UnBindToGpuContext(true);
+                MOS_OS_ASSERTMESSAGE("Unexpected, found null command buffer!");
             }
-            cmdBuf->Free();
-            MOS_Delete(cmdBuf);
-        }
-        else
-        {
-            MOS_OS_ASSERTMESSAGE("Unexpected, found null command buffer!");
         }
-    }
 
-    // clear available command buffer pool
-    m_availableCmdBufPool.clear();
+        // clear available command buffer pool
+        pool.clear();
+    }
+    m_availableCmdBufNum = 0;
     MosUtilities::MosUnlockMutex(m_availablePoolMutex);
     MosUtilities::MosLockMutex(m_inUsePoolMutex);
 
-    if (!m_inUseCmdBufPool.empty())
+    for (auto& cmdBuf : m_inUseCmdBufPool)
     {
-        for (auto& cmdBuf : m_inUseCmdBufPool)
+        if (cmdBuf != nullptr)
         {
-            if (cmdBuf != nullptr)
-            {
-                cmdBuf->Free();
-                MOS_Delete(cmdBuf);
-            }
+            cmdBuf->Free();
+            MOS_Delete(cmdBuf);
         }
     }
 
@@ -198,6 +205,7 @@ void CmdBufMgrNext::CleanUp()
     m_inUseCmdBufPool.clear();
     MosUtilities::MosUnlockMutex(m_inUsePoolMutex);
 
+    MosUtilities::MosZeroMemory(m_highWaterSize, sizeof(m_highWaterSize));
     m_cmdBufTotalNum = 0;
     m_initialized    = false;
     MosUtilities::MosDestroyMutex(m_inUsePoolMutex);
@@ -206,7 +214,7 @@ void CmdBufMgrNext::CleanUp()
     m_availablePoolMutex = nullptr;
 }
 
-CommandBufferNext *CmdBufMgrNext::PickupOneCmdBuf(uint32_t size)
+CommandBufferNext *CmdBufMgrNext::PickupOneCmdBuf(uint32_t size, MOS_GPU_NODE node)
 {
     MOS_OS_FUNCTION_ENTER;
 
@@ -224,52 +232,87 @@ CommandBufferNext *CmdBufMgrNext::PickupOneCmdBuf(uint32_t size)
     CommandBufferNext* retbuf  = nullptr;
     MOS_STATUS     eStatus = MOS_STATUS_SUCCESS;
 
-    if (!m_availableCmdBufPool.empty())
+    // new buffers are sized to the largest request seen from this node, so that
+    // steady-state frames of the same client never need to resize
+    uint32_t &highWaterSize = GetHighWaterSize(node);
+    highWaterSize           = MOS_MAX(highWaterSize, size);
+    uint32_t allocSize      = highWaterSize;
+
+    if (m_availableCmdBufNum != 0)
     {
-        cmdBuf = *(m_availableCmdBufPool.begin());
-        if (cmdBuf == nullptr)
+        // oldest released buffer of each size class is checked first, its
+        // completion fence is the most likely one to have signaled already
+        uint32_t busyProbeNum = 0;
+        for (uint32_t sizeClass = GetSizeClass(size);
+             sizeClass < m_sizeClassNum && retbuf == nullptr && busyProbeNum < m_maxBusyProbeNum;
+             sizeClass++)
         {
-            MOS_OS_ASSERTMESSAGE("available command buf pool is null.");
-            MosUtilities::MosUnlockMutex(m_inUsePoolMutex);
-            MosUtilities::MosUnlockMutex(m_availablePoolMutex);
-            return nullptr;
-        }
+            auto &pool = m_availableCmdBufPool[sizeClass];
+            for (auto iter = pool.begin(); iter != pool.end() && busyProbeNum < m_maxBusyProbeNum; iter++)
+            {
+                cmdBuf = *iter;
+                if (cmdBuf == nullptr)
+                {
+                    MOS_OS_ASSERTMESSAGE("available command buf pool is null.");
+                    MosUtilities::MosUnlockMutex(m_inUsePoolMutex);
+                    MosUtilities::MosUnlockMutex(m_availablePoolMutex);
+                    return nullptr;
+                }
 
-        // find available buf
-        if (size <= cmdBuf->GetCmdBufSize() && !cmdBuf->IsUsedByHw() && !cmdBuf->IsInCmdList())
-        {
-            m_inUseCmdBufPool.push_back(cmdBuf);
+                if (size > cmdBuf->GetCmdBufSize())
+                {
+                    continue;
+                }
 
-            m_availableCmdBufPool.erase(m_availableCmdBufPool.begin());
+                busyProbeNum++;
+                if (!cmdBuf->IsUsedByHw() && !cmdBuf->IsInCmdList())
+                {
+                    pool.erase(iter);
+                    m_availableCmdBufNum--;
+                    m_inUseCmdBufPool.insert(cmdBuf);
+                    retbuf = cmdBuf;
 
-            MOS_OS_VERBOSEMESSAGE("successfully get available buf from pool");
+                    MOS_OS_VERBOSEMESSAGE("successfully get available buf from pool");
+                    break;
+                }
+            }
         }
-        // available buf  is not large enough, need reallocate
-        else
+
+        // available buf is not large enough or still used by HW, need reallocate
+        if (retbuf == nullptr)
         {
             MOS_OS_VERBOSEMESSAGE("find available buf, but is not large enough or it is still used by HW");
 
-            cmdBuf = CommandBufferNext::CreateCmdBuf(this);
-            if (cmdBuf == nullptr)
+            if (m_cmdBufTotalNum < m_maxPoolSize)
             {
-                MOS_OS_ASSERTMESSAGE("input nullptr returned by CommandBuffer::CreateCmdBuf.");
+                cmdBuf = CommandBufferNext::CreateCmdBuf(this);
+                if (cmdBuf == nullptr)
+                {
+                    MOS_OS_ASSERTMESSAGE("input nullptr returned by CommandBuffer::CreateCmdBuf.");
+                }
+                else
+                {
+                    eStatus = cmdBuf->Allocate(m_osContext, allocSize);
+                    if (eStatus != MOS_STATUS_SUCCESS)
+                    {
+                        MOS_OS_ASSERTMESSAGE("Allocate CmdBuf failed");
+                        cmdBuf->Free();
+                        MOS_Delete(cmdBuf);
+                    }
+                    else
+                    {
+                        // directly push into inuse pool
+                        m_inUseCmdBufPool.insert(cmdBuf);
+                        m_cmdBufTotalNum++;
+                        retbuf = cmdBuf;
+                    }
+                }
             }
             else
             {
-                eStatus = cmdBuf->Allocate(m_osContext, size);
-                if (eStatus != MOS_STATUS_SUCCESS)
-                {
-                    MOS_OS_ASSERTMESSAGE("Allocate CmdBuf failed");
-                }
-
-                // directly push into inuse pool
-                m_inUseCmdBufPool.push_back(cmdBuf);
-                m_cmdBufTotalNum++;
-
+                MOS_OS_ASSERTMESSAGE("No idle cmd buf in pool and the total buf num hit the ceiling, may need wait for a while.");
             }
         }
-
-        retbuf = cmdBuf;
     }
     // no available buf in the pool, will allocate in batch
     else
@@ -288,7 +331,7 @@ CommandBufferNext *CmdBufMgrNext::PickupOneCmdBuf(uint32_t size)
                     continue;
                 }
 
-                eStatus = cmdBuf->Allocate(m_osContext, size);
+                eStatus = cmdBuf->Allocate(m_osContext, allocSize);
                 if (eStatus != MOS_STATUS_SUCCESS)
                 {
                     MOS_OS_ASSERTMESSAGE("Allocate CmdBuf#%d failed", i);
@@ -297,21 +340,18 @@ CommandBufferNext *CmdBufMgrNext::PickupOneCmdBuf(uint32_t size)
                     continue;
                 }
 
-                if (i == 0)
+                if (retbuf == nullptr)
                 {
                     // directly push into inuse pool
-                    m_inUseCmdBufPool.push_back(cmdBuf);
+                    m_inUseCmdBufPool.insert(cmdBuf);
                     retbuf = cmdBuf;
                 }
                 else
                 {
-                    m_availableCmdBufPool.insert(m_availableCmdBufPool.begin(), cmdBuf);
+                    UpperInsert(cmdBuf);
                 }
                 m_cmdBufTotalNum++;
             }
-
-            // sort by decent order
-            std::sort(m_availableCmdBufPool.begin(), m_availableCmdBufPool.end(), &CmdBufMgrNext::GreaterSizeSort);
         }
         else
         {
@@ -329,8 +369,8 @@ CommandBufferNext *CmdBufMgrNext::PickupOneCmdBuf(uint32_t size)
 
 void CmdBufMgrNext::UpperInsert(CommandBufferNext *cmdBuf)
 {
-    auto it = std::find_if(m_availableCmdBufPool.begin(), m_availableCmdBufPool.end(), [=](CommandBufferNext * p1){return p1->GetCmdBufSize() < cmdBuf->GetCmdBufSize();});
-    m_availableCmdBufPool.emplace(it, cmdBuf);
+    m_availableCmdBufPool[GetSizeClass(cmdBuf->GetCmdBufSize())].push_back(cmdBuf);
+    m_availableCmdBufNum++;
 }
 
 MOS_STATUS CmdBufMgrNext::ReleaseCmdBuf(CommandBufferNext *cmdBuf)
@@ -351,18 +391,7 @@ MOS_STATUS CmdBufMgrNext::ReleaseCmdBuf(CommandBufferNext *cmdBuf)
     MosUtilities::MosLockMutex(m_inUsePoolMutex);
     MosUtilities::MosLockMutex(m_availablePoolMutex);
 
-    bool           found = false;
-    for (auto iter = m_inUseCmdBufPool.begin(); iter != m_inUseCmdBufPool.end(); iter++)
-    {
-        if (cmdBuf == *iter)
-        {
-            found = true;
-            m_inUseCmdBufPool.erase(iter);
-            break;
-        }
-    }
-
-    if (!found)
+    if (m_inUseCmdBufPool.erase(cmdBuf) == 0)
     {
         MOS_OS_ASSERTMESSAGE("Cannot find the specified cmdbuf in inusepool, sth must be wrong!");
         eStatus = MOS_STATUS_UNKNOWN;
@@ -391,11 +420,32 @@ MOS_STATUS CmdBufMgrNext::ResizeOneCmdBuf(CommandBufferNext *cmdBufToResize, uin
         return MOS_STATUS_UNKNOWN;
     }
 
+    // remember the new size so that next buffer of this client is big enough
+    auto gpuContext = cmdBufToResize->GetGpuContext();
+    MosUtilities::MosLockMutex(m_availablePoolMutex);
+    uint32_t &highWaterSize = GetHighWaterSize(gpuContext ? gpuContext->GetContextNode() : MOS_GPU_NODE_MAX);
+    highWaterSize           = MOS_MAX(highWaterSize, newSize);
+    MosUtilities::MosUnlockMutex(m_availablePoolMutex);
+
     return cmdBufToResize->ReSize(newSize);
 }
 
+uint32_t CmdBufMgrNext::GetSizeClass(uint32_t size)
+{
+    uint32_t sizeClass = 0;
+    while (sizeClass < m_sizeClassNum - 1 && (size >> 1) >= (m_minSizeClass << sizeClass))
+    {
+        sizeClass++;
+    }
+    return sizeClass;
+}
 
-bool CmdBufMgrNext::GreaterSizeSort(CommandBufferNext *a, CommandBufferNext *b)
+uint32_t &CmdBufMgrNext::GetHighWaterSize(MOS_GPU_NODE node)
 {
-    return (a->GetCmdBufSize() > b->GetCmdBufSize());
-}
\ No newline at end of file
+    uint32_t slot = (uint32_t)node;
+    if (slot > MOS_GPU_NODE_MAX)
+    {
+        slot = MOS_GPU_NODE_MAX;
+    }
+    return m_highWaterSize[slot];
+}
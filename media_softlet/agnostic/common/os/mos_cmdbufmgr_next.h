@@ -27,6 +27,8 @@
 #ifndef __COMMAND_BUFFER_MANAGER_NEXT_H__
 #define __COMMAND_BUFFER_MANAGER_NEXT_H__
 
+#include <deque>
+#include <unordered_set>
 #include "mos_commandbuffer_next.h"
 #include "mos_gpucontextmgr_next.h"
 
@@ -73,29 +75,34 @@ public:
     void CleanUp();
 
     //!
-    //! \brief    Clean up the command buffer manager
-    //! \details  This function will pick up one proper command buffer from 
-    //!           available pool, internal logic in below 3 conditions:
-    //!           1: if available pool has command buffer and its size bigger than
-    //!              required, directly put it into in use pool and return;
-    //!           2: if available pool has command buffer but size smaller than
-    //!              required, only create one command buffer as reqired and put
-    //!              it to in  use pool directly;
+    //! \brief    Pick up one command buffer from the pool
+    //! \details  Available command buffers are segregated by size class and
+    //!           kept in release order, so the oldest released buffer, the one
+    //!           whose GPU work is most likely retired, is checked first:
+    //!           1: scan the size class of the required size and the classes
+    //!              above it for an idle buffer big enough, checking at most
+    //!              m_maxBusyProbeNum buffers against their fence;
+    //!           2: if no idle buffer is found, create one command buffer sized
+    //!              to the high-water mark of the requesting node and put it to
+    //!              in use pool directly;
     //!           3: if available pool is empty, will re-allocate bunch of command
-    //!              buffers, buffer number base on m_initBufNum, buffer size
-    //!              base on input required size. After re-allocate, put first buf
-    //!              into inuse pool, remains push to available pool.
+    //!              buffers, buffer number base on m_bufIncStepSize. After
+    //!              re-allocate, put first buf into inuse pool, remains push to
+    //!              available pool.
     //! \param    [in] size
     //!           Required command buffer size
+    //! \param    [in] node
+    //!           GPU node of the requesting context, used to track the per
+    //!           client high-water mark of command buffer size
     //! \return   CommandBuffer*
     //!           Proper comamnd bufffer pointer if success, other wise nullptr
     //!
-    CommandBufferNext *PickupOneCmdBuf(uint32_t size);
+    CommandBufferNext *PickupOneCmdBuf(uint32_t size, MOS_GPU_NODE node = MOS_GPU_NODE_MAX);
 
     //!
     //! \brief    insert the command buffer into available pool in proper location.
-    //! \details  This function will find a the first cmd buffer which equal or  
-    //!           small cmd buf size in available pool, and then insert it.
+    //! \details  This function will append the cmd buffer to the tail of the
+    //!           size class matching its size in available pool.
     //! \param    [in] cmdBuf
     //!           command buffer to be released
     //!
@@ -169,16 +176,24 @@ public:
 
  protected:
     //!
-    //! \brief    Self define compare method as std:sort input 
-    //! \detail   Command buffer size will be compared 
-    //! \param    [in] a
-    //!           Input command buffer to be compared
-    //! \param    [in] b
-    //!           Input command buffer to be compared
-    //! \return   bool
-    //!           true if a size bigger than b, otherwise false
+    //! \brief    Get the size class of command buffer size
+    //! \detail   Size class N holds buffers in [m_minSizeClass << N, m_minSizeClass << (N + 1)),
+    //!           the last size class holds all buffers bigger than that
+    //! \param    [in] size
+    //!           Command buffer size
+    //! \return   uint32_t
+    //!           Size class index
+    //!
+    static uint32_t GetSizeClass(uint32_t size);
+
+    //!
+    //! \brief    Get the high-water mark slot of gpu node
+    //! \param    [in] node
+    //!           Gpu node of the requesting context
+    //! \return   uint32_t &
+    //!           High-water mark of command buffer size for the node
     //!
-    static bool GreaterSizeSort(CommandBufferNext *a, CommandBufferNext *b);
+    uint32_t &GetHighWaterSize(MOS_GPU_NODE node);
 
     //! \brief   Max comamnd buffer number for per manager, including all
     //!          command buffer in availble pool and in-use pool
@@ -193,18 +208,34 @@ public:
     //! \brief   Initial command buffer number
     constexpr static uint32_t m_initBufNum = 32;
 
-    //! \brief   Sorted List of available command buffer pool
-    std::vector<CommandBufferNext *> m_availableCmdBufPool;
+    //! \brief   Size of the smallest size class
+    constexpr static uint32_t m_minSizeClass = 4096;
+
+    //! \brief   Number of size classes in available pool
+    constexpr static uint32_t m_sizeClassNum = 16;
+
+    //! \brief   Max number of fence queries for one pick up
+    constexpr static uint32_t m_maxBusyProbeNum = 8;
+
+    //! \brief   Available command buffer pool per size class, in release order
+    std::deque<CommandBufferNext *> m_availableCmdBufPool[m_sizeClassNum];
+
+    //! \brief   Current command buffer number in available pool
+    uint32_t m_availableCmdBufNum = 0;
 
     //! \brief   Mutex for available command buffer pool
     PMOS_MUTEX m_availablePoolMutex = nullptr;
 
-    //! \brief   List of in used command buffer pool
-    std::vector<CommandBufferNext *> m_inUseCmdBufPool;
+    //! \brief   Set of in used command buffer pool
+    std::unordered_set<CommandBufferNext *> m_inUseCmdBufPool;
 
     //! \brief   Mutex for in-use command buffer pool
     PMOS_MUTEX m_inUsePoolMutex = nullptr;
 
+    //! \brief   High-water mark of required command buffer size per gpu node,
+    //!          the last slot is for requests without node
+    uint32_t m_highWaterSize[MOS_GPU_NODE_MAX + 1] = {};
+
     //! \brief   Flag to indicate cmd buf mgr initialized or not
     bool m_initialized = false;
 
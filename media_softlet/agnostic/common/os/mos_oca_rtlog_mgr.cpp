@@ -83,8 +83,10 @@ MOS_STATUS MosOcaRtLogSectionMgr::InsertData(MOS_OCA_RTLOG_HEADER header, const
         {
             return MOS_STATUS_NO_SPACE;
         }
-        int32_t heapHandle = AllocHeapHandle()%m_EntryCount;
-        if (heapHandle < m_EntryCount)
+        // The handle keeps counting for the lifetime of the process, take it as unsigned so the
+        // ring index stays in range once the counter wraps past INT32_MAX.
+        int32_t heapHandle = (int32_t)((uint32_t)AllocHeapHandle() % (uint32_t)m_EntryCount);
+        if (heapHandle >= 0 && heapHandle < m_EntryCount)
         {
             uint8_t *copyAddr = (uint8_t *)m_LockedHeap + m_Offset + heapHandle * MOS_OCA_RTLOG_ENTRY_SIZE;
             MOS_OS_CHK_STATUS_RETURN(MOS_SecureMemcpy(copyAddr, sizeof(MOS_OCA_RTLOG_HEADER), &header, sizeof(MOS_OCA_RTLOG_HEADER)));
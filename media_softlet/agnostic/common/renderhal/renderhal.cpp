@@ -2254,6 +2254,13 @@ int32_t RenderHal_LoadKernel(
         uint32_t dwOldest = 0;
         uint32_t dwLastUsed;
 
+        // Update sync tags first, otherwise kernels already retired by the GPU
+        // are still treated as in use and cannot be selected for eviction
+        if (pRenderHal->pfnRefreshSync(pRenderHal) != MOS_STATUS_SUCCESS)
+        {
+            MHW_RENDERHAL_NORMALMESSAGE("Failed to refresh sync tags before kernel eviction.");
+        }
+
         // Search and deallocate least used kernel
         pKernelAllocation = pStateHeap->pKernelAllocation;
         for (iKernelAllocationID = 0;
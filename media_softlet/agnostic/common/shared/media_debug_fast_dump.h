@@ -73,6 +73,8 @@ public:
         size_t samplingTime     = 0;                  // sampling time in ms
         size_t samplingInterval = 0;                  // sampling interval in ms
                                                       // when both sampling time and interval are positive, sampling mode is enabled
+        RangedValue<1, 16> dumpThreads = 4;           // max number of dumps written concurrently, 1 - 16,
+                                                      // always 1 when write2Trace is true
     };
 
 public:
@@ -72,6 +72,14 @@ public:
             maxPercentLocalMem  = cfg->maxPercentLocalMem;
             m_samplingTime      = MS(cfg->samplingTime);
             m_samplingInterval  = MS(cfg->samplingInterval);
+            m_maxDumpThreads    = cfg->dumpThreads;
+        }
+
+        // trace data dump chunks carry no dump id, concurrent dumps would interleave
+        // in the trace, so dump one at a time when writing to trace
+        if (write2Trace)
+        {
+            m_maxDumpThreads = 1;
         }
 
         // configure sampling mode
@@ -224,7 +232,7 @@ public:
 
             if (m_scheduler->joinable())
             {
-                m_cond.notify_one();
+                m_cond.notify_all();
                 m_scheduler->join();
             }
         }
@@ -329,7 +337,7 @@ public:
             m_resQueue.emplace(*resIt);
         }
 
-        m_cond.notify_one();
+        m_cond.notify_all();
     }
 
 protected:
@@ -386,7 +394,7 @@ protected:
 protected:
     void ScheduleTasks()
     {
-        std::future<void> future;
+        std::vector<std::future<void>> futures;
 
         while (true)
         {
@@ -394,7 +402,7 @@ protected:
             m_cond.wait(
                 lk,
                 [this] {
-                    return (m_ready4Dump && !m_resQueue.empty()) || m_stopScheduler;
+                    return (m_dumpsInFlight < m_maxDumpThreads && !m_resQueue.empty()) || m_stopScheduler;
                 });
 
             if (m_stopScheduler)
@@ -402,28 +410,34 @@ protected:
                 break;
             }
 
-            if (m_ready4Dump && !m_resQueue.empty())
-            {
-                auto qf      = m_resQueue.front();
-                m_ready4Dump = false;
-                lk.unlock();
-
-                future = std::async(
-                    std::launch::async,
-                    [this, qf] {
-                        DoDump(qf);
-                        {
-                            std::lock_guard<std::mutex> lk(m_mutex);
-                            m_resQueue.front()->occupied = false;
-                            m_resQueue.pop();
-                            m_ready4Dump = true;
-                        }
-                        m_cond.notify_all();
-                    });
-            }
+            auto qf = m_resQueue.front();
+            m_resQueue.pop();
+            ++m_dumpsInFlight;
+            lk.unlock();
+
+            futures.erase(
+                std::remove_if(
+                    futures.begin(),
+                    futures.end(),
+                    [](const std::future<void> &f) {
+                        return f.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+                    }),
+                futures.end());
+
+            futures.emplace_back(std::async(
+                std::launch::async,
+                [this, qf] {
+                    DoDump(qf);
+                    {
+                        std::lock_guard<std::mutex> lk(m_mutex);
+                        qf->occupied = false;
+                        --m_dumpsInFlight;
+                    }
+                    m_cond.notify_all();
+                }));
         }
 
-        if (future.valid())
+        for (auto &future : futures)
         {
             future.wait();
         }
@@ -465,6 +479,7 @@ protected:
     MemMng m_memMng2nd;
     MS     m_samplingTime{0};
     MS     m_samplingInterval{0};
+    size_t m_maxDumpThreads = 4;
 
     const std::chrono::time_point<Clock>
         m_startTP = Clock::now();
@@ -500,8 +515,8 @@ protected:
         m_writeError;
 
     // threads intercommunication flags, synchronization needed
-    bool m_ready4Dump    = true;
-    bool m_stopScheduler = false;
+    size_t m_dumpsInFlight = 0;
+    bool   m_stopScheduler = false;
 
     std::mutex              m_mutex;
     std::condition_variable m_cond;
@@ -309,6 +309,15 @@ MOS_STATUS MediaPerfProfiler::Initialize(void* context, MOS_INTERFACE *osInterfa
         osInterface->pOsContext);
     m_multiprocess = userFeatureData.u32Data;
 
+    // Read ring buffer mode
+    MOS_ZeroMemory(&userFeatureData, sizeof(userFeatureData));
+    MOS_UserFeature_ReadValue_ID(
+        nullptr,
+        __MEDIA_USER_FEATURE_VALUE_PERF_PROFILER_RING_BUFFER,
+        &userFeatureData,
+        osInterface->pOsContext);
+    m_ringBuffer = userFeatureData.bData ? true : false;
+
     // Read memory information register address
     int8_t regIndex = 0;
     for (regIndex = 0; regIndex < 8; regIndex++)
@@ -497,6 +506,18 @@ MOS_STATUS MediaPerfProfiler::AddPerfCollectStartCmd(
 
     perfDataIndex = m_perfDataIndexMap[pOsContext];
     m_perfDataIndexMap[pOsContext]++;
+
+    if (BASE_OF_NODE(perfDataIndex) + sizeof(PerfEntry) > m_bufferSize)
+    {
+        if (!m_ringBuffer || MaxPerfDataNodes() == 0)
+        {
+            MosUtilities::MosUnlockMutex(m_mutex);
+            MOS_OS_ASSERTMESSAGE("Reached maximum perf data buffer size, please increase it in Performance\\Perf Profiler Buffer Size");
+            return MOS_STATUS_NOT_ENOUGH_BUFFER;
+        }
+        perfDataIndex %= MaxPerfDataNodes();
+    }
+
     m_contextIndexMap[context] = perfDataIndex;
 
     MosUtilities::MosUnlockMutex(m_mutex);
@@ -671,6 +692,9 @@ MOS_STATUS MediaPerfProfiler::SavePerfData(MOS_INTERFACE *osInterface)
 
     if (m_perfDataIndexMap[pOsContext] > 0)
     {
+        // Never dump past the end of the buffer, the index keeps counting once it is full
+        uint32_t nodeCount = MOS_MIN(m_perfDataIndexMap[pOsContext], MaxPerfDataNodes());
+
         MOS_LOCK_PARAMS     LockFlagsNoOverWrite;
         MOS_ZeroMemory(&LockFlagsNoOverWrite, sizeof(MOS_LOCK_PARAMS));
 
@@ -694,11 +718,11 @@ MOS_STATUS MediaPerfProfiler::SavePerfData(MOS_INTERFACE *osInterface)
             MOS_SecureStringPrint(outputFileName, MOS_MAX_PATH_LENGTH + 1, MOS_MAX_PATH_LENGTH + 1, "%s-pid%d-context%p-%04d%02d%02d%02d%02d%02d.bin",
                 m_outputFileName, pid, pOsContext, localtime.tm_year + 1900, localtime.tm_mon + 1, localtime.tm_mday, localtime.tm_hour, localtime.tm_min, localtime.tm_sec);
 
-            MosUtilities::MosWriteFileFromPtr(outputFileName, pData, BASE_OF_NODE(m_perfDataIndexMap[pOsContext]));
+            MosUtilities::MosWriteFileFromPtr(outputFileName, pData, BASE_OF_NODE(nodeCount));
         }
         else
         {
-            MosUtilities::MosWriteFileFromPtr(m_outputFileName, pData, BASE_OF_NODE(m_perfDataIndexMap[pOsContext]));
+            MosUtilities::MosWriteFileFromPtr(m_outputFileName, pData, BASE_OF_NODE(nodeCount));
         }
 
         osInterface->pfnUnlockResource(
@@ -785,4 +809,14 @@ bool MediaPerfProfiler::IsPerfModeWidthMemInfo(uint32_t *regs)
     }
 
     return ret;
+}
+
+uint32_t MediaPerfProfiler::MaxPerfDataNodes()
+{
+    if (m_bufferSize < sizeof(NodeHeader))
+    {
+        return 0;
+    }
+
+    return (m_bufferSize - sizeof(NodeHeader)) / sizeof(PerfEntry);
 }
\ No newline at end of file
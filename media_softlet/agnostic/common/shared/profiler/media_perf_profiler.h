@@ -271,6 +271,14 @@ public:
     //!
     bool IsPerfModeWidthMemInfo(uint32_t *regs);
 
+    //!
+    //! \brief    Get the number of perf data nodes the buffer can hold
+    //!
+    //! \return   uint32_t
+    //!           node capacity of the perf data buffer
+    //!
+    uint32_t MaxPerfDataNodes();
+
     //!
     //! \brief    Map the platform ID
     //!
@@ -514,6 +522,7 @@ public:
     uint32_t                      m_bufferSize = 10000000; //!< The size of perf data buffer
     uint32_t                      m_timerBase  = 0;        //!< time frequency
     int32_t                       m_multiprocess = 0;      //!< multi process support
+    bool                          m_ringBuffer = false;    //!< overwrite the oldest nodes when the buffer is full
     uint32_t                      m_registers[8] = { 0 };  //!< registers of Memory information
     int32_t                       m_profilerEnabled;       //!< UMD Perf Profiler enable or not
     char                          m_outputFileName[MOS_MAX_PATH_LENGTH + 1];  //!< Name of output file
@@ -28,6 +28,8 @@
 #include <algorithm>
 #include "media_status_report.h"
 
+thread_local uint32_t MediaStatusReport::m_parsingIndex = 0;
+
 MOS_STATUS MediaStatusReport::GetAddress(uint32_t statusReportType, PMOS_RESOURCE &osResource, uint32_t &offset)
 {
     MOS_STATUS eStatus = MOS_STATUS_SUCCESS;
@@ -54,87 +56,115 @@ MOS_STATUS MediaStatusReport::GetReport(uint16_t requireNum, void *status)
 {
     MOS_STATUS eStatus = MOS_STATUS_SUCCESS;
 
-    uint32_t completedCount = *m_completedCount;
-    uint32_t reportedCount = m_reportedCount;
-    uint32_t reportedCountOrigin = m_reportedCount;
-    uint32_t availableCount = m_submittedCount - reportedCount;
-    uint32_t generatedReportCount = 0;
-    uint32_t reportIndex = 0;
-    bool reverseOrder = (requireNum > 1);
-
-    while (reportedCount != completedCount && generatedReportCount < requireNum){
-
-        // Get reverse order index to temporally fix application get status report size bigger than 2 case.
-        reportIndex = reverseOrder ? CounterToIndex(completedCount + reportedCountOrigin - reportedCount -1) :
-                                     CounterToIndex(reportedCount);
-        // m_reportedCount is used by component. Need to assign actual index before call ParseStatus
-        m_reportedCount = reportIndex;
-        eStatus = ParseStatus(((uint8_t*)status + m_sizeOfReport * generatedReportCount), reportIndex);
-
-        reportedCount++;
-        generatedReportCount++;
-    }
-    if (generatedReportCount < requireNum)
+    // Snapshot the completed count once, then claim the range [reportedCount, nextReportedCount)
+    // so that concurrent callers never parse the same entry twice.
+    // Get reverse order to temporally fix application get status report size bigger than 2 case:
+    // the latest completed reports are returned, so the claim always reaches completedCount and
+    // the older entries left in the range are not reported any more.
+    uint32_t completedCount    = GetCompletedCount();
+    uint32_t reportedCount     = m_reportedCount.load(std::memory_order_acquire);
+    uint32_t nextReportedCount = reportedCount;
+    uint32_t claimedCount      = 0;
+    bool     reverseOrder      = (requireNum > 1);
+    do
     {
-        for (auto i = generatedReportCount; i < requireNum; i++)
+        // Another caller may have claimed beyond the completed count snapshot of this one
+        if ((int32_t)(completedCount - reportedCount) <= 0)
         {
-            eStatus = SetStatus(((uint8_t *)status + m_sizeOfReport * i),
-                                CounterToIndex(reportedCount),
-                                i >= availableCount);
+            claimedCount      = 0;
+            nextReportedCount = reportedCount;
+            break;
         }
+        claimedCount      = std::min<uint32_t>(completedCount - reportedCount, requireNum);
+        nextReportedCount = reverseOrder ? completedCount : reportedCount + claimedCount;
+    } while (!m_reportedCount.compare_exchange_weak(
+        reportedCount, nextReportedCount, std::memory_order_acq_rel, std::memory_order_acquire));
+
+    uint32_t availableCount = GetSubmittedCount() - reportedCount;
+
+    if (claimedCount > 0)
+    {
+        eStatus = ParseStatusBatch(status, nextReportedCount - claimedCount, claimedCount, reverseOrder);
     }
 
-    m_reportedCount = reportedCount;
+    for (uint32_t i = claimedCount; i < requireNum; i++)
+    {
+        eStatus = SetStatus(((uint8_t *)status + m_sizeOfReport * i),
+                            CounterToIndex(nextReportedCount),
+                            i >= availableCount);
+    }
 
     return eStatus;
 }
 
-MOS_STATUS MediaStatusReport::RegistObserver(MediaStatusReportObserver *observer)
+MOS_STATUS MediaStatusReport::ParseStatusBatch(
+    void     *report,
+    uint32_t  startCount,
+    uint32_t  count,
+    bool      reverseOrder)
 {
     MOS_STATUS eStatus = MOS_STATUS_SUCCESS;
-    std::vector<MediaStatusReportObserver *>::iterator it;
 
-    it = std::find(m_completeObservers.begin(), m_completeObservers.end(), observer);
-    if (it != m_completeObservers.end())
+    for (uint32_t i = 0; i < count; i++)
+    {
+        // In reverse order the range ends at the completed count, report the latest one first
+        uint32_t reportIndex = reverseOrder ? CounterToIndex(startCount + count - i - 1) :
+                                              CounterToIndex(startCount + i);
+        // m_parsingIndex is used by component. Need to assign actual index before call ParseStatus
+        m_parsingIndex = reportIndex;
+        eStatus = ParseStatus(((uint8_t *)report + m_sizeOfReport * i), reportIndex);
+    }
+
+    return eStatus;
+}
+
+MOS_STATUS MediaStatusReport::RegistObserver(MediaStatusReportObserver *observer)
+{
+    std::lock_guard<std::mutex> lock(m_observerMutex);
+
+    std::shared_ptr<const ObserverList> observers = std::atomic_load(&m_completeObservers);
+    if (std::find(observers->begin(), observers->end(), observer) != observers->end())
     {
         // the observer already in the vector
         return MOS_STATUS_SUCCESS;
     }
 
-    m_completeObservers.push_back(observer);
+    std::shared_ptr<ObserverList> newObservers = std::make_shared<ObserverList>(*observers);
+    newObservers->push_back(observer);
+    std::atomic_store(&m_completeObservers, std::shared_ptr<const ObserverList>(newObservers));
 
-    return eStatus;
+    return MOS_STATUS_SUCCESS;
 }
 
 MOS_STATUS MediaStatusReport::UnregistObserver(MediaStatusReportObserver *observer)
 {
-    MOS_STATUS eStatus = MOS_STATUS_SUCCESS;
-    std::vector<MediaStatusReportObserver *>::iterator it;
+    std::lock_guard<std::mutex> lock(m_observerMutex);
 
-    it = std::find(m_completeObservers.begin(), m_completeObservers.end(), observer);
-    if (it == m_completeObservers.end())
+    std::shared_ptr<const ObserverList> observers = std::atomic_load(&m_completeObservers);
+    ObserverList::const_iterator it = std::find(observers->begin(), observers->end(), observer);
+    if (it == observers->end())
     {
         // the observer not in the vector
         return MOS_STATUS_INVALID_PARAMETER;
     }
 
-    m_completeObservers.erase(it);
+    std::shared_ptr<ObserverList> newObservers = std::make_shared<ObserverList>(*observers);
+    newObservers->erase(newObservers->begin() + (it - observers->begin()));
+    std::atomic_store(&m_completeObservers, std::shared_ptr<const ObserverList>(newObservers));
 
-    return eStatus;
+    return MOS_STATUS_SUCCESS;
 }
 
 MOS_STATUS MediaStatusReport::NotifyObservers(void *mfxStatus, void *rcsStatus, void *statusReport)
 {
     MOS_STATUS eStatus = MOS_STATUS_SUCCESS;
-    std::vector<MediaStatusReportObserver *>::iterator it;
 
-    for (it = m_completeObservers.begin(); it != m_completeObservers.end(); it++)
+    // Iterate a snapshot so that observers can be registered while reports are parsed
+    std::shared_ptr<const ObserverList> observers = std::atomic_load(&m_completeObservers);
+    for (MediaStatusReportObserver *observer : *observers)
     {
-        eStatus = (*it)->Completed(mfxStatus, rcsStatus, statusReport);
+        eStatus = observer->Completed(mfxStatus, rcsStatus, statusReport);
     }
 
     return eStatus;
 }
-
-
-
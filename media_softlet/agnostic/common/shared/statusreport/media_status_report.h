@@ -27,6 +27,10 @@
 #ifndef __MEDIA_STATUS_REPORT_H__
 #define __MEDIA_STATUS_REPORT_H__
 
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
 #include "mos_os_specific.h"
 #include "media_status_report_observer.h"
 
@@ -112,7 +116,7 @@ public:
     //! \brief  Get submitted count of status report.
     //! \return m_submittedCount
     //!
-    uint32_t GetSubmittedCount() const { return m_submittedCount; }
+    uint32_t GetSubmittedCount() const { return m_submittedCount.load(std::memory_order_acquire); }
 
     //!
     //! \brief  Get completed count of status report.
@@ -124,14 +128,23 @@ public:
         {
             return 0;
         } 
-        return (*m_completedCount); 
+        // The completed count is written by GPU, always reload it from memory
+        return *((volatile uint32_t *)m_completedCount);
     }
 
     //!
     //! \brief  Get reported count of status report.
     //! \return m_reportedCount
     //!
-    uint32_t GetReportedCount() const { return m_reportedCount; }
+    uint32_t GetReportedCount() const { return m_reportedCount.load(std::memory_order_acquire); }
+
+    //!
+    //! \brief  Get index of the report which is being parsed.
+    //! \details Valid for observers during the complete event. Kept per thread,
+    //!          so concurrent GetReport callers each see their own entry.
+    //! \return m_parsingIndex
+    //!
+    uint32_t GetParsingIndex() const { return m_parsingIndex; }
 
     uint32_t GetIndex(uint32_t count) { return CounterToIndex(count); }
     //!
@@ -164,6 +177,29 @@ protected:
     //!
     virtual MOS_STATUS ParseStatus(void *report, uint32_t index) = 0;
 
+    //!
+    //! \brief  Collect the status report information of a completed range into report buffer.
+    //! \details The range [startCount, startCount + count) has been claimed by the caller,
+    //!          default implementation parses the entries one by one. In reverse order
+    //!          GetReport passes the latest completed entries, so the range ends at the
+    //!          completed count and the newest report comes first.
+    //! \param  [in] report
+    //!         The report buffer address provided by DDI.
+    //! \param  [in] startCount
+    //!         The counter of the first report in the range.
+    //! \param  [in] count
+    //!         The number of reports in the range.
+    //! \param  [in] reverseOrder
+    //!         Parse the range from its latest report, startCount + count - 1.
+    //! \return MOS_STATUS
+    //!         MOS_STATUS_SUCCESS if success, else fail reason
+    //!
+    virtual MOS_STATUS ParseStatusBatch(
+        void     *report,
+        uint32_t  startCount,
+        uint32_t  count,
+        bool      reverseOrder);
+
     //!
     //! \brief  Set unavailable status report information into report buffer.
     //! \param  [in] report
@@ -192,13 +228,17 @@ protected:
 
     PMOS_RESOURCE    m_completedCountBuf     = nullptr;
     uint32_t         *m_completedCount       = nullptr;
-    uint32_t         m_submittedCount        = 0;
-    uint32_t         m_reportedCount         = 0;
+    std::atomic<uint32_t> m_submittedCount   = {0};  //!< Ring head, advanced by submission
+    std::atomic<uint32_t> m_reportedCount    = {0};  //!< Ring tail, advanced by GetReport
+    static thread_local uint32_t m_parsingIndex;  //!< Index being parsed by the calling thread
     uint32_t         m_sizeOfReport          = 0;
 
     StatusBufAddr    *m_statusBufAddr        = nullptr;
 
-    std::vector<MediaStatusReportObserver *>  m_completeObservers;
+    using ObserverList = std::vector<MediaStatusReportObserver *>;
+    //! Copy-on-write observer list, NotifyObservers reads a snapshot without locking
+    std::shared_ptr<const ObserverList>       m_completeObservers = std::make_shared<const ObserverList>();
+    std::mutex                                m_observerMutex;
 MEDIA_CLASS_DEFINE_END(MediaStatusReport)
 };
 
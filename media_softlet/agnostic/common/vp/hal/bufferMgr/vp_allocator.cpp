@@ -42,6 +42,14 @@ VpAllocator::VpAllocator(PMOS_INTERFACE osInterface, MediaMemComp *mmc) :
 
 VpAllocator::~VpAllocator()
 {
+    while (!m_surfaceObjPool.empty())
+    {
+        VP_SURFACE *surf = m_surfaceObjPool.back();
+        m_surfaceObjPool.pop_back();
+        MOS_Delete(surf->osSurface);
+        MOS_Delete(surf);
+    }
+
     if (m_allocator)
     {
         m_allocator->DestroyAllResources();
@@ -230,21 +238,13 @@ VP_SURFACE *VpAllocator::AllocateVpSurface(VPHAL_SURFACE &vphalSurf)
         return nullptr;
     }
 
-    VP_SURFACE *surf = MOS_New(VP_SURFACE);
+    VP_SURFACE *surf = AllocateVpSurfaceObj();
 
     if (nullptr == surf)
     {
         return nullptr;
     }
 
-    surf->osSurface = MOS_New(MOS_SURFACE);
-    if (nullptr == surf->osSurface)
-    {
-        MOS_Delete(surf);
-        return nullptr;
-    }
-
-    surf->isResourceOwner = false;
     surf->Clean();
 
     // Initialize the mos surface in vp surface structure.
@@ -257,8 +257,7 @@ VP_SURFACE *VpAllocator::AllocateVpSurface(VPHAL_SURFACE &vphalSurf)
 
     if (MOS_FAILED(m_allocator->GetSurfaceInfo(&osSurface.OsResource, &osSurface)))
     {
-        MOS_Delete(surf->osSurface);
-        MOS_Delete(surf);
+        DestroyVpSurfaceObj(surf);
         return nullptr;
     }
 
@@ -340,20 +339,14 @@ VP_SURFACE *VpAllocator::AllocateVpSurface(VP_SURFACE &vpSurfSrc)
         return nullptr;
     }
 
-    VP_SURFACE *surf = MOS_New(VP_SURFACE);
+    VP_SURFACE *surf = AllocateVpSurfaceObj();
 
     if (nullptr == surf)
     {
         return nullptr;
     }
 
-    MOS_SURFACE *osSurface = MOS_New(MOS_SURFACE);
-
-    if (nullptr == osSurface)
-    {
-        MOS_Delete(surf);
-        return nullptr;
-    }
+    MOS_SURFACE *osSurface = surf->osSurface;
 
     *osSurface = *vpSurfSrc.osSurface;
     *surf = vpSurfSrc;
@@ -374,20 +367,14 @@ VP_SURFACE *VpAllocator::AllocateVpSurface(MOS_SURFACE &osSurf,
         return nullptr;
     }
 
-    VP_SURFACE *surf = MOS_New(VP_SURFACE);
+    VP_SURFACE *surf = AllocateVpSurfaceObj();
 
     if (nullptr == surf)
     {
         return nullptr;
     }
 
-    MOS_SURFACE *osSurface = MOS_New(MOS_SURFACE);
-
-    if (nullptr == osSurface)
-    {
-        MOS_Delete(surf);
-        return nullptr;
-    }
+    MOS_SURFACE *osSurface = surf->osSurface;
 
     *osSurface = osSurf;
     if (updatePlaneOffset)
@@ -414,28 +401,65 @@ VP_SURFACE *VpAllocator::AllocateVpSurface()
 {
     VP_FUNC_CALL();
     // Allocate VpSurface without resource.
-    VP_SURFACE *surf = MOS_New(VP_SURFACE);
+    VP_SURFACE *surf = AllocateVpSurfaceObj();
 
     if (nullptr == surf)
     {
         return nullptr;
     }
 
-    MOS_SURFACE *osSurface = MOS_New(MOS_SURFACE);
+    surf->Clean();
 
-    if (nullptr == osSurface)
+    return surf;
+}
+
+VP_SURFACE *VpAllocator::AllocateVpSurfaceObj()
+{
+    VP_SURFACE *surf = nullptr;
+
+    if (!m_surfaceObjPool.empty())
+    {
+        surf = m_surfaceObjPool.back();
+        m_surfaceObjPool.pop_back();
+        surf->isResourceOwner = false;
+        return surf;
+    }
+
+    surf = MOS_New(VP_SURFACE);
+    if (nullptr == surf)
     {
-        MOS_Delete(surf);
         return nullptr;
     }
 
-    surf->osSurface = osSurface;
+    surf->osSurface = MOS_New(MOS_SURFACE);
+    if (nullptr == surf->osSurface)
+    {
+        MOS_Delete(surf);
+        return nullptr;
+    }
     surf->isResourceOwner = false;
-    surf->Clean();
 
     return surf;
 }
 
+void VpAllocator::DestroyVpSurfaceObj(VP_SURFACE *&surface)
+{
+    if (nullptr == surface)
+    {
+        return;
+    }
+
+    if (nullptr == surface->osSurface || m_surfaceObjPool.size() >= m_maxSurfaceObjPoolSize)
+    {
+        MOS_Delete(surface->osSurface);
+        MOS_Delete(surface);
+        return;
+    }
+
+    m_surfaceObjPool.push_back(surface);
+    surface = nullptr;
+}
+
 // Copy surface info from src to dst. dst shares the resource of src.
 MOS_STATUS VpAllocator::CopyVpSurface(VP_SURFACE &dst, VP_SURFACE &src)
 {
@@ -485,7 +509,9 @@ MOS_STATUS VpAllocator::DestroyVpSurface(VP_SURFACE* &surface, bool deferredDest
     }
     else
     {
-        MOS_Delete(surface->osSurface);
+        // Keep the surface object for next allocation.
+        DestroyVpSurfaceObj(surface);
+        return status;
     }
 
     MOS_Delete(surface);
@@ -792,28 +818,7 @@ MOS_STATUS VpAllocator::ReAllocateSurface(
     }
     //---------------------------------
 
-    auto surfInfoCheck = [=](VP_SURFACE *&surface) -> bool
-                            {
-                                return  (surface->osSurface->Format               == format)          &&
-                                        ((surface->osSurface->bCompressible != 0) == compressible)    &&
-                                        (surface->osSurface->CompressionMode      == compressionMode) &&
-                                        (surface->osSurface->TileType             == defaultTileType  ||
-                                        MOS_TILE_Y                                == defaultTileType  &&
-                                        IS_Y_MAJOR_TILE_FORMAT(surface->osSurface->TileType))         &&
-                                        ((Format_Buffer                           == format           &&
-                                        surface->bufferWidth                      == width            &&
-                                        surface->bufferHeight                     == height)          ||
-                                        (Format_Buffer                            != format           &&
-                                        surface->osSurface->dwWidth               == width            &&
-                                        surface->osSurface->dwHeight              == height)           );
-                            };
-
-    // compressible should be compared with bCompressible since it is inited by bCompressible in previous call
-    // TileType of surface should be compared since we need to reallocate surface if TileType changes
-    if (surface                                                       &&
-        surface->osSurface                                            &&
-        !Mos_ResourceIsNull(&surface->osSurface->OsResource)          &&
-        surfInfoCheck(surface)                                        )
+    if (IsSurfaceMatched(surface, format, defaultTileType, width, height, compressible, compressionMode))
     {
         return eStatus;
     }
@@ -856,7 +861,7 @@ MOS_STATUS VpAllocator::ReAllocateSurface(
         VP_PUBLIC_CHK_NULL_RETURN(nullptr);
     }
 
-    if (!surfInfoCheck(surface))
+    if (!IsSurfaceMatched(surface, format, defaultTileType, width, height, compressible, compressionMode))
     {
         VP_PUBLIC_ASSERTMESSAGE("Incorrect surface parameters.");
     }
@@ -869,6 +874,45 @@ MOS_STATUS VpAllocator::ReAllocateSurface(
     return MOS_STATUS_SUCCESS;
 }
 
+bool VpAllocator::IsSurfaceMatched(
+    VP_SURFACE              *surface,
+    MOS_FORMAT              format,
+    MOS_TILE_TYPE           defaultTileType,
+    uint32_t                width,
+    uint32_t                height,
+    bool                    compressible,
+    MOS_RESOURCE_MMC_MODE   compressionMode)
+{
+    VP_FUNC_CALL();
+
+    if (nullptr == surface || nullptr == surface->osSurface || Mos_ResourceIsNull(&surface->osSurface->OsResource))
+    {
+        return false;
+    }
+
+    if (nullptr == m_mmc || !m_mmc->IsMmcEnabled() ||
+        !m_mmc->IsCompressibelSurfaceSupported())
+    {
+        compressible    = 0;
+        compressionMode = MOS_MMC_DISABLED;
+    }
+
+    // compressible should be compared with bCompressible since it is inited by bCompressible in previous call
+    // TileType of surface should be compared since we need to reallocate surface if TileType changes
+    return  (surface->osSurface->Format               == format)          &&
+            ((surface->osSurface->bCompressible != 0) == compressible)    &&
+            (surface->osSurface->CompressionMode      == compressionMode) &&
+            (surface->osSurface->TileType             == defaultTileType  ||
+            MOS_TILE_Y                                == defaultTileType  &&
+            IS_Y_MAJOR_TILE_FORMAT(surface->osSurface->TileType))         &&
+            ((Format_Buffer                           == format           &&
+            surface->bufferWidth                      == width            &&
+            surface->bufferHeight                     == height)          ||
+            (Format_Buffer                            != format           &&
+            surface->osSurface->dwWidth               == width            &&
+            surface->osSurface->dwHeight              == height)           );
+}
+
 // for debug purpose
 #if (_DEBUG || _RELEASE_INTERNAL)
 MOS_STATUS VpAllocator::ReAllocateSurface(
@@ -388,6 +388,35 @@ public:
         bool                    isNotLockable = false,
         void                    *systemMemory = nullptr);
 
+    //!
+    //! \brief    Check whether allocated surface can be used without reallocation
+    //! \details  Same check as ReAllocateSurface, which returns the surface directly if matched.
+    //! \param    [in] surface
+    //!           Pointer to VP_SURFACE
+    //! \param    [in] format
+    //!           Expected MOS_FORMAT
+    //! \param    [in] defaultTileType
+    //!           Expected Surface Tile Type
+    //! \param    [in] width
+    //!           Expected Surface Width
+    //! \param    [in] height
+    //!           Expected Surface Height
+    //! \param    [in] compressible
+    //!           Surface compressible or not
+    //! \param    [in] compressionMode
+    //!           Compression Mode
+    //! \return   bool
+    //!           true if surface matched, otherwise false
+    //!
+    bool IsSurfaceMatched(
+        VP_SURFACE              *surface,
+        MOS_FORMAT              format,
+        MOS_TILE_TYPE           defaultTileType,
+        uint32_t                width,
+        uint32_t                height,
+        bool                    compressible,
+        MOS_RESOURCE_MMC_MODE   compressionMode);
+
     //!
     //! \brief    Allocates the Surface
     //! \details  Allocates the Surface
@@ -586,10 +615,30 @@ protected:
     //!
     void UpdateSurfacePlaneOffset(MOS_SURFACE &surf);
 
+    //!
+    //! \brief    Get vp surface object with os surface attached
+    //! \details  Objects are taken from m_surfaceObjPool if possible.
+    //!           isResourceOwner is false for the returned surface.
+    //! \return   VP_SURFACE*
+    //!           return the pointer to VP_SURFACE
+    //!
+    VP_SURFACE *AllocateVpSurfaceObj();
+
+    //!
+    //! \brief    Return vp surface object, which does not own the resource, for reuse
+    //! \param    surface
+    //!           [in, out] surface to be released, set to nullptr after return.
+    //! \return   void
+    //!
+    void DestroyVpSurfaceObj(VP_SURFACE *&surface);
+
+    static constexpr uint32_t m_maxSurfaceObjPoolSize = 64;
+
     PMOS_INTERFACE  m_osInterface   = nullptr;
     Allocator       *m_allocator    = nullptr;
     MediaMemComp    *m_mmc          = nullptr;
     std::vector<VP_SURFACE *> m_recycler;   // Container for delayed destroyed surface.
+    std::vector<VP_SURFACE *> m_surfaceObjPool; // Vp surface objects kept for reuse, avoid per frame heap allocation.
 
 MEDIA_CLASS_DEFINE_END(vp__VpAllocator)
 };
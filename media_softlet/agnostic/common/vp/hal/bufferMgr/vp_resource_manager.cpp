@@ -171,9 +171,12 @@ VpResourceManager::~VpResourceManager()
         }
     }
 
-    if (m_veboxStatisticsSurface)
+    for (uint32_t i = 0; i < VP_NUM_STATISTICS_SURFACES; i++)
     {
-        m_allocator.DestroyVpSurface(m_veboxStatisticsSurface);
+        if (m_veboxStatisticsSurface[i])
+        {
+            m_allocator.DestroyVpSurface(m_veboxStatisticsSurface[i]);
+        }
     }
 
     if (m_veboxStatisticsSurfacefor1stPassofSfc2Pass)
@@ -196,9 +199,14 @@ VpResourceManager::~VpResourceManager()
         m_allocator.DestroyVpSurface(m_veboxDNSpatialConfigSurface);
     }
 
-    if (m_vebox3DLookUpTables)
+    // m_vebox3DLookUpTables points to one of the 3DLut cache surfaces.
+    m_vebox3DLookUpTables = nullptr;
+    for (uint32_t i = 0; i < VP_NUM_HDR_3DLUT_CACHE_SURFACES; ++i)
     {
-        m_allocator.DestroyVpSurface(m_vebox3DLookUpTables);
+        if (m_hdr3DLutCache[i].surface)
+        {
+            m_allocator.DestroyVpSurface(m_hdr3DLutCache[i].surface);
+        }
     }
 
     if (m_vebox3DLookUpTables2D)
@@ -345,6 +353,10 @@ MOS_STATUS VpResourceManager::OnNewFrameProcessStart(SwFilterPipe &pipe)
     {
         m_currentDnOutput   = (m_currentDnOutput + 1) & 1;
         m_currentStmmIndex  = (m_currentStmmIndex + 1) & 1;
+        if (m_isStatisticsRingInUse)
+        {
+            m_currentStatisticsIndex = (m_currentStatisticsIndex + 1) % VP_NUM_STATISTICS_SURFACES;
+        }
     }
 
     m_pastFrameIds = m_currentFrameIds;
@@ -888,6 +900,7 @@ MOS_STATUS VpResourceManager::AssignIntermediaSurface(VP_EXECUTE_CAPS& caps, SwF
         bool allocated = false;
         // Get surface parameter.
         GetIntermediaOutputSurfaceParams(caps, params, executedFilters);
+        ReuseCompatibleIntermediaSurface(params);
 
         VP_PUBLIC_CHK_STATUS_RETURN(m_allocator.ReAllocateSurface(
             m_intermediaSurfaces[m_currentPipeIndex],
@@ -925,6 +938,38 @@ MOS_STATUS VpResourceManager::AssignIntermediaSurface(VP_EXECUTE_CAPS& caps, SwF
     return MOS_STATUS_SUCCESS;
 }
 
+void VpResourceManager::ReuseCompatibleIntermediaSurface(VP_SURFACE_PARAMS &params)
+{
+    VP_FUNC_CALL();
+
+    auto isMatched = [&](VP_SURFACE *surf) -> bool
+    {
+        return m_allocator.IsSurfaceMatched(surf, params.format, params.tileType, params.width, params.height,
+            params.surfCompressible, params.surfCompressionMode);
+    };
+
+    if (isMatched(m_intermediaSurfaces[m_currentPipeIndex]))
+    {
+        return;
+    }
+
+    // Intermedia surface of previous pipe is input of current pipe, which is the only one in use.
+    // Others can be exchanged with current one to avoid reallocation when feature chain changes.
+    for (uint32_t i = 0; i < m_intermediaSurfaces.size(); ++i)
+    {
+        if (i == m_currentPipeIndex || i + 1 == m_currentPipeIndex)
+        {
+            continue;
+        }
+        if (isMatched(m_intermediaSurfaces[i]))
+        {
+            VP_PUBLIC_NORMALMESSAGE("Reuse intermedia surface %d for pipe %d.", i, m_currentPipeIndex);
+            std::swap(m_intermediaSurfaces[i], m_intermediaSurfaces[m_currentPipeIndex]);
+            return;
+        }
+    }
+}
+
 VP_SURFACE * VpResourceManager::GetCopyInstOfExtSurface(VP_SURFACE* surf)
 {
     VP_FUNC_CALL();
@@ -1808,13 +1853,19 @@ MOS_STATUS VpResourceManager::AllocateVeboxResource(VP_EXECUTE_CAPS& caps, VP_SU
     dwHeight                = MOS_ROUNDUP_DIVIDE(inputSurface->osSurface->dwHeight, 4) +
                 MOS_ROUNDUP_DIVIDE(statistic_size * sizeof(uint32_t), dwWidth);
 
+    bool isStatisticsAllocated = false;
     if (caps.b1stPassOfSfc2PassScaling)
     {
-        VP_PUBLIC_CHK_STATUS_RETURN(ReAllocateVeboxStatisticsSurface(m_veboxStatisticsSurfacefor1stPassofSfc2Pass, caps, inputSurface, dwWidth, dwHeight));
+        VP_PUBLIC_CHK_STATUS_RETURN(ReAllocateVeboxStatisticsSurface(m_veboxStatisticsSurfacefor1stPassofSfc2Pass, caps, inputSurface, dwWidth, dwHeight, isStatisticsAllocated));
     }
     else
     {
-        VP_PUBLIC_CHK_STATUS_RETURN(ReAllocateVeboxStatisticsSurface(m_veboxStatisticsSurface, caps, inputSurface, dwWidth, dwHeight));
+        VP_PUBLIC_CHK_STATUS_RETURN(ReAllocateVeboxStatisticsSurface(m_veboxStatisticsSurface[m_currentStatisticsIndex], caps, inputSurface, dwWidth, dwHeight, isStatisticsAllocated));
+        if (isStatisticsAllocated)
+        {
+            // Statistics layout may be changed, in which case content of other surfaces in ring cannot be used.
+            MOS_ZeroMemory(m_veboxStatisticsFilled, sizeof(m_veboxStatisticsFilled));
+        }
     }
 
     VP_PUBLIC_CHK_STATUS_RETURN(Allocate3DLut(caps));
@@ -1854,7 +1905,7 @@ MOS_STATUS VpResourceManager::Allocate3DLut(VP_EXECUTE_CAPS& caps)
         uint32_t lutHeight = 0;
         size = Get3DLutSize(lutWidth, lutHeight);
         VP_PUBLIC_CHK_STATUS_RETURN(m_allocator.ReAllocateSurface(
-            m_vebox3DLookUpTables,
+            m_hdr3DLutCache[m_current3DLutIndex].surface,
             "Vebox3DLutTableSurface",
             Format_Buffer,
             MOS_GFXRES_BUFFER,
@@ -1868,11 +1919,76 @@ MOS_STATUS VpResourceManager::Allocate3DLut(VP_EXECUTE_CAPS& caps)
             IsDeferredResourceDestroyNeeded(),
             MOS_HW_RESOURCE_USAGE_VP_INTERNAL_READ_WRITE_RENDER));
 
+        // 3DLut size is fixed, thus surface is only allocated for 3DLut cache miss, in which case
+        // 3DLut kernel fills it in current frame.
+        m_vebox3DLookUpTables = m_hdr3DLutCache[m_current3DLutIndex].surface;
     }
 
     return MOS_STATUS_SUCCESS;
 }
 
+MOS_STATUS VpResourceManager::Select3DLut(uint32_t maxCLL, uint32_t maxDLL, VPHAL_HDR_MODE hdrMode, bool &isCached)
+{
+    VP_FUNC_CALL();
+
+    // Only max CLL changes with per scene metadata. Quantize it to let close values share one 3DLut.
+    uint64_t key = ((uint64_t)(maxCLL / VP_HDR_3DLUT_CACHE_CLL_STEP) << 32) |
+                   ((uint64_t)(maxDLL & 0xffffff) << 8) |
+                   ((uint64_t)hdrMode & 0xff);
+    uint32_t selected = 0;
+
+    isCached = false;
+
+    for (uint32_t i = 0; i < VP_NUM_HDR_3DLUT_CACHE_SURFACES; ++i)
+    {
+        if (m_hdr3DLutCache[i].valid && m_hdr3DLutCache[i].surface && m_hdr3DLutCache[i].key == key)
+        {
+            selected = i;
+            isCached = true;
+            break;
+        }
+        if (m_hdr3DLutCache[i].lastUsed < m_hdr3DLutCache[selected].lastUsed)
+        {
+            selected = i;
+        }
+    }
+
+    if (!isCached)
+    {
+        // 3DLut kernel will fill the surface for new parameters. Keep it invalid until the kernel is submitted.
+        m_hdr3DLutCache[selected].key   = key;
+        m_hdr3DLutCache[selected].valid = false;
+    }
+    m_hdr3DLutFillPending = !isCached;
+    m_hdr3DLutCache[selected].lastUsed = ++m_hdr3DLutCacheCounter;
+
+    m_current3DLutIndex   = selected;
+    m_vebox3DLookUpTables = m_hdr3DLutCache[selected].surface;
+
+    VP_PUBLIC_NORMALMESSAGE("3DLut cache %s, index %d, maxCLL %d, maxDLL %d, hdrMode %d",
+        isCached ? "hit" : "miss", selected, maxCLL, maxDLL, hdrMode);
+
+    return MOS_STATUS_SUCCESS;
+}
+
+void VpResourceManager::Update3DLutCacheAfterSubmit(MOS_STATUS status)
+{
+    VP_FUNC_CALL();
+
+    if (!m_hdr3DLutFillPending)
+    {
+        return;
+    }
+
+    m_hdr3DLutCache[m_current3DLutIndex].valid = MOS_SUCCEEDED(status);
+    m_hdr3DLutFillPending                      = false;
+
+    if (MOS_FAILED(status))
+    {
+        VP_PUBLIC_NORMALMESSAGE("3DLut cache index %d invalidated for submission failure %d", m_current3DLutIndex, status);
+    }
+}
+
 MOS_STATUS VpResourceManager::AllocateResourceFor3DLutKernel(VP_EXECUTE_CAPS& caps)
 {
     VP_FUNC_CALL();
@@ -2142,7 +2258,24 @@ MOS_STATUS VpResourceManager::AssignVeboxResource(VP_EXECUTE_CAPS& caps, VP_SURF
     }
     else
     {
-        surfGroup.insert(std::make_pair(SurfaceTypeStatistics, m_veboxStatisticsSurface));
+        surfGroup.insert(std::make_pair(SurfaceTypeStatistics, m_veboxStatisticsSurface[m_currentStatisticsIndex]));
+
+        m_isStatisticsRingInUse = resHint.isHVSTableNeeded;
+        if (m_isStatisticsRingInUse)
+        {
+            // Statistics are read back by CPU before current frame submitted. Provide the oldest filled one in ring,
+            // which most likely has completed, so that CPU need not wait for vebox of last frame.
+            for (i = 1; i < VP_NUM_STATISTICS_SURFACES; i++)
+            {
+                uint32_t index = (m_currentStatisticsIndex + i) % VP_NUM_STATISTICS_SURFACES;
+                if (m_veboxStatisticsFilled[index] && m_veboxStatisticsSurface[index])
+                {
+                    surfGroup.insert(std::make_pair(SurfaceTypeStatisticsPast, m_veboxStatisticsSurface[index]));
+                    break;
+                }
+            }
+        }
+        m_veboxStatisticsFilled[m_currentStatisticsIndex] = true;
     }
     surfSetting.dwVeboxPerBlockStatisticsHeight = m_dwVeboxPerBlockStatisticsHeight;
     surfSetting.dwVeboxPerBlockStatisticsWidth  = m_dwVeboxPerBlockStatisticsWidth;
@@ -2306,7 +2439,7 @@ bool VpResourceManager::VeboxSTMMNeeded(VP_EXECUTE_CAPS& caps, bool queryAssignm
     }
 }
 
-MOS_STATUS VpResourceManager::ReAllocateVeboxStatisticsSurface(VP_SURFACE *&statisticsSurface, VP_EXECUTE_CAPS &caps, VP_SURFACE *inputSurface, uint32_t dwWidth, uint32_t dwHeight)
+MOS_STATUS VpResourceManager::ReAllocateVeboxStatisticsSurface(VP_SURFACE *&statisticsSurface, VP_EXECUTE_CAPS &caps, VP_SURFACE *inputSurface, uint32_t dwWidth, uint32_t dwHeight, bool &allocated)
 {
     VP_FUNC_CALL();
     
@@ -2355,6 +2488,7 @@ MOS_STATUS VpResourceManager::ReAllocateVeboxStatisticsSurface(VP_SURFACE *&stat
                 InitValue));
         }
     }
+    allocated = bAllocated;
 
     m_dwVeboxPerBlockStatisticsWidth  = dwWidth;
     m_dwVeboxPerBlockStatisticsHeight = MOS_ROUNDUP_DIVIDE(inputSurface->osSurface->dwHeight, 4);
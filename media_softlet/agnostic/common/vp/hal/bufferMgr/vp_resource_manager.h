@@ -45,6 +45,7 @@
 
 #define VP_NUM_ACE_STATISTICS_HISTOGRAM      256
 #define VP_NUM_STD_STATISTICS                2
+#define VP_NUM_STATISTICS_SURFACES           3                               //!< Statistics surface ring for CPU readout without waiting last vebox
 
 #ifndef VEBOX_AUTO_DENOISE_SUPPORTED
 #define VEBOX_AUTO_DENOISE_SUPPORTED    1
@@ -63,6 +64,9 @@
 
 #define VP_NUM_FC_INTERMEDIA_SURFACES   2
 
+#define VP_NUM_HDR_3DLUT_CACHE_SURFACES     4                               //!< Number of HDR 3DLut surfaces kept resident for reuse
+#define VP_HDR_3DLUT_CACHE_CLL_STEP         16                              //!< Quantization step in nits of max content light level for 3DLut cache
+
 namespace vp {
     struct VEBOX_SPATIAL_ATTRIBUTES_CONFIGURATION
     {
@@ -406,6 +410,33 @@ public:
        return NULL;
     }
 
+    //!
+    //! \brief    Select HDR 3DLut surface for tone mapping parameters
+    //! \details  The 3DLut surface, whose content was calculated for same quantized parameters,
+    //!           is selected as current 3DLut if exists. Otherwise, the least recently used one is
+    //!           selected and need be recalculated by 3DLut kernel.
+    //! \param    [in] maxCLL
+    //!           Max content light level.
+    //! \param    [in] maxDLL
+    //!           Max display luminance.
+    //! \param    [in] hdrMode
+    //!           HDR mode.
+    //! \param    [out] isCached
+    //!           true if selected 3DLut surface has been filled for the parameters.
+    //! \return   MOS_STATUS
+    //!
+    MOS_STATUS Select3DLut(uint32_t maxCLL, uint32_t maxDLL, VPHAL_HDR_MODE hdrMode, bool &isCached);
+
+    //!
+    //! \brief    Update HDR 3DLut cache after packet pipe submission
+    //! \details  The 3DLut surface selected on cache miss only becomes valid once the
+    //!           3DLut kernel filling it has been submitted successfully.
+    //! \param    [in] status
+    //!           Status of packet pipe execution.
+    //! \return   void
+    //!
+    void Update3DLutCacheAfterSubmit(MOS_STATUS status);
+
 protected:
     VP_SURFACE* GetVeboxOutputSurface(VP_EXECUTE_CAPS& caps, VP_SURFACE *outputSurface);
     MOS_STATUS InitVeboxSpatialAttributesConfiguration();
@@ -439,7 +470,7 @@ protected:
     virtual MOS_STATUS AssignVeboxResourceForRender(VP_EXECUTE_CAPS &caps, VP_SURFACE *inputSurface, RESOURCE_ASSIGNMENT_HINT resHint, VP_SURFACE_SETTING &surfSetting);
     virtual MOS_STATUS AssignVeboxResource(VP_EXECUTE_CAPS& caps, VP_SURFACE* inputSurface, VP_SURFACE* outputSurface, VP_SURFACE* pastSurface, VP_SURFACE* futureSurface,
         RESOURCE_ASSIGNMENT_HINT resHint, VP_SURFACE_SETTING& surfSetting, SwFilterPipe& executedFilters);
-    MOS_STATUS ReAllocateVeboxStatisticsSurface(VP_SURFACE *&statisticsSurface, VP_EXECUTE_CAPS &caps, VP_SURFACE *inputSurface, uint32_t dwWidth, uint32_t dwHeight);
+    MOS_STATUS ReAllocateVeboxStatisticsSurface(VP_SURFACE *&statisticsSurface, VP_EXECUTE_CAPS &caps, VP_SURFACE *inputSurface, uint32_t dwWidth, uint32_t dwHeight, bool &allocated);
 
     //!
     //! \brief    Vebox initialize STMM History
@@ -492,6 +523,7 @@ protected:
     MOS_STATUS GetIntermediaOutputSurfaceParams(VP_EXECUTE_CAPS& caps, VP_SURFACE_PARAMS &params, SwFilterPipe &executedFilters);
     MOS_STATUS         GetIntermediaOutputSurfaceColorAndFormat(VP_EXECUTE_CAPS &caps, SwFilterPipe &executedFilters, MOS_FORMAT &format, VPHAL_CSPACE &colorSpace);
     MOS_STATUS AssignIntermediaSurface(VP_EXECUTE_CAPS& caps, SwFilterPipe &executedFilters);
+    void ReuseCompatibleIntermediaSurface(VP_SURFACE_PARAMS &params);
 
     bool IsDeferredResourceDestroyNeeded()
     {
@@ -520,18 +552,31 @@ protected:
     VP_SURFACE* m_veboxDenoiseOutput[VP_NUM_DN_SURFACES]     = {};            //!< Vebox Denoise output surface
     VP_SURFACE* m_veboxOutput[VP_MAX_NUM_VEBOX_SURFACES]     = {};            //!< Vebox output surface, can be reuse for DI usages
     VP_SURFACE* m_veboxSTMMSurface[VP_NUM_STMM_SURFACES]     = {};            //!< Vebox STMM input/output surface
-    VP_SURFACE *m_veboxStatisticsSurface                     = nullptr;       //!< Statistics Surface for VEBOX
+    VP_SURFACE *m_veboxStatisticsSurface[VP_NUM_STATISTICS_SURFACES] = {};    //!< Statistics Surface ring for VEBOX
+    bool        m_veboxStatisticsFilled[VP_NUM_STATISTICS_SURFACES]  = {};    //!< true if statistics surface has been written by vebox
+    uint32_t    m_currentStatisticsIndex                     = 0;
+    bool        m_isStatisticsRingInUse                      = false;         //!< true if statistics are read back by CPU, e.g. for HVS denoise
     VP_SURFACE *m_veboxStatisticsSurfacefor1stPassofSfc2Pass = nullptr;       //!< Statistics Surface for VEBOX for 1stPassofSfc2Pass submission
     uint32_t    m_dwVeboxPerBlockStatisticsWidth             = 0;
     uint32_t    m_dwVeboxPerBlockStatisticsHeight            = 0;
     VP_SURFACE *m_veboxRgbHistogram                          = nullptr;       //!< RGB Histogram surface for Vebox
     VP_SURFACE *m_veboxDNTempSurface                         = nullptr;       //!< Vebox DN Update kernels temp surface
     VP_SURFACE *m_veboxDNSpatialConfigSurface                = nullptr;       //!< Spatial Attributes Configuration Surface for DN kernel
-    VP_SURFACE *m_vebox3DLookUpTables                        = nullptr;
+    VP_SURFACE *m_vebox3DLookUpTables                        = nullptr;       //!< Current 3DLut surface, pointing to one in m_hdr3DLutCache.
     VP_SURFACE *m_vebox3DLookUpTables2D                      = nullptr;
     VP_SURFACE *m_vebox1DLookUpTables                        = nullptr;
     VP_SURFACE *m_veboxDnHVSTables                           = nullptr;
     VP_SURFACE *m_3DLutKernelCoefSurface                     = nullptr;       //!< Coef surface for 3DLut kernel.
+    struct
+    {
+        uint64_t    key;                                                          //!< Quantized tone mapping parameters of 3DLut content.
+        uint64_t    lastUsed;
+        bool        valid;
+        VP_SURFACE  *surface;
+    } m_hdr3DLutCache[VP_NUM_HDR_3DLUT_CACHE_SURFACES]       = {};
+    uint32_t    m_current3DLutIndex                          = 0;
+    bool        m_hdr3DLutFillPending                        = false;         //!< m_current3DLutIndex is waiting for 3DLut kernel submission.
+    uint64_t    m_hdr3DLutCacheCounter                       = 0;
     uint32_t    m_currentDnOutput                            = 0;
     uint32_t    m_currentStmmIndex                           = 0;
     uint32_t    m_veboxOutputCount                           = 2;             //!< PE on: 4 used. PE off: 2 used
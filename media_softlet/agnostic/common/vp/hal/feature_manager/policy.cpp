@@ -241,6 +241,8 @@ MOS_STATUS Policy::RegisterFeatures()
 
 void Policy::UnregisterFeatures()
 {
+    ClearExecutionEnginesCache();
+
     while (!m_VeboxSfcFeatureHandlers.empty())
     {
         std::map<FeatureType, PolicyFeatureHandler*>::iterator it = m_VeboxSfcFeatureHandlers.begin();
@@ -495,15 +497,241 @@ MOS_STATUS Policy::BuildExecutionEngines(SwFilterPipe &swFilterPipe, bool isInpu
 
     if (pipe)
     {
-        for (auto filterID : m_featurePool)
+        bool cacheHit = false;
+        VP_PUBLIC_CHK_STATUS_RETURN(GetCachedExecutionEngines(*pipe, isInputPipe, engineCapsCombined, cacheHit));
+
+        if (!cacheHit)
         {
-            VP_PUBLIC_CHK_STATUS_RETURN(GetExecutionCapsForSingleFeature(filterID, *pipe, engineCapsCombined));
+            ExecutionEnginesCacheEntry entry = {};
+            bool cacheable = IsExecutionEnginesCacheable(*pipe);
+            if (cacheable)
+            {
+                VP_PUBLIC_CHK_STATUS_RETURN(CloneFeaturesForExecutionEnginesCache(*pipe, entry));
+            }
+
+            MOS_STATUS status = MOS_STATUS_SUCCESS;
+            for (auto filterID : m_featurePool)
+            {
+                status = GetExecutionCapsForSingleFeature(filterID, *pipe, engineCapsCombined);
+                if (MOS_FAILED(status))
+                {
+                    break;
+                }
+            }
+
+            if (cacheable)
+            {
+                entry.isInputPipe = isInputPipe;
+                if (MOS_SUCCEEDED(status))
+                {
+                    // Entry is released inside on failure or when not added.
+                    VP_PUBLIC_CHK_STATUS_RETURN(AddExecutionEnginesCache(*pipe, entry));
+                }
+                else
+                {
+                    ReleaseExecutionEnginesCacheEntry(entry);
+                }
+            }
+            VP_PUBLIC_CHK_STATUS_RETURN(status);
         }
+
         VP_PUBLIC_CHK_STATUS_RETURN(FilterFeatureCombination(swFilterPipe, isInputPipe, index, engineCapsCombined));
     }
     return MOS_STATUS_SUCCESS;
 }
 
+bool Policy::IsExecutionEnginesCacheable(SwFilterSubPipe &pipe)
+{
+    for (auto filterID : m_featurePool)
+    {
+        SwFilter *feature = pipe.GetSwFilter(filterID);
+        if (nullptr == feature)
+        {
+            continue;
+        }
+        // HDR decision depends on 3DLut parameters saved from previous frames.
+        // Filters with engine caps already set are being processed for next pass.
+        if (FeatureTypeHdr == filterID || feature->GetFilterEngineCaps().value != 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Policy::IsExecutionEnginesCacheHit(ExecutionEnginesCacheEntry &entry, SwFilterSubPipe &pipe, bool isInputPipe)
+{
+    auto userFeatureControl = m_vpInterface.GetHwInterface()->m_userFeatureControl;
+
+    if (entry.isInputPipe != isInputPipe || nullptr == userFeatureControl ||
+        entry.ctrlVal.size() != sizeof(VpUserFeatureControl::CONTROL_VALUES) ||
+        0 != memcmp(entry.ctrlVal.data(), &userFeatureControl->GetControlValues(), entry.ctrlVal.size()))
+    {
+        return false;
+    }
+
+    uint32_t i = 0;
+    for (auto filterID : m_featurePool)
+    {
+        SwFilter *feature = pipe.GetSwFilter(filterID);
+        if (nullptr == feature)
+        {
+            continue;
+        }
+        if (i >= entry.features.size() ||
+            feature->GetRenderTargetType() != entry.features[i].params->GetRenderTargetType() ||
+            !(*entry.features[i].params == *feature))
+        {
+            return false;
+        }
+        ++i;
+    }
+    return i == entry.features.size();
+}
+
+MOS_STATUS Policy::GetCachedExecutionEngines(SwFilterSubPipe &pipe, bool isInputPipe, VP_EngineEntry &engineCapsCombined, bool &hit)
+{
+    VP_FUNC_CALL();
+
+    hit = false;
+    if (!IsExecutionEnginesCacheable(pipe))
+    {
+        return MOS_STATUS_SUCCESS;
+    }
+
+    for (auto &entry : m_executionEnginesCache)
+    {
+        if (!IsExecutionEnginesCacheHit(entry, pipe, isInputPipe))
+        {
+            continue;
+        }
+
+        uint32_t i = 0;
+        for (auto filterID : m_featurePool)
+        {
+            SwFilter *feature = pipe.GetSwFilter(filterID);
+            if (nullptr == feature)
+            {
+                continue;
+            }
+            feature->GetFilterEngineCaps() = entry.features[i].engineCaps;
+            VP_PUBLIC_CHK_STATUS_RETURN(feature->SetRenderTargetType(entry.features[i].renderTargetType));
+            engineCapsCombined.value |= entry.features[i].engineCaps.value;
+            PrintFeatureExecutionCaps(__FUNCTION__, feature->GetFilterEngineCaps());
+            ++i;
+        }
+
+        entry.lastUsed = ++m_executionEnginesCacheCounter;
+        hit            = true;
+        VP_PUBLIC_NORMALMESSAGE("Execution engines reused from cache.");
+        return MOS_STATUS_SUCCESS;
+    }
+
+    return MOS_STATUS_SUCCESS;
+}
+
+MOS_STATUS Policy::CloneFeaturesForExecutionEnginesCache(SwFilterSubPipe &pipe, ExecutionEnginesCacheEntry &entry)
+{
+    VP_FUNC_CALL();
+
+    auto userFeatureControl = m_vpInterface.GetHwInterface()->m_userFeatureControl;
+    VP_PUBLIC_CHK_NULL_RETURN(userFeatureControl);
+    const uint8_t *ctrlVal = (const uint8_t *)&userFeatureControl->GetControlValues();
+    entry.ctrlVal.assign(ctrlVal, ctrlVal + sizeof(VpUserFeatureControl::CONTROL_VALUES));
+
+    for (auto filterID : m_featurePool)
+    {
+        SwFilter *feature = pipe.GetSwFilter(filterID);
+        if (nullptr == feature)
+        {
+            continue;
+        }
+        ExecutionEnginesCacheEntry::FeatureEntry featureEntry = {};
+        featureEntry.params = feature->Clone();
+        if (nullptr == featureEntry.params)
+        {
+            ReleaseExecutionEnginesCacheEntry(entry);
+            VP_PUBLIC_CHK_NULL_RETURN(featureEntry.params);
+        }
+        entry.features.push_back(featureEntry);
+    }
+    return MOS_STATUS_SUCCESS;
+}
+
+MOS_STATUS Policy::AddExecutionEnginesCache(SwFilterSubPipe &pipe, ExecutionEnginesCacheEntry &entry)
+{
+    VP_FUNC_CALL();
+
+    // Only cache the decision if it did not change any filter parameters, so that a hit
+    // only needs the engine caps to be restored.
+    uint32_t i = 0;
+    for (auto filterID : m_featurePool)
+    {
+        SwFilter *feature = pipe.GetSwFilter(filterID);
+        if (nullptr == feature)
+        {
+            continue;
+        }
+        if (i >= entry.features.size() || !(*entry.features[i].params == *feature))
+        {
+            VP_PUBLIC_NORMALMESSAGE("Filter %d updated by engine decision. Not cached.", filterID);
+            ReleaseExecutionEnginesCacheEntry(entry);
+            return MOS_STATUS_SUCCESS;
+        }
+        entry.features[i].engineCaps       = feature->GetFilterEngineCaps();
+        entry.features[i].renderTargetType = feature->GetRenderTargetType();
+        ++i;
+    }
+    if (i != entry.features.size())
+    {
+        ReleaseExecutionEnginesCacheEntry(entry);
+        return MOS_STATUS_SUCCESS;
+    }
+
+    entry.lastUsed = ++m_executionEnginesCacheCounter;
+
+    if (m_executionEnginesCache.size() < m_maxExecutionEnginesCacheNum)
+    {
+        m_executionEnginesCache.push_back(entry);
+        return MOS_STATUS_SUCCESS;
+    }
+
+    auto lru = m_executionEnginesCache.begin();
+    for (auto it = m_executionEnginesCache.begin(); it != m_executionEnginesCache.end(); ++it)
+    {
+        if (it->lastUsed < lru->lastUsed)
+        {
+            lru = it;
+        }
+    }
+    ReleaseExecutionEnginesCacheEntry(*lru);
+    *lru = entry;
+
+    return MOS_STATUS_SUCCESS;
+}
+
+void Policy::ReleaseExecutionEnginesCacheEntry(ExecutionEnginesCacheEntry &entry)
+{
+    for (auto &featureEntry : entry.features)
+    {
+        if (featureEntry.params)
+        {
+            featureEntry.params->DestroySwFilter(featureEntry.params);
+            featureEntry.params = nullptr;
+        }
+    }
+    entry.features.clear();
+}
+
+void Policy::ClearExecutionEnginesCache()
+{
+    for (auto &entry : m_executionEnginesCache)
+    {
+        ReleaseExecutionEnginesCacheEntry(entry);
+    }
+    m_executionEnginesCache.clear();
+}
+
 MOS_STATUS Policy::Update3DLutoutputColorAndFormat(FeatureParamCsc *cscParams, FeatureParamHdr *hdrParams, MOS_FORMAT Format, VPHAL_CSPACE CSpace)
 {
     // For vebox + render, e.g. BT2020 P010->SRGB, if not correct the format here, since forceCscToRender being enabled, outputFormat in csc filter of
@@ -1615,13 +1843,14 @@ MOS_STATUS Policy::GetHdrExecutionCaps(SwFilter *feature)
     {
         if (Is3DLutKernelSupported())
         {
-            if (hdrParams->uiMaxContentLevelLum != m_savedMaxCLL || hdrParams->uiMaxDisplayLum != m_savedMaxDLL ||
-                hdrParams->hdrMode != m_savedHdrMode)
-            {
-                m_savedMaxCLL = hdrParams->uiMaxContentLevelLum;
-                m_savedMaxDLL = hdrParams->uiMaxDisplayLum;
-                m_savedHdrMode = hdrParams->hdrMode;
+            VpResourceManager *resourceManager = m_vpInterface.GetResourceManager();
+            bool               is3DLutCached   = false;
+            VP_PUBLIC_CHK_NULL_RETURN(resourceManager);
+            VP_PUBLIC_CHK_STATUS_RETURN(resourceManager->Select3DLut(
+                hdrParams->uiMaxContentLevelLum, hdrParams->uiMaxDisplayLum, hdrParams->hdrMode, is3DLutCached));
 
+            if (!is3DLutCached)
+            {
                 hdrParams->stage         = HDR_STAGE_3DLUT_KERNEL;
                 pHDREngine->bEnabled     = 1;
                 pHDREngine->isolated     = 1;
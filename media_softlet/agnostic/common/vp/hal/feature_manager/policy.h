@@ -73,7 +73,36 @@ public:
         return m_featurePool;
     }
 
+    //!
+    //! \brief    Release cached engine decisions
+    //! \details  Cached entries hold sw filter clones, which must be released before
+    //!           the sw filter handlers are destroyed.
+    //!
+    void ClearExecutionEnginesCache();
+
 protected:
+    // Engine caps decided by BuildExecutionEngines for one sub pipe.
+    struct ExecutionEnginesCacheEntry
+    {
+        struct FeatureEntry
+        {
+            SwFilter         *params           = nullptr;  //!< Clone of the filter before engine decision.
+            VP_EngineEntry    engineCaps       = {};
+            RenderTargetType  renderTargetType = RenderTargetTypeSurface;
+        };
+        bool                                 isInputPipe = false;
+        uint32_t                             lastUsed    = 0;
+        std::vector<uint8_t>                 ctrlVal;    //!< Copy of user feature control values.
+        std::vector<FeatureEntry>            features;
+    };
+
+    bool IsExecutionEnginesCacheable(SwFilterSubPipe &pipe);
+    bool IsExecutionEnginesCacheHit(ExecutionEnginesCacheEntry &entry, SwFilterSubPipe &pipe, bool isInputPipe);
+    MOS_STATUS GetCachedExecutionEngines(SwFilterSubPipe &pipe, bool isInputPipe, VP_EngineEntry &engineCapsCombined, bool &hit);
+    MOS_STATUS CloneFeaturesForExecutionEnginesCache(SwFilterSubPipe &pipe, ExecutionEnginesCacheEntry &entry);
+    MOS_STATUS AddExecutionEnginesCache(SwFilterSubPipe &pipe, ExecutionEnginesCacheEntry &entry);
+    void ReleaseExecutionEnginesCacheEntry(ExecutionEnginesCacheEntry &entry);
+
     virtual MOS_STATUS RegisterFeatures();
     virtual void UnregisterFeatures();
     virtual MOS_STATUS GetExecutionCapsForSingleFeature(FeatureType featureType, SwFilterSubPipe& swFilterPipe, VP_EngineEntry& engineCapsCombined);
@@ -188,10 +217,10 @@ protected:
     VP_HW_CAPS          m_hwCaps = {};
     bool                m_initialized = false;
 
-    // HDR 3DLut Parameters
-    uint32_t            m_savedMaxDLL   = 1000;
-    uint32_t            m_savedMaxCLL   = 4000;
-    VPHAL_HDR_MODE      m_savedHdrMode  = VPHAL_HDR_MODE_NONE;
+    // Engine decisions of recent sub pipes, least recently used one is replaced when full.
+    static constexpr uint32_t               m_maxExecutionEnginesCacheNum = 4;
+    std::vector<ExecutionEnginesCacheEntry> m_executionEnginesCache;
+    uint32_t                                m_executionEnginesCacheCounter = 0;
 
     //!
     //! \brief    Check whether Alpha Supported
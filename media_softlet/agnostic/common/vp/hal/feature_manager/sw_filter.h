@@ -162,6 +162,7 @@ enum SurfaceType
     SurfaceTypeLaceAceRGBHistogram,
     SurfaceTypeLaceLut,
     SurfaceTypeStatistics,
+    SurfaceTypeStatisticsPast,  // statistics of earlier frame for CPU readout
     SurfaceTypeSkinScore,
     SurfaceType3DLut,
     SurfaceType1k1dLut,
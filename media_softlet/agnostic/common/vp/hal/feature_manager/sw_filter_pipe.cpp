@@ -30,6 +30,7 @@
 #include "vp_obj_factories.h"
 #include "vp_feature_manager.h"
 #include "sw_filter_handle.h"
+#include <algorithm>
 
 using namespace vp;
 
@@ -44,6 +45,13 @@ SwFilterSubPipe::SwFilterSubPipe()
 SwFilterSubPipe::~SwFilterSubPipe()
 {
     Clean();
+
+    while (!m_freeFilterSets.empty())
+    {
+        auto filterSet = m_freeFilterSets.back();
+        m_freeFilterSets.pop_back();
+        MOS_Delete(filterSet);
+    }
 }
 
 MOS_STATUS SwFilterSubPipe::Clean()
@@ -56,7 +64,8 @@ MOS_STATUS SwFilterSubPipe::Clean()
         {
             // Loop orderred feature set.
             VP_PUBLIC_CHK_STATUS_RETURN(filterSet->Clean());
-            MOS_Delete(filterSet);
+            filterSet->SetLocation(nullptr);
+            m_freeFilterSets.push_back(filterSet);
         }
     }
     m_OrderedFilters.clear();
@@ -119,7 +128,15 @@ MOS_STATUS SwFilterSubPipe::AddSwFilterOrdered(SwFilter *swFilter, bool useNewSw
 
     if (useNewSwFilterSet || pipe.empty())
     {
-        swFilterSet = MOS_New(SwFilterSet);
+        if (m_freeFilterSets.empty())
+        {
+            swFilterSet = MOS_New(SwFilterSet);
+        }
+        else
+        {
+            swFilterSet = m_freeFilterSets.back();
+            m_freeFilterSets.pop_back();
+        }
         useNewSwFilterSet = true;
     }
     else
@@ -134,7 +151,7 @@ MOS_STATUS SwFilterSubPipe::AddSwFilterOrdered(SwFilter *swFilter, bool useNewSw
     {
         if (useNewSwFilterSet)
         {
-            MOS_Delete(swFilterSet);
+            m_freeFilterSets.push_back(swFilterSet);
         }
         return status;
     }
@@ -165,6 +182,46 @@ SwFilterPipe::SwFilterPipe(VpInterface &vpInterface) : m_vpInterface(vpInterface
 SwFilterPipe::~SwFilterPipe()
 {
     Clean();
+
+    while (!m_freeSubPipes.empty())
+    {
+        auto p = m_freeSubPipes.back();
+        m_freeSubPipes.pop_back();
+        MOS_Delete(p);
+    }
+}
+
+SwFilterSubPipe *SwFilterPipe::CreateSwFilterSubPipe()
+{
+    if (m_freeSubPipes.empty())
+    {
+        return MOS_New(SwFilterSubPipe);
+    }
+    SwFilterSubPipe *pipe = m_freeSubPipes.back();
+    m_freeSubPipes.pop_back();
+    return pipe;
+}
+
+void SwFilterPipe::DestroySwFilterSubPipe(SwFilterSubPipe *&pipe)
+{
+    if (nullptr == pipe)
+    {
+        return;
+    }
+    if (std::find(m_freeSubPipes.begin(), m_freeSubPipes.end(), pipe) != m_freeSubPipes.end())
+    {
+        // Same sub pipe may be referenced by more than one layer.
+        pipe = nullptr;
+        return;
+    }
+    // Features should have been cleaned by caller. Keep the object and its containers for next frame.
+    if (MOS_FAILED(pipe->Clean()))
+    {
+        MOS_Delete(pipe);
+        return;
+    }
+    m_freeSubPipes.push_back(pipe);
+    pipe = nullptr;
 }
 
 MOS_STATUS SwFilterPipe::Initialize(VP_PIPELINE_PARAMS &params, FeatureRule &featureRule)
@@ -211,7 +268,7 @@ MOS_STATUS SwFilterPipe::Initialize(VP_PIPELINE_PARAMS &params, FeatureRule &fea
         m_linkedLayerIndex.push_back(0);
 
         // Initialize m_InputPipes.
-        SwFilterSubPipe *pipe = MOS_New(SwFilterSubPipe);
+        SwFilterSubPipe *pipe = CreateSwFilterSubPipe();
         if (nullptr == pipe)
         {
             Clean();
@@ -237,7 +294,7 @@ MOS_STATUS SwFilterPipe::Initialize(VP_PIPELINE_PARAMS &params, FeatureRule &fea
         m_OutputSurfaces.push_back(surf);
 
         // Initialize m_OutputPipes.
-        SwFilterSubPipe *pipe = MOS_New(SwFilterSubPipe);
+        SwFilterSubPipe *pipe = CreateSwFilterSubPipe();
         if (nullptr == pipe)
         {
             Clean();
@@ -288,7 +345,7 @@ MOS_STATUS SwFilterPipe::Initialize(VEBOX_SFC_PARAMS &params)
         m_linkedLayerIndex.push_back(0);
 
         // Initialize m_InputPipes.
-        SwFilterSubPipe *pipe = MOS_New(SwFilterSubPipe);
+        SwFilterSubPipe *pipe = CreateSwFilterSubPipe();
         if (nullptr == pipe)
         {
             Clean();
@@ -319,7 +376,7 @@ MOS_STATUS SwFilterPipe::Initialize(VEBOX_SFC_PARAMS &params)
         m_OutputSurfaces.push_back(output);
 
         // Initialize m_OutputPipes.
-        SwFilterSubPipe *pipe = MOS_New(SwFilterSubPipe);
+        SwFilterSubPipe *pipe = CreateSwFilterSubPipe();
         if (nullptr == pipe)
         {
             Clean();
@@ -379,7 +436,7 @@ MOS_STATUS SwFilterPipe::Clean()
         while (!pipe->empty())
         {
             auto p = pipe->back();
-            MOS_Delete(p);
+            DestroySwFilterSubPipe(p);
             pipe->pop_back();
         }
     }
@@ -715,7 +772,7 @@ MOS_STATUS SwFilterPipe::AddSwFilterUnordered(SwFilter *swFilter, bool isInputPi
     if (nullptr == pSubPipe && !isInputPipe)
     {
         auto& pipes = isInputPipe ? m_InputPipes : m_OutputPipes;
-        SwFilterSubPipe *pipe = MOS_New(SwFilterSubPipe);
+        SwFilterSubPipe *pipe = CreateSwFilterSubPipe();
         VP_PUBLIC_CHK_NULL_RETURN(pipe);
         if ((size_t)index <= pipes.size())
         {
@@ -941,7 +998,7 @@ MOS_STATUS SwFilterPipe::AddSurface(VP_SURFACE *&surf, bool isInputSurface, uint
 
     if (nullptr == pipes[index])
     {
-        SwFilterSubPipe *pipe = MOS_New(SwFilterSubPipe);
+        SwFilterSubPipe *pipe = CreateSwFilterSubPipe();
         VP_PUBLIC_CHK_NULL_RETURN(pipe);
         pipes[index] = pipe;
     }
@@ -1056,7 +1113,16 @@ MOS_STATUS SwFilterPipe::RemoveUnusedLayers(bool bUpdateInput)
         VP_PUBLIC_CHK_STATUS_RETURN(::RemoveUnusedLayers(indexForRemove, m_linkedLayerIndex));
     }
 
-    VP_PUBLIC_CHK_STATUS_RETURN(::RemoveUnusedLayers(indexForRemove, pipes, true));
+    for (uint32_t index : indexForRemove)
+    {
+        if (index >= pipes.size())
+        {
+            VP_PUBLIC_CHK_STATUS_RETURN(MOS_STATUS_INVALID_PARAMETER);
+        }
+        // Sub pipes are recycled instead of being freed.
+        DestroySwFilterSubPipe(pipes[index]);
+    }
+    VP_PUBLIC_CHK_STATUS_RETURN(::RemoveUnusedLayers(indexForRemove, pipes, false));
 
     return MOS_STATUS_SUCCESS;
 }
@@ -106,6 +106,7 @@ public:
 private:
     std::vector<SwFilterSet *> m_OrderedFilters;    // For features in featureRule
     SwFilterSet m_UnorderedFilters;                 // For features not in featureRule
+    std::vector<SwFilterSet *> m_freeFilterSets;    // Cleaned filter sets kept for reuse
 
 MEDIA_CLASS_DEFINE_END(vp__SwFilterSubPipe)
 };
@@ -240,9 +241,12 @@ protected:
     MOS_STATUS CleanFeaturesFromPipe(bool isInputPipe);
     MOS_STATUS CleanFeatures();
     MOS_STATUS RemoveUnusedLayers(bool bUpdateInput);
+    SwFilterSubPipe *CreateSwFilterSubPipe();
+    void DestroySwFilterSubPipe(SwFilterSubPipe *&pipe);
 
     std::vector<SwFilterSubPipe *>      m_InputPipes;       // For features on input surfaces.
     std::vector<SwFilterSubPipe *>      m_OutputPipes;      // For features on output surfaces.
+    std::vector<SwFilterSubPipe *>      m_freeSubPipes;     // Cleaned sub pipes kept for reuse.
 
     std::vector<VP_SURFACE *>           m_InputSurfaces;
     std::vector<VP_SURFACE *>           m_OutputSurfaces;
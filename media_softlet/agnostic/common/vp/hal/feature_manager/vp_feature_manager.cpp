@@ -194,6 +194,12 @@ MOS_STATUS VpFeatureManagerNext::UnregisterFeatures()
 {
     VP_FUNC_CALL();
 
+    if (m_policy)
+    {
+        // Cached sw filter clones need the handlers to be released.
+        m_policy->ClearExecutionEnginesCache();
+    }
+
     while (!m_featureHandler.empty())
     {
         auto it = m_featureHandler.begin();
@@ -602,6 +602,14 @@ MOS_STATUS VpRenderCmdPacket::SetupSurfaceState()
 
     if (!m_kernel->GetKernelSurfaceConfig().empty())
     {
+        // Memory object control is the same for all surfaces without overwrite params,
+        // so query the cache policy once instead of once per surface. FC binds up to
+        // VP_COMP_MAX_LAYERS (8) input layers per phase; compositions with more layers,
+        // e.g. 16, are split into several phases and run this setup once per phase.
+        uint32_t internalMemObjCtl = (m_renderHal->pOsInterface->pfnCachePolicyGetMemoryObject(
+            MOS_HW_RESOURCE_USAGE_VP_INTERNAL_READ_WRITE_RENDER,
+            m_renderHal->pOsInterface->pfnGetGmmClientContext(m_renderHal->pOsInterface))).DwordValue;
+
         for (auto surface = m_kernel->GetKernelSurfaceConfig().begin(); surface != m_kernel->GetKernelSurfaceConfig().end(); surface++)
         {
             KERNEL_SURFACE_STATE_PARAM *kernelSurfaceParam = &surface->second;
@@ -625,9 +633,7 @@ MOS_STATUS VpRenderCmdPacket::SetupSurfaceState()
                 renderSurfaceParams.bWidthInDword_UV = true;
 
                 //set mem object control for cache
-                renderSurfaceParams.MemObjCtl = (m_renderHal->pOsInterface->pfnCachePolicyGetMemoryObject(
-                    MOS_HW_RESOURCE_USAGE_VP_INTERNAL_READ_WRITE_RENDER,
-                    m_renderHal->pOsInterface->pfnGetGmmClientContext(m_renderHal->pOsInterface))).DwordValue;
+                renderSurfaceParams.MemObjCtl = internalMemObjCtl;
             }
 
             VP_SURFACE *vpSurface = nullptr;
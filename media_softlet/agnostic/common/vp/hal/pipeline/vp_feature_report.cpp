@@ -57,6 +57,7 @@ void VpFeatureReport::InitReportValue()
     m_features.diScdMode           = false;
     m_features.veFeatureInUse      = false;
     m_features.hdrMode             = VPHAL_HDR_MODE_NONE;
+    m_features.veboxNumInUse       = 0;
 
     return;
 }
@@ -132,7 +133,8 @@ void VpFeatureReport::SetConfigValues(
         RTCompressMode %d, \
         PrimaryCompressible %d, \
         PrimaryCompressMode %d, \
-        CompositionMode %d",
+        CompositionMode %d, \
+        VeboxNumInUse %d",
         m_features.outputPipeMode,
         m_features.hdrMode,
         m_features.veFeatureInUse,
@@ -143,7 +145,8 @@ void VpFeatureReport::SetConfigValues(
         m_features.rtCompressMode,
         m_features.primaryCompressible,
         m_features.primaryCompressMode,
-        m_features.compositionMode);
+        m_features.compositionMode,
+        m_features.veboxNumInUse);
     MT_LOG5(MT_VP_FTR_REPORT, MT_NORMAL, MT_VP_RENDERDATA_OUTPUT_PIPE, m_features.outputPipeMode, MT_VP_RENDER_VE_HDRMODE, m_features.hdrMode, 
         MT_VP_RENDER_VE_FTRINUSE, m_features.veFeatureInUse, MT_VP_HAL_SCALING_MODE, m_features.scalingMode, MT_VP_HAL_MMCINUSE, m_features.vpMMCInUse);
 
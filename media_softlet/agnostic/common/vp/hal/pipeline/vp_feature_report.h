@@ -69,6 +69,7 @@ public:
         bool                          diScdMode           = false;                        //!< Scene change detection
         VPHAL_HDR_MODE                hdrMode             = VPHAL_HDR_MODE_NONE;          //!< HDR mode
         bool                          packetReused        = false;                        //!< true if packet reused.
+        uint8_t                       veboxNumInUse       = 0;                            //!< Number of vebox pipes the frame is split across.
     };
 
     virtual ~VpFeatureReport(){};
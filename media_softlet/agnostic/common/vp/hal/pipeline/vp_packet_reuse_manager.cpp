@@ -25,6 +25,7 @@
 //!           this file is for the base interface which is shared by all features.
 //!
 
+#include <type_traits>
 #include "vp_packet_reuse_manager.h"
 #include "vp_vebox_cmd_packet_base.h"
 #include "vp_user_feature_control.h"
@@ -32,6 +33,46 @@
 
 using namespace vp;
 
+// FNV-1a, only used to pick the cached packet pipe. Parameters are fully compared afterwards.
+static uint64_t HashBytes(uint64_t seed, const void *data, size_t size)
+{
+    const uint8_t *p = (const uint8_t *)data;
+    for (size_t i = 0; i < size; ++i)
+    {
+        seed = (seed ^ p[i]) * 0x100000001b3ull;
+    }
+    return seed;
+}
+
+// Only scalars are hashed by value, padding bytes of structures are not initialized.
+template <typename T>
+static uint64_t HashValue(uint64_t seed, const T &value)
+{
+    static_assert(std::is_scalar<T>::value, "hash the fields of structures one by one");
+    return HashBytes(seed, &value, sizeof(T));
+}
+
+static uint64_t HashRect(uint64_t seed, const RECT &rect)
+{
+    seed = HashValue(seed, rect.left);
+    seed = HashValue(seed, rect.top);
+    seed = HashValue(seed, rect.right);
+    seed = HashValue(seed, rect.bottom);
+    return seed;
+}
+
+static uint64_t HashScalingParams(uint64_t seed, const FeatureParamScaling::SCALING_PARAMS &params)
+{
+    seed = HashValue(seed, params.dwWidth);
+    seed = HashValue(seed, params.dwHeight);
+    seed = HashRect(seed, params.rcSrc);
+    seed = HashRect(seed, params.rcDst);
+    seed = HashRect(seed, params.rcMaxSrc);
+    seed = HashValue(seed, params.sampleType);
+    seed = HashValue(seed, params.tileMode);
+    return seed;
+}
+
 /*******************************************************************/
 /***********************VpFeatureReuseBase**************************/
 /*******************************************************************/
@@ -52,6 +93,11 @@ MOS_STATUS VpFeatureReuseBase::UpdatePacket(SwFilter *filter, VpCmdPacket *packe
     return MOS_STATUS_SUCCESS;
 }
 
+uint64_t VpFeatureReuseBase::GetHashKey(SwFilter *filter, uint64_t seed)
+{
+    return filter ? HashValue(seed, filter->GetFeatureType()) : seed;
+}
+
 /*******************************************************************/
 /***********************VpScalingReuse******************************/
 /*******************************************************************/
@@ -90,6 +136,23 @@ MOS_STATUS VpScalingReuse::UpdatePacket(SwFilter *filter, VpCmdPacket *packet)
     return MOS_STATUS_SUCCESS;
 }
 
+uint64_t VpScalingReuse::GetHashKey(SwFilter *filter, uint64_t seed)
+{
+    SwFilterScaling *scaling = dynamic_cast<SwFilterScaling *>(filter);
+    if (nullptr == scaling)
+    {
+        return VpFeatureReuseBase::GetHashKey(filter, seed);
+    }
+    FeatureParamScaling &params = scaling->GetSwFilterParams();
+    seed = VpFeatureReuseBase::GetHashKey(filter, seed);
+    seed = HashValue(seed, params.formatInput);
+    seed = HashValue(seed, params.formatOutput);
+    seed = HashScalingParams(seed, params.input);
+    seed = HashScalingParams(seed, params.output);
+    seed = HashValue(seed, params.scalingMode);
+    return seed;
+}
+
 MOS_STATUS VpScalingReuse::UpdateFeatureParams(FeatureParamScaling &params)
 {
     m_params = params;
@@ -164,6 +227,22 @@ MOS_STATUS VpCscReuse::UpdatePacket(SwFilter *filter, VpCmdPacket *packet)
     return MOS_STATUS_SUCCESS;
 }
 
+uint64_t VpCscReuse::GetHashKey(SwFilter *filter, uint64_t seed)
+{
+    SwFilterCsc *csc = dynamic_cast<SwFilterCsc *>(filter);
+    if (nullptr == csc)
+    {
+        return VpFeatureReuseBase::GetHashKey(filter, seed);
+    }
+    FeatureParamCsc &params = csc->GetSwFilterParams();
+    seed = VpFeatureReuseBase::GetHashKey(filter, seed);
+    seed = HashValue(seed, params.formatInput);
+    seed = HashValue(seed, params.formatOutput);
+    seed = HashValue(seed, params.input.colorSpace);
+    seed = HashValue(seed, params.output.colorSpace);
+    return seed;
+}
+
 MOS_STATUS VpCscReuse::UpdateFeatureParams(FeatureParamCsc &params)
 {
     VP_FUNC_CALL();
@@ -231,6 +310,17 @@ MOS_STATUS VpRotMirReuse::UpdatePacket(SwFilter *filter, VpCmdPacket *packet)
     return MOS_STATUS_SUCCESS;
 }
 
+uint64_t VpRotMirReuse::GetHashKey(SwFilter *filter, uint64_t seed)
+{
+    SwFilterRotMir *rot = dynamic_cast<SwFilterRotMir *>(filter);
+    if (nullptr == rot)
+    {
+        return VpFeatureReuseBase::GetHashKey(filter, seed);
+    }
+    seed = VpFeatureReuseBase::GetHashKey(filter, seed);
+    return HashValue(seed, rot->GetSwFilterParams().rotation);
+}
+
 MOS_STATUS VpRotMirReuse::UpdateFeatureParams(FeatureParamRotMir &params)
 {
     m_params = params;
@@ -562,18 +652,18 @@ VpPacketReuseManager::VpPacketReuseManager(PacketPipeFactory &packetPipeFactory,
 
 VpPacketReuseManager::~VpPacketReuseManager()
 {
-    if (m_pipeReused)
+    for (auto &entry : m_entries)
     {
-        m_packetPipeFactory.ReturnPacketPipe(m_pipeReused);
-    }
-    for (auto &it : m_features)
-    {
-        if (it.second)
+        ReleaseEntryPipe(entry);
+        for (auto &it : entry.features)
         {
-            MOS_Delete(it.second);
+            if (it.second)
+            {
+                MOS_Delete(it.second);
+            }
         }
+        entry.features.clear();
     }
-    m_features.clear();
 }
 
 MOS_STATUS VpPacketReuseManager::RegisterFeatures()
@@ -583,51 +673,129 @@ MOS_STATUS VpPacketReuseManager::RegisterFeatures()
     {
         return MOS_STATUS_SUCCESS;
     }
+
+    // Each cached packet pipe keeps its own copy of the feature parameters it was built with.
+    for (auto &entry : m_entries)
+    {
+        VP_PUBLIC_CHK_STATUS_RETURN(CreateFeatureReuseObjs(entry.features));
+    }
+
+    return MOS_STATUS_SUCCESS;
+}
+
+MOS_STATUS VpPacketReuseManager::CreateFeatureReuseObjs(std::map<FeatureType, VpFeatureReuseBase *> &features)
+{
+    VP_FUNC_CALL()
     VpFeatureReuseBase *p = MOS_New(VpScalingReuse);
     VP_PUBLIC_CHK_NULL_RETURN(p);
-    m_features.insert(std::make_pair(FeatureTypeScaling, p));
+    features.insert(std::make_pair(FeatureTypeScaling, p));
 
     p = MOS_New(VpCscReuse);
     VP_PUBLIC_CHK_NULL_RETURN(p);
-    m_features.insert(std::make_pair(FeatureTypeCsc, p));
+    features.insert(std::make_pair(FeatureTypeCsc, p));
 
     p = MOS_New(VpRotMirReuse);
     VP_PUBLIC_CHK_NULL_RETURN(p);
-    m_features.insert(std::make_pair(FeatureTypeRotMir, p));
+    features.insert(std::make_pair(FeatureTypeRotMir, p));
 
     p = MOS_New(VpColorFillReuse);
     VP_PUBLIC_CHK_NULL_RETURN(p);
-    m_features.insert(std::make_pair(FeatureTypeColorFill, p));
+    features.insert(std::make_pair(FeatureTypeColorFill, p));
 
     p = MOS_New(VpDenoiseReuse);
     VP_PUBLIC_CHK_NULL_RETURN(p);
-    m_features.insert(std::make_pair(FeatureTypeDn, p));
+    features.insert(std::make_pair(FeatureTypeDn, p));
 
     p = MOS_New(VpAlphaReuse);
     VP_PUBLIC_CHK_NULL_RETURN(p);
-    m_features.insert(std::make_pair(FeatureTypeAlpha, p));
+    features.insert(std::make_pair(FeatureTypeAlpha, p));
 
     p = MOS_New(VpTccReuse);
     VP_PUBLIC_CHK_NULL_RETURN(p);
-    m_features.insert(std::make_pair(FeatureTypeTcc, p));
+    features.insert(std::make_pair(FeatureTypeTcc, p));
 
     p = MOS_New(VpSteReuse);
     VP_PUBLIC_CHK_NULL_RETURN(p);
-    m_features.insert(std::make_pair(FeatureTypeSte, p));
+    features.insert(std::make_pair(FeatureTypeSte, p));
 
     p = MOS_New(VpProcampReuse);
     VP_PUBLIC_CHK_NULL_RETURN(p);
-    m_features.insert(std::make_pair(FeatureTypeProcamp, p));
-
+    features.insert(std::make_pair(FeatureTypeProcamp, p));
 
     return MOS_STATUS_SUCCESS;
 }
 
+uint64_t VpPacketReuseManager::GetHashKey(SwFilterPipe &pipe, const std::vector<FeatureType> &featureTypes)
+{
+    uint64_t key = 0xcbf29ce484222325ull;
+
+    for (uint32_t i = 0; i < 2; ++i)
+    {
+        VP_SURFACE *surf = pipe.GetSurface(0 == i, 0);
+        if (surf && surf->osSurface)
+        {
+            key = HashValue(key, surf->osSurface->Format);
+            key = HashValue(key, surf->osSurface->dwWidth);
+            key = HashValue(key, surf->osSurface->dwHeight);
+        }
+    }
+
+    auto &features = m_entries[0].features;
+    for (auto feature : featureTypes)
+    {
+        auto it = features.find(feature);
+        if (features.end() != it)
+        {
+            key = it->second->GetHashKey(pipe.GetSwFilter(true, 0, feature), key);
+        }
+    }
+
+    return key;
+}
+
+VpPacketReuseManager::PacketPipeReuseEntry *VpPacketReuseManager::SelectEntry(uint64_t key, const std::vector<FeatureType> &featureTypes)
+{
+    PacketPipeReuseEntry *lru = &m_entries[0];
+
+    for (auto &entry : m_entries)
+    {
+        if (entry.pipe && entry.key == key && entry.featureTypes == featureTypes)
+        {
+            return &entry;
+        }
+        if ((nullptr == entry.pipe && nullptr != lru->pipe) ||
+            ((nullptr == entry.pipe) == (nullptr == lru->pipe) && entry.lastUsed < lru->lastUsed))
+        {
+            // Prefer empty entry, then least recently used one.
+            lru = &entry;
+        }
+    }
+
+    // No packet pipe built for current parameters. Recycle the least recently used entry.
+    ReleaseEntryPipe(*lru);
+    return lru;
+}
+
+void VpPacketReuseManager::ReleaseEntryPipe(PacketPipeReuseEntry &entry)
+{
+    if (entry.pipe)
+    {
+        if (m_pipeReused == entry.pipe)
+        {
+            m_pipeReused = nullptr;
+        }
+        m_packetPipeFactory.ReturnPacketPipe(entry.pipe);
+        entry.pipe = nullptr;
+    }
+}
+
 MOS_STATUS VpPacketReuseManager::PreparePacketPipeReuse(SwFilterPipe *&swFilterPipe, Policy &policy, VpResourceManager &resMgr, bool &isPacketPipeReused)
 {
     VP_FUNC_CALL();
-    bool reusableOfLastPipe = m_reusable;
-    m_reusable = true;
+    m_reusable         = true;
+    m_curEntry         = nullptr;
+    m_pipeReused       = nullptr;
+    isPacketPipeReused = false;
 
     if (m_disablePacketReuse)
     {
@@ -640,19 +808,12 @@ MOS_STATUS VpPacketReuseManager::PreparePacketPipeReuse(SwFilterPipe *&swFilterP
     {
         m_reusable = false;
         VP_PUBLIC_NORMALMESSAGE("Not reusable for multi-layer cases.");
-
-        if (m_pipeReused)
-        {
-            m_packetPipeFactory.ReturnPacketPipe(m_pipeReused);
-        }
-
         return MOS_STATUS_SUCCESS;
     }
 
     auto &pipe = *swFilterPipe;
     auto featureRegistered = policy.GetFeatureRegistered();
-
-    isPacketPipeReused = true;
+    std::vector<FeatureType> featureTypes;
 
     for (auto feature : featureRegistered)
     {
@@ -661,14 +822,33 @@ MOS_STATUS VpPacketReuseManager::PreparePacketPipeReuse(SwFilterPipe *&swFilterP
         {
             continue;
         }
-        auto it = m_features.find(feature);
-        if (m_features.end() == it)
+        if (m_entries[0].features.end() == m_entries[0].features.find(feature))
         {
+            VP_PUBLIC_NORMALMESSAGE("Not reusable for feature %d", feature);
             m_reusable = false;
             return MOS_STATUS_SUCCESS;
         }
+        featureTypes.push_back(feature);
+    }
+
+    uint64_t key = GetHashKey(pipe, featureTypes);
+    PacketPipeReuseEntry *entry = SelectEntry(key, featureTypes);
+    VP_PUBLIC_CHK_NULL_RETURN(entry);
+
+    bool reusableOfEntry = nullptr != entry->pipe;
+    isPacketPipeReused   = reusableOfEntry;
+
+    for (auto feature : featureTypes)
+    {
+        SwFilter *swfilter = pipe.GetSwFilter(true, 0, feature);
+        auto it = entry->features.find(feature);
+        VP_PUBLIC_CHK_NULL_RETURN(swfilter);
+        if (entry->features.end() == it)
+        {
+            VP_PUBLIC_CHK_STATUS_RETURN(MOS_STATUS_INVALID_PARAMETER);
+        }
         bool reused = false;
-        it->second->UpdateFeatureParams(reusableOfLastPipe, reused, swfilter);
+        it->second->UpdateFeatureParams(reusableOfEntry, reused, swfilter);
         if (!reused)
         {
             VP_PUBLIC_NORMALMESSAGE("Packet not reused for feature %d", feature);
@@ -680,20 +860,20 @@ MOS_STATUS VpPacketReuseManager::PreparePacketPipeReuse(SwFilterPipe *&swFilterP
         isPacketPipeReused &= reused;
     }
 
+    entry->key          = key;
+    entry->featureTypes = featureTypes;
+    entry->lastUsed     = ++m_useCounter;
+    m_curEntry          = entry;
+
     if (!isPacketPipeReused)
     {
-        // m_pipeReused will be udpated in UpdatePacketPipeConfig.
+        // Entry pipe will be udpated in UpdatePacketPipeConfig.
         VP_PUBLIC_NORMALMESSAGE("Packet cannot be reused.");
-
-        if (m_pipeReused)
-        {
-            m_packetPipeFactory.ReturnPacketPipe(m_pipeReused);
-        }
-
+        ReleaseEntryPipe(*entry);
         return MOS_STATUS_SUCCESS;
     }
 
-    VP_PUBLIC_CHK_NULL_RETURN(m_pipeReused);
+    m_pipeReused = entry->pipe;
 
     if (0 == m_pipeReused->PacketNum())
     {
@@ -711,16 +891,11 @@ MOS_STATUS VpPacketReuseManager::PreparePacketPipeReuse(SwFilterPipe *&swFilterP
     VP_PUBLIC_CHK_STATUS_RETURN(packet->PacketInitForReuse(pipe.GetSurface(true, 0), pipe.GetSurface(false, 0), pipe.GetPastSurface(0), surfSetting, caps));
 
     // Update Packet
-    for (auto it : m_features)
+    for (auto feature : featureTypes)
     {
-        SwFilter *swfilter = pipe.GetSwFilter(true, 0, it.first);
-        if (nullptr == swfilter)
-        {
-            continue;
-        }
-
-        VP_PUBLIC_NORMALMESSAGE("Update Packet for feature %d", it.first);
-        VP_PUBLIC_CHK_STATUS_RETURN(it.second->UpdatePacket(swfilter, packet));
+        SwFilter *swfilter = pipe.GetSwFilter(true, 0, feature);
+        VP_PUBLIC_NORMALMESSAGE("Update Packet for feature %d", feature);
+        VP_PUBLIC_CHK_STATUS_RETURN(entry->features[feature]->UpdatePacket(swfilter, packet));
     }
 
     return MOS_STATUS_SUCCESS;
@@ -730,7 +905,7 @@ MOS_STATUS VpPacketReuseManager::PreparePacketPipeReuse(SwFilterPipe *&swFilterP
 MOS_STATUS VpPacketReuseManager::UpdatePacketPipeConfig(PacketPipe *&pipe)
 {
     VP_FUNC_CALL();
-    if (!m_reusable)
+    if (!m_reusable || nullptr == m_curEntry)
     {
         VP_PUBLIC_NORMALMESSAGE("Bypass UpdatePacketPipeConfig since not reusable.");
         return MOS_STATUS_SUCCESS;
@@ -758,14 +933,10 @@ MOS_STATUS VpPacketReuseManager::UpdatePacketPipeConfig(PacketPipe *&pipe)
         return MOS_STATUS_SUCCESS;
     }
 
-    if (m_pipeReused)
-    {
-        m_packetPipeFactory.ReturnPacketPipe(m_pipeReused);
-    }
+    ReleaseEntryPipe(*m_curEntry);
 
-    m_pipeReused = pipe;
+    m_curEntry->pipe = pipe;
     pipe = nullptr;
 
     return MOS_STATUS_SUCCESS;
 }
-
@@ -28,6 +28,7 @@
 #ifndef __VP_PACKET_REUSE_MANAGER_H__
 #define __VP_PACKET_REUSE_MANAGER_H__
 
+#include <vector>
 #include "mos_defs.h"
 #include "media_class_trace.h"
 #include "sw_filter.h"
@@ -49,6 +50,9 @@ public:
     virtual ~VpFeatureReuseBase();
     virtual MOS_STATUS UpdateFeatureParams(bool reusable, bool &reused, SwFilter *filter);
     virtual MOS_STATUS UpdatePacket(SwFilter *filter, VpCmdPacket *packet);
+    // Hash of the parameters which select the cached packet pipe. Parameters covered by
+    // UpdatePacket need not be included.
+    virtual uint64_t   GetHashKey(SwFilter *filter, uint64_t seed);
 MEDIA_CLASS_DEFINE_END(vp__VpFeatureReuseBase)
 };
 
@@ -62,6 +66,8 @@ public:
 
     MOS_STATUS UpdatePacket(SwFilter *filter, VpCmdPacket *packet);
 
+    uint64_t GetHashKey(SwFilter *filter, uint64_t seed);
+
 protected:
     MOS_STATUS UpdateFeatureParams(FeatureParamScaling &params);
 
@@ -82,6 +88,8 @@ public:
 
     MOS_STATUS UpdatePacket(SwFilter *filter, VpCmdPacket *packet);
 
+    uint64_t GetHashKey(SwFilter *filter, uint64_t seed);
+
 protected:
     MOS_STATUS UpdateFeatureParams(FeatureParamCsc &params);
 
@@ -101,6 +109,8 @@ public:
 
     MOS_STATUS UpdatePacket(SwFilter *filter, VpCmdPacket *packet);
 
+    uint64_t GetHashKey(SwFilter *filter, uint64_t seed);
+
 protected:
     MOS_STATUS UpdateFeatureParams(FeatureParamRotMir &params);
     FeatureParamRotMir m_params = {};
@@ -220,9 +230,28 @@ public:
     }
 
 protected:
+    // One cached packet pipe together with the feature parameters it was built with.
+    struct PacketPipeReuseEntry
+    {
+        uint64_t                                    key      = 0;
+        uint32_t                                    lastUsed = 0;
+        PacketPipe                                 *pipe     = nullptr;
+        std::vector<FeatureType>                    featureTypes;
+        std::map<FeatureType, VpFeatureReuseBase *> features;
+    };
+
+    virtual MOS_STATUS CreateFeatureReuseObjs(std::map<FeatureType, VpFeatureReuseBase *> &features);
+    uint64_t           GetHashKey(SwFilterPipe &pipe, const std::vector<FeatureType> &featureTypes);
+    PacketPipeReuseEntry *SelectEntry(uint64_t key, const std::vector<FeatureType> &featureTypes);
+    void               ReleaseEntryPipe(PacketPipeReuseEntry &entry);
+
+    static constexpr uint32_t m_maxReuseEntryNum = 4;   // Packet pipes kept for alternating configurations.
+
     bool m_reusable = false;    // Current parameter can be reused.
     PacketPipe *m_pipeReused = nullptr;
-    std::map<FeatureType, VpFeatureReuseBase *> m_features;
+    PacketPipeReuseEntry  m_entries[m_maxReuseEntryNum];
+    PacketPipeReuseEntry *m_curEntry = nullptr;         // Entry selected for current frame.
+    uint32_t m_useCounter = 0;
     PacketPipeFactory &m_packetPipeFactory;
     bool m_disablePacketReuse = false;
 
@@ -142,6 +142,7 @@ MOS_STATUS VpPipeline::UserFeatureReport()
             m_reporting->GetFeatures().outputPipeMode = m_vpPipeContexts[0]->GetOutputPipe();
             m_reporting->GetFeatures().veFeatureInUse = m_vpPipeContexts[0]->IsVeboxInUse();
             m_reporting->GetFeatures().packetReused   = m_vpPipeContexts[0]->IsPacketReUsed();
+            m_reporting->GetFeatures().veboxNumInUse  = m_vpPipeContexts[0]->IsVeboxInUse() ? m_numVebox : 0;
         }
 
         if (m_mmc)
@@ -400,6 +401,7 @@ MOS_STATUS VpPipeline::ExecuteSingleswFilterPipe(VpSinglePipeContext *singlePipe
         m_pPacketPipeFactory->ReturnPacketPipe(pPacketPipe);
         m_vpInterface->GetSwFilterPipeFactory().Destory(pipe);
         m_statusReport->UpdateStatusTableAfterSubmit(eStatus);
+        resourceManager->Update3DLutCacheAfterSubmit(eStatus);
         // Notify resourceManager for end of new frame processing.
         resourceManager->OnNewFrameProcessEnd();
         MT_LOG1(MT_VP_HAL_ONNEWFRAME_PROC_END, MT_NORMAL, MT_VP_HAL_ONNEWFRAME_COUNTER, frameCounter);
@@ -456,6 +458,7 @@ MOS_STATUS VpPipeline::ExecuteSingleswFilterPipe(VpSinglePipeContext *singlePipe
         m_vpInterface->GetSwFilterPipeFactory().Destory(pipe);
 
         m_statusReport->UpdateStatusTableAfterSubmit(eStatus);
+        resourceManager->Update3DLutCacheAfterSubmit(eStatus);
         // Notify resourceManager for end of new frame processing.
         resourceManager->OnNewFrameProcessEnd();
         MT_LOG1(MT_VP_HAL_ONNEWFRAME_PROC_END, MT_NORMAL, MT_VP_HAL_ONNEWFRAME_COUNTER, frameCounter);
@@ -639,6 +642,8 @@ MOS_STATUS VpPipeline::GetSystemVeboxNumber()
 
     VP_PUBLIC_CHK_STATUS_RETURN(UpdateVeboxNumberforScalability());
 
+    m_numVeboxScalable = m_numVebox;
+
     return MOS_STATUS_SUCCESS;
 }
 
@@ -971,6 +976,10 @@ MOS_STATUS VpPipeline::PrepareVpPipelineScalabilityParams(PVP_PIPELINE_PARAMS pa
 
     VP_PUBLIC_CHK_NULL_RETURN(params->pTarget[0]);
 
+    // Vebox number may have been lowered for previous 4k- frame. Restore it to let 4k+ frames
+    // split across all vebox being available again.
+    m_numVebox = m_numVeboxScalable;
+
     // Disable vesfc scalability when reg key "Enable Vebox Scalability" was set to zero
     if (m_forceMultiplePipe == (MOS_SCALABILITY_ENABLE_MODE_USER_FORCE | MOS_SCALABILITY_ENABLE_MODE_FALSE))
     {
@@ -353,6 +353,7 @@ protected:
     VP_MHWINTERFACE        m_vpMhwInterface         = {};   //!< vp Pipeline Mhw Interface
 
     uint8_t                m_numVebox               = 0;
+    uint8_t                m_numVeboxScalable       = 0;    //!< Vebox number allowed by system and user setting, m_numVebox is updated from it per frame.
     uint32_t               m_forceMultiplePipe      = 0;
     VpAllocator           *m_allocator              = nullptr;  //!< vp Pipeline allocator
     VPMediaMemComp        *m_mmc                    = nullptr;  //!< vp Pipeline mmc
@@ -31,6 +31,9 @@ using namespace vp;
 
 const std::string VpRenderKernel::s_kernelNameNonAdvKernels = "vpFcKernels";
 
+std::map<const uint32_t *, KERNEL_POOL> VpPlatformInterface::s_cmKernelCache;
+MosMutex                                VpPlatformInterface::s_cmKernelCacheMutex;
+
 VpPlatformInterface::VpPlatformInterface(PMOS_INTERFACE pOsInterface)
 {
     m_pOsInterface = pOsInterface;
@@ -246,6 +249,18 @@ MOS_STATUS VpPlatformInterface::InitVpCmKernels(
         return MOS_STATUS_INVALID_PARAMETER;
     }
 
+    // The cisa binaries are static, so the parsed kernels are shared by all contexts in the process
+    s_cmKernelCacheMutex.Lock();
+    auto cached = s_cmKernelCache.find(cisaCode);
+    if (cached != s_cmKernelCache.end())
+    {
+        m_kernelPool.insert(cached->second.begin(), cached->second.end());
+        s_cmKernelCacheMutex.Unlock();
+        return MOS_STATUS_SUCCESS;
+    }
+    s_cmKernelCacheMutex.Unlock();
+
+    KERNEL_POOL cmKernels;
     uint8_t *pBuf             = (uint8_t *)cisaCode;
     uint32_t bytePos          = 0;
     uint32_t cisaMagicNumber  = 0;
@@ -288,7 +303,7 @@ MOS_STATUS VpPlatformInterface::InitVpCmKernels(
 
         std::string kernelName(kernel->getName(), kernel->getNameLen());
 
-        if (m_kernelPool.end() != m_kernelPool.find(kernelName))
+        if (cmKernels.end() != cmKernels.find(kernelName))
         {
             continue;
         }
@@ -366,11 +381,16 @@ MOS_STATUS VpPlatformInterface::InitVpCmKernels(
             vpKernel.AddKernelArg(kernelArg);
         }
 
-        m_kernelPool.insert(std::make_pair(vpKernel.GetKernelName(), vpKernel));
+        cmKernels.insert(std::make_pair(vpKernel.GetKernelName(), vpKernel));
     }
 
     MOS_Delete(isaFile);
 
+    m_kernelPool.insert(cmKernels.begin(), cmKernels.end());
+    s_cmKernelCacheMutex.Lock();
+    s_cmKernelCache.insert(std::make_pair(cisaCode, cmKernels));
+    s_cmKernelCacheMutex.Unlock();
+
     return MOS_STATUS_SUCCESS;
 }
 
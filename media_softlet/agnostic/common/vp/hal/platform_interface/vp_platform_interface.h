@@ -328,6 +328,9 @@ protected:
     std::shared_ptr<mhw::render::Itf>       m_renderItf = nullptr;
     std::shared_ptr<mhw::mi::Itf>           m_miItf     = nullptr;
 
+    static std::map<const uint32_t *, KERNEL_POOL> s_cmKernelCache;       //!< Parsed cm kernels per cisa binary, shared by all contexts
+    static MosMutex                                s_cmKernelCacheMutex;  //!< Protects s_cmKernelCache
+
     MEDIA_CLASS_DEFINE_END(vp__VpPlatformInterface)
 };
 
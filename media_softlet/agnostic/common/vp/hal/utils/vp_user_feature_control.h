@@ -114,6 +114,11 @@ public:
         return m_ctrlVal.disablePacketReuse;
     }
 
+    const CONTROL_VALUES &GetControlValues()
+    {
+        return m_ctrlVal;
+    }
+
     const void *m_owner = nullptr; // The object who create current instance.
 
 protected:
@@ -141,6 +141,18 @@ MOS_STATUS OsContextSpecificNext::Init(DDI_DEVICE_CONTEXT ddiDriverContext)
             mos_bufmgr_gem_enable_softpin(m_bufmgr, softpin_va1Malign);
         }
 
+        value = 0;
+        ReadUserSetting(
+            userSettingPtr,
+            value,
+            __MEDIA_USER_FEATURE_VALUE_ENABLE_ASYNC_SUBMISSION,
+            MediaUserSetting::Group::Device);
+
+        if (value)
+        {
+            mos_bufmgr_gem_enable_async_exec(m_bufmgr);
+        }
+
         if (MEDIA_IS_SKU(&m_skuTable, FtrEnableMediaKernels) == 0)
         {
             MEDIA_WR_WA(&m_waTable, WaHucStreamoutOnlyDisable, 0);
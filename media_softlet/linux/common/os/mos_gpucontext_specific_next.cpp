@@ -31,6 +31,7 @@
 #include "mos_cmdbufmgr_next.h"
 #include "mos_os_virtualengine_next.h"
 #include <unistd.h>
+#include <algorithm>
 #include "mos_interface.h"
 
 #define MI_BATCHBUFFER_END 0x05000000
@@ -128,6 +129,14 @@ MOS_STATUS GpuContextSpecificNext::Init(OsContextNext *osContext,
 
     m_osContext = osContext;
 
+    m_asyncSubmission = osParameters->bufmgr && mos_bufmgr_gem_async_exec_enabled(osParameters->bufmgr);
+
+    if (m_residencySet == nullptr && osParameters->bufmgr)
+    {
+        // Failure only costs the per-submit softpin target rebuild
+        m_residencySet = mos_gem_residency_set_create(osParameters->bufmgr);
+    }
+
     MOS_OS_CHK_STATUS_RETURN(AllocateGPUStatusBuf());
 
     m_commandBuffer = (PMOS_COMMAND_BUFFER)MOS_AllocAndZeroMemory(sizeof(MOS_COMMAND_BUFFER));
@@ -452,6 +461,9 @@ void GpuContextSpecificNext::Clear()
     MOS_SafeFreeMemory(m_writeModeList);
     MOS_SafeFreeMemory(m_createOptionEnhanced);
 
+    mos_gem_residency_set_destroy(m_residencySet);
+    m_residencySet = nullptr;
+
     for (int i=0; i<MAX_ENGINE_INSTANCE_NUM; i++)
     {
         if (m_i915Context[i])
@@ -477,11 +489,21 @@ MOS_STATUS GpuContextSpecificNext::RegisterResource(
     PMOS_RESOURCE registeredResources = m_attachedResources;
     uint32_t      allocationIndex     = 0;
 
-    for ( allocationIndex = 0; allocationIndex < m_resCount; allocationIndex++, registeredResources++)
+    // Resources are mostly registered several times per submission, so try the index
+    // recorded by the previous registration before scanning the whole list.
+    int32_t lastIndex = (m_gpuContext < MOS_GPU_CONTEXT_MAX) ? osResource->iAllocationIndex[m_gpuContext] : MOS_INVALID_ALLOC_INDEX;
+    if (lastIndex >= 0 && (uint32_t)lastIndex < m_resCount && m_attachedResources[lastIndex].bo == osResource->bo)
     {
-        if (osResource->bo == registeredResources->bo)
+        allocationIndex = (uint32_t)lastIndex;
+    }
+    else
+    {
+        for (allocationIndex = 0; allocationIndex < m_resCount; allocationIndex++, registeredResources++)
         {
-            break;
+            if (osResource->bo == registeredResources->bo)
+            {
+                break;
+            }
         }
     }
 
@@ -580,7 +602,7 @@ MOS_STATUS GpuContextSpecificNext::GetCommandBuffer(
         MosUtilities::MosLockMutex(m_cmdBufPoolMutex);
         if (m_cmdBufPool.size() < MAX_CMD_BUF_NUM)
         {
-            cmdBuf = m_cmdBufMgr->PickupOneCmdBuf(m_commandBufferSize);
+            cmdBuf = m_cmdBufMgr->PickupOneCmdBuf(m_commandBufferSize, m_nodeOrdinal);
             if (cmdBuf == nullptr)
             {
                 MOS_OS_ASSERTMESSAGE("Invalid (nullptr) Pointer.");
@@ -610,7 +632,7 @@ MOS_STATUS GpuContextSpecificNext::GetCommandBuffer(
             m_cmdBufMgr->ReleaseCmdBuf(cmdBufOld);  // here just return old command buffer to available pool
 
             //pick up new comamnd buffer
-            cmdBuf = m_cmdBufMgr->PickupOneCmdBuf(m_commandBufferSize);
+            cmdBuf = m_cmdBufMgr->PickupOneCmdBuf(m_commandBufferSize, m_nodeOrdinal);
             if (cmdBuf == nullptr)
             {
                 MOS_OS_ASSERTMESSAGE("Invalid (nullptr) Pointer.");
@@ -995,6 +1017,7 @@ MOS_STATUS GpuContextSpecificNext::SubmitCommandBuffer(
     MOS_STATUS   eStatus  = MOS_STATUS_SUCCESS;
     int32_t      ret      = 0;
     bool         scalaEnabled = false;
+    bool         asyncExec    = false;
     auto         it           = m_secondaryCmdBufs.begin();
 
     // Command buffer object DRM pointer
@@ -1017,6 +1040,13 @@ MOS_STATUS GpuContextSpecificNext::SubmitCommandBuffer(
     std::vector<PMOS_RESOURCE> mappedResList;
     std::vector<MOS_LINUX_BO *> skipSyncBoList;
 
+    // Softpin targets of the primary command buffer persist across submissions in the residency set
+    bool useResidencySet = (m_residencySet != nullptr) && !scalaEnabled;
+    if (useResidencySet)
+    {
+        mos_gem_residency_set_begin(m_residencySet);
+    }
+
     // Now, the patching will be done, based on the patch list.
     for (uint32_t patchIndex = 0; patchIndex < m_currentNumPatchLocations; patchIndex++)
     {
@@ -1134,7 +1164,14 @@ MOS_STATUS GpuContextSpecificNext::SubmitCommandBuffer(
         {
             if (alloc_bo != tempCmdBo)
             {
-                ret = mos_bo_add_softpin_target(tempCmdBo, alloc_bo, currentPatch->uiWriteOperation);
+                if (useResidencySet && tempCmdBo == cmd_bo)
+                {
+                    ret = mos_gem_residency_set_add(m_residencySet, alloc_bo, currentPatch->uiWriteOperation);
+                }
+                else
+                {
+                    ret = mos_bo_add_softpin_target(tempCmdBo, alloc_bo, currentPatch->uiWriteOperation);
+                }
             }
         }
         else
@@ -1165,6 +1202,11 @@ MOS_STATUS GpuContextSpecificNext::SubmitCommandBuffer(
     }
     mappedResList.clear();
 
+    if (useResidencySet)
+    {
+        mos_gem_residency_set_end(m_residencySet);
+    }
+
     if (scalaEnabled)
     {
          it = m_secondaryCmdBufs.begin();
@@ -1291,6 +1333,11 @@ MOS_STATUS GpuContextSpecificNext::SubmitCommandBuffer(
     }
     else if (nullRendering == false)
     {
+        if (useResidencySet)
+        {
+            // Consumed by the next exec of cmd_bo
+            mos_gem_bo_set_residency_set(cmd_bo, m_residencySet);
+        }
         UnlockPendingOcaBuffers(cmdBuffer, perStreamParameters);
         if (streamState->ctxBasedScheduling && m_i915Context[0] != nullptr)
         {
@@ -1337,6 +1384,11 @@ MOS_STATUS GpuContextSpecificNext::SubmitCommandBuffer(
                                              DR4);
                 }
             }
+            else if (m_asyncSubmission)
+            {
+                asyncExec = true;
+                ret       = SubmitCommandBufferAsync(cmd_bo, m_i915Context[0], DR4, m_i915ExecFlag);
+            }
             else
             {
                 ret = mos_gem_bo_context_exec2(cmd_bo,
@@ -1349,6 +1401,11 @@ MOS_STATUS GpuContextSpecificNext::SubmitCommandBuffer(
                     nullptr);
             }
         }
+        else if (m_asyncSubmission)
+        {
+            asyncExec = true;
+            ret       = SubmitCommandBufferAsync(cmd_bo, perStreamParameters->intel_context, DR4, execFlag);
+        }
         else
         {
             ret = mos_gem_bo_context_exec2(cmd_bo,
@@ -1405,8 +1462,8 @@ if (streamState->dumpCommandBuffer)
     }
 #endif  //(_DEBUG || _RELEASE_INTERNAL)
 
-    //clear command buffer relocations to fix memory leak issue
-    for (uint32_t patchIndex = 0; patchIndex < m_currentNumPatchLocations; patchIndex++)
+    //clear command buffer relocations to fix memory leak issue, the submit thread does it for async exec
+    for (uint32_t patchIndex = 0; patchIndex < m_currentNumPatchLocations && !asyncExec; patchIndex++)
     {
         auto currentPatch = &m_patchLocationList[patchIndex];
         MOS_OS_CHK_NULL_RETURN(currentPatch);
@@ -1438,6 +1495,32 @@ finish:
     return eStatus;
 }
 
+int32_t GpuContextSpecificNext::SubmitCommandBufferAsync(
+    MOS_LINUX_BO        *cmdBo,
+    MOS_LINUX_CONTEXT   *i915Context,
+    int32_t             DR4,
+    uint32_t            execFlag)
+{
+    // Command buffers whose relocations have to be cleared once the exec reached the kernel
+    std::vector<MOS_LINUX_BO *> clearBoList;
+    for (uint32_t patchIndex = 0; patchIndex < m_currentNumPatchLocations; patchIndex++)
+    {
+        auto patchCmdBo = m_patchLocationList[patchIndex].cmdBo;
+        if (patchCmdBo && std::find(clearBoList.begin(), clearBoList.end(), patchCmdBo) == clearBoList.end())
+        {
+            clearBoList.push_back(patchCmdBo);
+        }
+    }
+
+    return mos_gem_bo_context_exec2_async(cmdBo,
+        m_commandBufferSize,
+        i915Context,
+        DR4,
+        execFlag,
+        clearBoList.data(),
+        (int)clearBoList.size());
+}
+
 void GpuContextSpecificNext::UnlockPendingOcaBuffers(PMOS_COMMAND_BUFFER cmdBuffer, PMOS_CONTEXT mosContext)
 {
     MOS_OS_CHK_NULL_NO_STATUS_RETURN(cmdBuffer);
@@ -262,6 +262,20 @@ protected:
 
     void UnlockPendingOcaBuffers(PMOS_COMMAND_BUFFER cmdBuffer, PMOS_CONTEXT mosContext);
 
+    //!
+    //! \brief    Queue the patched command buffer to the buffer manager submit thread
+    //! \details  Relocations of the patched command buffers are cleared by the submit
+    //!           thread after the exec, ordering with later submissions, waits and maps
+    //!           is kept by the buffer manager.
+    //! \return   int32_t
+    //!           0 if queued or submitted, else exec error
+    //!
+    int32_t SubmitCommandBufferAsync(
+        MOS_LINUX_BO        *cmdBo,
+        MOS_LINUX_CONTEXT   *i915Context,
+        int32_t             DR4,
+        uint32_t            execFlag);
+
 private:
     //! \brief    internal command buffer pool per gpu context
     std::vector<CommandBufferNext *> m_cmdBufPool;
@@ -314,6 +328,10 @@ private:
     uint32_t     m_i915ExecFlag = 0;
     int32_t      m_currCtxPriority = 0;
     bool m_ocaLogSectionSupported = true;
+    //! \brief    Exec through the buffer manager submit thread
+    bool m_asyncSubmission = false;
+    //! \brief    Softpin targets of the primary command buffer kept across submissions
+    struct mos_gem_residency_set *m_residencySet = nullptr;
     // bool m_ocaSizeIncreaseDone = false;
 
 #if (_DEBUG || _RELEASE_INTERNAL)
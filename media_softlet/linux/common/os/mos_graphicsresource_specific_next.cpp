@@ -362,6 +362,10 @@ void GraphicsResourceSpecificNext::Free(OsContextNext* osContextPtr, uint32_t  f
 
     if (boPtr)
     {
+        // pairs with the EVENT_RESOURCE_ALLOCATE info event by bo handle
+        uint32_t eventData[] = {boPtr->handle, m_size};
+        MOS_TraceEventExt(EVENT_RESOURCE_FREE, EVENT_TYPE_INFO, eventData, sizeof(eventData), nullptr, 0);
+
         AuxTableMgr *auxTableMgr = pOsContextSpecific->GetAuxTableMgr();
         if (auxTableMgr)
         {
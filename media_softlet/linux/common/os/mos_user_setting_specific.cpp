@@ -36,6 +36,13 @@ MOS_STATUS MosUserSetting::InitMosUserSettingSpecific(MediaUserSettingSharedPtr
         1,
         true); //"Switch between softpin and relocation."
 
+    DeclareUserSettingKey(
+        userSettingPtr,
+        __MEDIA_USER_FEATURE_VALUE_ENABLE_ASYNC_SUBMISSION,
+        MediaUserSetting::Group::Device,
+        0,
+        true); //"Hand command buffer execs to a submit thread, softpin only."
+
 #if (_DEBUG || _RELEASE_INTERNAL)
     DeclareUserSettingKeyForDebug(
         userSettingPtr,